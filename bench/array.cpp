@@ -0,0 +1,119 @@
+#define ATOM_NDEBUG
+#include "array/array.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+// Arrays of 4096 slots which hold state.range(0) elements
+static constexpr std::size_t MAX_SIZE = 4096;
+
+struct msg_t {
+    std::uint64_t id;
+    std::uint32_t kind;
+    std::uint32_t length;
+    char          payload[48];
+};
+
+template<typename Tp>
+static Tp make_value(const std::size_t i) {
+    if constexpr (std::is_same<Tp, std::string>::value) {
+        return std::string(8, static_cast<char>('a' + i % 26));
+    }
+    else {
+        Tp value{};
+        value.id = i;
+        return value;
+    }
+}
+
+template<typename Tp>
+static void fill(atom::array_t<Tp, MAX_SIZE>& array, const std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        array.push_back(make_value<Tp>(i));
+    }
+}
+
+template<typename Tp>
+static void BM_ArrayCopy(benchmark::State& state) {
+    const auto                         n = static_cast<std::size_t>(state.range(0));
+    static atom::array_t<Tp, MAX_SIZE> src;
+    static atom::array_t<Tp, MAX_SIZE> dst;
+
+    src.clear();
+    fill(src, n);
+
+    for (auto _ : state) {
+        dst = src;
+        benchmark::DoNotOptimize(&dst);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Tp>
+static void BM_ArrayMove(benchmark::State& state) {
+    const auto                         n = static_cast<std::size_t>(state.range(0));
+    static atom::array_t<Tp, MAX_SIZE> first;
+    static atom::array_t<Tp, MAX_SIZE> second;
+
+    first.clear();
+    second.clear();
+    fill(first, n);
+
+    for (auto _ : state) {
+        second = std::move(first);
+        first  = std::move(second);
+        benchmark::DoNotOptimize(&first);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(2 * state.iterations());
+}
+
+template<typename Tp>
+static void BM_ArraySwap(benchmark::State& state) {
+    const auto                         n = static_cast<std::size_t>(state.range(0));
+    static atom::array_t<Tp, MAX_SIZE> first;
+    static atom::array_t<Tp, MAX_SIZE> second;
+
+    first.clear();
+    second.clear();
+    fill(first, n);
+    fill(second, n / 2);
+
+    for (auto _ : state) {
+        first.swap(second);
+        benchmark::DoNotOptimize(&first);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Construction and destruction of the array with state.range(0) strings
+static void BM_ArrayConstructDestroy(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        atom::array_t<std::string, 1024> array;
+        for (std::size_t i = 0; i < n; ++i) {
+            array.push_back(std::string());
+        }
+        benchmark::DoNotOptimize(&array);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_ArrayCopy, msg_t)->Arg(3)->Arg(MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_ArrayMove, msg_t)->Arg(3)->Arg(MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_ArraySwap, msg_t)->Arg(3)->Arg(MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_ArrayCopy, std::string)->Arg(3)->Arg(MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_ArrayMove, std::string)->Arg(3)->Arg(MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_ArraySwap, std::string)->Arg(3)->Arg(MAX_SIZE);
+
+BENCHMARK(BM_ArrayConstructDestroy)->Arg(0)->Arg(3);
+
+BENCHMARK_MAIN();
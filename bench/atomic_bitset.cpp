@@ -0,0 +1,67 @@
+#define ATOM_NDEBUG
+#include "atomic_bitset/atomic_bitset.h"
+#include "vector/vector.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+
+static const std::size_t COUNT = 1 << 22;
+
+static atom::atomic_bitset_t marks(COUNT);
+
+// Every thread marks a pseudo-random sequence of positions, bits of one block are shared
+static void BM_AtomicTestAndSet(benchmark::State& state) {
+    unsigned int seed = 1 + static_cast<unsigned int>(state.thread_index());
+
+    for (auto _ : state) {
+        for (int i = 0; i < 1024; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            benchmark::DoNotOptimize(marks.test_and_set(seed % COUNT, std::memory_order_relaxed));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+static void BM_AtomicFetchOrBlock(benchmark::State& state) {
+    unsigned int seed = 1 + static_cast<unsigned int>(state.thread_index());
+
+    for (auto _ : state) {
+        for (int i = 0; i < 1024; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            benchmark::DoNotOptimize(marks.fetch_or_block(seed % marks.count_blocks(), seed, std::memory_order_relaxed));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+// Plain read-modify-write, it is correct only in one thread
+static void BM_VectorSet(benchmark::State& state) {
+    atom::vector_t<bool> bits(COUNT, false);
+    unsigned int         seed = 1;
+
+    for (auto _ : state) {
+        for (int i = 0; i < 1024; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            bits.set(seed % COUNT);
+        }
+        benchmark::DoNotOptimize(bits.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+static void BM_AtomicCount(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(marks.count());
+    }
+
+    state.SetBytesProcessed(state.iterations() * COUNT / 8);
+}
+
+BENCHMARK(BM_AtomicTestAndSet)->Threads(1)->Threads(4);
+BENCHMARK(BM_AtomicFetchOrBlock)->Threads(1)->Threads(4);
+BENCHMARK(BM_VectorSet);
+BENCHMARK(BM_AtomicCount);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,103 @@
+#define ATOM_NDEBUG
+#include "bloom/bloom.h"
+#include "vector/vector.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+// Args: count of the keys, the filter is sized for 1% of false positives
+static std::vector<std::uint64_t> make_hashes(const std::size_t n, const std::uint64_t first) {
+    std::vector<std::uint64_t> result(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        result[i] = atom::bloom_filter_t::hash(first + i);
+    }
+    return result;
+}
+
+static atom::bloom_filter_t make_filter(const std::size_t n) {
+    atom::bloom_filter_t filter = atom::bloom_filter_t::with_capacity(n, 0.01);
+    for (std::uint64_t hash : make_hashes(n, 0)) {
+        filter.insert(hash);
+    }
+    return filter;
+}
+
+// Classic filter of the same size: k probes spread over the whole vector_t<bool>
+static void BM_ClassicContains(benchmark::State& state) {
+    const auto                       n      = static_cast<std::size_t>(state.range(0));
+    const atom::bloom_filter_t       filter = make_filter(n);
+    atom::vector_t<bool>             bits(filter.size(), false);
+    const std::vector<std::uint64_t> keys   = make_hashes(1 << 16, n / 2);
+
+    for (std::uint64_t hash : make_hashes(n, 0)) {
+        for (unsigned int i = 0; i < filter.k(); ++i) {
+            bits.set((hash + i * (hash >> 32 | 1)) % bits.size());
+        }
+    }
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::uint64_t hash : keys) {
+            bool result = true;
+            for (unsigned int i = 0; i < filter.k() && result; ++i) {
+                result = bits[(hash + i * (hash >> 32 | 1)) % bits.size()];
+            }
+            found += result;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+static void BM_BloomContains(benchmark::State& state) {
+    const auto                       n      = static_cast<std::size_t>(state.range(0));
+    const atom::bloom_filter_t       filter = make_filter(n);
+    const std::vector<std::uint64_t> keys   = make_hashes(1 << 16, n / 2);
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::uint64_t hash : keys) {
+            found += filter.contains(hash);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+static void BM_BloomContainsBatch(benchmark::State& state) {
+    const auto                       n      = static_cast<std::size_t>(state.range(0));
+    const atom::bloom_filter_t       filter = make_filter(n);
+    const std::vector<std::uint64_t> keys   = make_hashes(1 << 16, n / 2);
+    atom::vector_t<bool>             result;
+
+    for (auto _ : state) {
+        filter.contains(keys.data(), keys.size(), result);
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+static void BM_BloomInsert(benchmark::State& state) {
+    const auto                       n    = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::uint64_t> keys = make_hashes(n, 0);
+
+    for (auto _ : state) {
+        atom::bloom_filter_t filter = atom::bloom_filter_t::with_capacity(n, 0.01);
+        for (std::uint64_t hash : keys) {
+            filter.insert(hash);
+        }
+        benchmark::DoNotOptimize(filter.bits().data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(BM_ClassicContains)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK(BM_BloomContains)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK(BM_BloomContainsBatch)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK(BM_BloomInsert)->Arg(1 << 16)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
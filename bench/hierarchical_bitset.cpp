@@ -0,0 +1,69 @@
+#define ATOM_NDEBUG
+#include "hierarchical_bitset/hierarchical_bitset.h"
+#include "vector/vector.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+
+// Arg: one bit of state.range(0) is set on average
+static constexpr std::size_t COUNT_BITS = 1 << 24;
+
+static void BM_VectorBoolFindNext(benchmark::State& state) {
+    const auto           every = static_cast<std::size_t>(state.range(0));
+    atom::vector_t<bool> bits(COUNT_BITS, false);
+    std::mt19937_64      gen(1);
+
+    for (std::size_t i = 0; i < COUNT_BITS / every; ++i) {
+        bits.set(gen() % COUNT_BITS);
+    }
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::size_t pos = bits.find_first(); pos < bits.size(); pos = bits.find_next(pos)) {
+            ++found;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetBytesProcessed(state.iterations() * COUNT_BITS / 8);
+}
+
+static void BM_HierarchicalFindNext(benchmark::State& state) {
+    const auto                  every = static_cast<std::size_t>(state.range(0));
+    atom::hierarchical_bitset_t bits(COUNT_BITS);
+    std::mt19937_64             gen(1);
+
+    for (std::size_t i = 0; i < COUNT_BITS / every; ++i) {
+        bits.set(gen() % COUNT_BITS);
+    }
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::size_t pos = bits.find_first(); pos < bits.size(); pos = bits.find_next(pos)) {
+            ++found;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetBytesProcessed(state.iterations() * COUNT_BITS / 8);
+}
+
+static void BM_HierarchicalSetReset(benchmark::State& state) {
+    atom::hierarchical_bitset_t bits(COUNT_BITS);
+    std::mt19937_64             gen(1);
+
+    for (auto _ : state) {
+        const std::size_t pos = gen() % COUNT_BITS;
+        bits.set(pos);
+        bits.reset(pos);
+    }
+    benchmark::DoNotOptimize(bits.data());
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_VectorBoolFindNext)->Arg(64)->Arg(4096)->Arg(1 << 18);
+BENCHMARK(BM_HierarchicalFindNext)->Arg(64)->Arg(4096)->Arg(1 << 18);
+BENCHMARK(BM_HierarchicalSetReset);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,72 @@
+#define ATOM_NDEBUG
+#include "mpmc_queue/mpmc_queue.h"
+#include "vector/vector.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+// Args: count of the threads, each thread pushes one element and pops one element per operation,
+// so the queue never holds more elements than threads. Waiting yields, so 64 threads work on one core
+static constexpr std::size_t QUEUE_SIZE = 1024;
+
+// Mutex-guarded vector_t of the same capacity
+class locked_queue_t {
+public:
+    locked_queue_t() : mutex_(), items_(QUEUE_SIZE, 0), head_(0), tail_(0) {}
+
+    bool try_push(const std::uint64_t value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tail_ - head_ == QUEUE_SIZE) {
+            return false;
+        }
+        items_[tail_++ % QUEUE_SIZE] = value;
+        return true;
+    }
+
+    bool try_pop(std::uint64_t& value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tail_ == head_) {
+            return false;
+        }
+        value = items_[head_++ % QUEUE_SIZE];
+        return true;
+    }
+
+private:
+    std::mutex                    mutex_;
+    atom::vector_t<std::uint64_t> items_;
+    std::size_t                   head_;
+    std::size_t                   tail_;
+};
+
+template<typename Queue>
+static Queue& shared_queue() {
+    static Queue queue;
+    return queue;
+}
+
+template<typename Queue>
+static void BM_QueuePushPop(benchmark::State& state) {
+    Queue&        queue = shared_queue<Queue>();
+    std::uint64_t value = static_cast<std::uint64_t>(state.thread_index());
+    std::uint64_t sum   = 0;
+
+    for (auto _ : state) {
+        while (!queue.try_push(value)) {
+            std::this_thread::yield();
+        }
+        while (!queue.try_pop(value)) {
+            std::this_thread::yield();
+        }
+        sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_QueuePushPop, atom::mpmc_queue_t<std::uint64_t, QUEUE_SIZE>)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueuePushPop, locked_queue_t)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+#define ATOM_NDEBUG
+#include "packed_vector/packed_vector.h"
+#include "vector/vector.h"
+#include "simd/simd.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstring>
+
+static const std::size_t COUNT = 1 << 20;
+static const std::size_t CHUNK = 4096;
+
+static atom::packed_vector_t<> make_codes(const unsigned int width) {
+    atom::packed_vector_t<> codes(width);
+    unsigned int            seed = 1;
+
+    codes.reserve(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        codes.push_back((seed >> 8) & codes.max_value());
+    }
+    return codes;
+}
+
+// Args: width of the code, level of the kernel. Codes are unpacked in chunks of CHUNK fields
+static void BM_PackedUnpack(benchmark::State& state) {
+    const auto                    width = static_cast<unsigned int>(state.range(0));
+    const auto                    level = static_cast<atom::simd_level>(state.range(1));
+    const atom::packed_vector_t<> codes = make_codes(width);
+    atom::vector_t<std::uint32_t> out(CHUNK);
+
+    for (auto _ : state) {
+        for (std::size_t first = 0; first < COUNT; first += CHUNK) {
+            atom::simd_unpack_bits(out.data(), codes.data(), first, CHUNK, width, level);
+            benchmark::DoNotOptimize(out.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+    state.counters["bytes"] = static_cast<double>(codes.memory_usage());
+}
+
+// The same chunks copied from plain 32-bit codes
+static void BM_PlainCopy(benchmark::State& state) {
+    atom::vector_t<std::uint32_t> codes(COUNT);
+    atom::vector_t<std::uint32_t> out(CHUNK);
+
+    for (auto _ : state) {
+        for (std::size_t first = 0; first < COUNT; first += CHUNK) {
+            std::memcpy(out.data(), codes.data() + first, CHUNK * sizeof(std::uint32_t));
+            benchmark::DoNotOptimize(out.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+    state.counters["bytes"] = static_cast<double>(COUNT * sizeof(std::uint32_t));
+}
+
+static void BM_PackedGet(benchmark::State& state) {
+    const atom::packed_vector_t<> codes = make_codes(static_cast<unsigned int>(state.range(0)));
+
+    for (auto _ : state) {
+        std::uint32_t sum = 0;
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            sum += codes[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+
+static void BM_PackedStaticGet(benchmark::State& state) {
+    atom::packed_vector_t<11> codes;
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        codes.push_back(static_cast<std::uint32_t>(i % 2048));
+    }
+
+    for (auto _ : state) {
+        std::uint32_t sum = 0;
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            sum += codes[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+
+BENCHMARK(BM_PackedUnpack)->ArgsProduct({{3, 11, 20}, {0, 2, 3}});
+BENCHMARK(BM_PlainCopy);
+BENCHMARK(BM_PackedGet)->Arg(11);
+BENCHMARK(BM_PackedStaticGet);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,128 @@
+#define ATOM_NDEBUG
+#include "rank_select/rank_select.h"
+#include "vector/vector.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+//! @brief Presence bitmap where every bit is set with probability 1 / period
+//-----------------------------------------------------------------------------
+static atom::vector_t<bool> make_bitmap(const std::size_t count, const unsigned int period) {
+    atom::vector_t<bool> bits(count, false);
+
+    unsigned int seed = 12345;
+    for (std::size_t i = 0; i < count; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        if ((seed >> 8) % period == 0) {
+            bits.set(i);
+        }
+    }
+    return bits;
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Pseudo-random queries in [0, limit)
+//-----------------------------------------------------------------------------
+static std::vector<std::size_t> make_queries(const std::size_t limit) {
+    std::vector<std::size_t> queries(1024);
+
+    unsigned long long seed = 88172645463325252ull;
+    for (std::size_t& query : queries) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        query = static_cast<std::size_t>(seed % limit);
+    }
+    return queries;
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Baseline: rank as popcount of the prefix
+//-----------------------------------------------------------------------------
+static void BM_RankScan(benchmark::State& state) {
+    const auto                     count   = static_cast<std::size_t>(state.range(0));
+    const atom::vector_t<bool>     bits    = make_bitmap(count, 2);
+    const std::vector<std::size_t> queries = make_queries(count);
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const std::size_t pos  = queries[i++ % queries.size()];
+        std::size_t       rank = atom::simd_popcount(bits.data(), pos / atom::BIT_BLOCK_SIZE);
+        for (std::size_t bit = pos / atom::BIT_BLOCK_SIZE * atom::BIT_BLOCK_SIZE; bit < pos; ++bit) {
+            rank += bits[bit];
+        }
+        benchmark::DoNotOptimize(rank);
+    }
+}
+
+static void BM_Rank(benchmark::State& state) {
+    const auto                     count   = static_cast<std::size_t>(state.range(0));
+    const atom::vector_t<bool>     bits    = make_bitmap(count, 2);
+    const std::vector<std::size_t> queries = make_queries(count);
+    atom::rank_select_index<>      index(bits);
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.rank(queries[i++ % queries.size()]));
+    }
+
+    state.counters["overhead_percent"] = 100.0 * static_cast<double>(index.memory_usage() * 8) /
+                                         static_cast<double>(count);
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Baseline: select by the walk over the set bits
+//-----------------------------------------------------------------------------
+static void BM_SelectScan(benchmark::State& state) {
+    const auto                     count   = static_cast<std::size_t>(state.range(0));
+    const auto                     period  = static_cast<unsigned int>(state.range(1));
+    const atom::vector_t<bool>     bits    = make_bitmap(count, period);
+    const std::vector<std::size_t> queries = make_queries(bits.count());
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        std::size_t k   = queries[i++ % queries.size()];
+        std::size_t pos = bits.find_first();
+        for (; k; --k) {
+            pos = bits.find_next(pos);
+        }
+        benchmark::DoNotOptimize(pos);
+    }
+}
+
+static void BM_Select(benchmark::State& state) {
+    const auto                     count   = static_cast<std::size_t>(state.range(0));
+    const auto                     period  = static_cast<unsigned int>(state.range(1));
+    const atom::vector_t<bool>     bits    = make_bitmap(count, period);
+    const std::vector<std::size_t> queries = make_queries(bits.count());
+    atom::rank_select_index<>      index(bits);
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.select(queries[i++ % queries.size()]));
+    }
+
+    state.counters["overhead_percent"] = 100.0 * static_cast<double>(index.memory_usage() * 8) /
+                                         static_cast<double>(count);
+}
+
+static void BM_Build(benchmark::State& state) {
+    const auto                 count = static_cast<std::size_t>(state.range(0));
+    const atom::vector_t<bool> bits  = make_bitmap(count, 2);
+
+    for (auto _ : state) {
+        atom::rank_select_index<> index(bits);
+        benchmark::DoNotOptimize(index.count());
+    }
+
+    state.SetBytesProcessed(state.iterations() * count / 8);
+}
+
+// Scans are slow on 100M bits, they are measured on 1M bits
+BENCHMARK(BM_RankScan)->Arg(1 << 20);
+BENCHMARK(BM_Rank)->Arg(1 << 20)->Arg(100000000);
+BENCHMARK(BM_SelectScan)->Args({1 << 20, 2})->Args({1 << 20, 10000});
+BENCHMARK(BM_Select)->Args({1 << 20, 2})->Args({1 << 20, 10000})->Args({100000000, 2})->Args({100000000, 10000});
+BENCHMARK(BM_Build)->Arg(100000000);
+
+BENCHMARK_MAIN();
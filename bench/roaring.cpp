@@ -0,0 +1,116 @@
+#define ATOM_NDEBUG
+#include "roaring/roaring.h"
+#include "vector/vector.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+//-----------------------------------------------------------------------------
+//! @brief Dense bitmap where every bit is set with probability 1 / period
+//-----------------------------------------------------------------------------
+static atom::vector_t<bool> make_bits(const std::size_t count, const unsigned int period, unsigned int seed) {
+    atom::vector_t<bool> bits(count, false);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        if ((seed >> 8) % period == 0) {
+            bits.set(i);
+        }
+    }
+    return bits;
+}
+
+//-----------------------------------------------------------------------------
+//! @brief count ids spread over the whole 32-bit space
+//-----------------------------------------------------------------------------
+static atom::roaring_bitmap_t make_sparse(const std::size_t count, std::uint32_t seed) {
+    atom::roaring_bitmap_t bitmap;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        bitmap.set(seed);
+    }
+    return bitmap;
+}
+
+// Bits: 2^24, args: period of the set bits
+static void BM_VectorAnd(benchmark::State& state) {
+    const auto                 period = static_cast<unsigned int>(state.range(0));
+    const atom::vector_t<bool> lhs    = make_bits(1 << 24, period, 1);
+    const atom::vector_t<bool> rhs    = make_bits(1 << 24, period, 2);
+
+    for (auto _ : state) {
+        atom::vector_t<bool> result = lhs & rhs;
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    state.counters["bytes"] = static_cast<double>(lhs.capacity() / 8);
+}
+
+static void BM_RoaringAnd(benchmark::State& state) {
+    const auto                   period = static_cast<unsigned int>(state.range(0));
+    const atom::roaring_bitmap_t lhs(make_bits(1 << 24, period, 1));
+    const atom::roaring_bitmap_t rhs(make_bits(1 << 24, period, 2));
+
+    for (auto _ : state) {
+        atom::roaring_bitmap_t result = lhs & rhs;
+        benchmark::DoNotOptimize(&result);
+    }
+
+    state.counters["bytes"] = static_cast<double>(lhs.memory_usage());
+}
+
+static void BM_RoaringOr(benchmark::State& state) {
+    const auto                   period = static_cast<unsigned int>(state.range(0));
+    const atom::roaring_bitmap_t lhs(make_bits(1 << 24, period, 1));
+    const atom::roaring_bitmap_t rhs(make_bits(1 << 24, period, 2));
+
+    for (auto _ : state) {
+        atom::roaring_bitmap_t result = lhs | rhs;
+        benchmark::DoNotOptimize(&result);
+    }
+}
+
+static void BM_RoaringAndCount(benchmark::State& state) {
+    const auto                   period = static_cast<unsigned int>(state.range(0));
+    const atom::roaring_bitmap_t lhs(make_bits(1 << 24, period, 1));
+    const atom::roaring_bitmap_t rhs(make_bits(1 << 24, period, 2));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(and_count(lhs, rhs));
+    }
+}
+
+// Ids over 2^32, a dense vector would take 512 MB
+static void BM_RoaringSparseAnd(benchmark::State& state) {
+    const auto                   count = static_cast<std::size_t>(state.range(0));
+    const atom::roaring_bitmap_t lhs   = make_sparse(count, 1);
+    atom::roaring_bitmap_t       rhs   = make_sparse(count / 2, 1);
+    rhs |= make_sparse(count / 2, 2);
+
+    for (auto _ : state) {
+        atom::roaring_bitmap_t result = lhs & rhs;
+        benchmark::DoNotOptimize(&result);
+    }
+
+    state.counters["bytes"] = static_cast<double>(lhs.memory_usage());
+}
+
+static void BM_RoaringSet(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        atom::roaring_bitmap_t bitmap = make_sparse(count, 1);
+        benchmark::DoNotOptimize(&bitmap);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK(BM_VectorAnd)->Arg(2)->Arg(100)->Arg(10000);
+BENCHMARK(BM_RoaringAnd)->Arg(2)->Arg(100)->Arg(10000);
+BENCHMARK(BM_RoaringOr)->Arg(2)->Arg(100)->Arg(10000);
+BENCHMARK(BM_RoaringAndCount)->Arg(2)->Arg(100)->Arg(10000);
+BENCHMARK(BM_RoaringSparseAnd)->Arg(5000)->Arg(100000);
+BENCHMARK(BM_RoaringSet)->Arg(5000)->Arg(100000);
+
+BENCHMARK_MAIN();
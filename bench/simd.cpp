@@ -0,0 +1,271 @@
+#define ATOM_NDEBUG
+#include "simd/simd.h"
+#include "vector/vector.h"
+#include "vector/vector_bool.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+//! @brief Vector of count pseudo-random values in [-1000, 1000)
+//-----------------------------------------------------------------------------
+template<typename Tp>
+static atom::vector_t<Tp> make_data(const std::size_t count) {
+    atom::vector_t<Tp> data;
+    data.reserve(count);
+
+    unsigned int seed = 12345;
+    for (std::size_t i = 0; i < count; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        data.push_back(static_cast<Tp>(static_cast<int>(seed >> 16) % 2000 - 1000));
+    }
+    return data;
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Baseline: the loop over va_iterator which was used before the kernels
+//-----------------------------------------------------------------------------
+template<typename Tp>
+static void BM_IteratorSum(benchmark::State& state) {
+    const auto         count = static_cast<std::size_t>(state.range(0));
+    atom::vector_t<Tp> data  = make_data<Tp>(count);
+
+    for (auto _ : state) {
+        atom::simd_sum_t<Tp> sum = 0;
+        for (auto it = data.cbegin(); it != data.cend(); ++it) {
+            sum += *it;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetBytesProcessed(state.iterations() * count * sizeof(Tp));
+}
+
+template<typename Tp, atom::simd_level level>
+static void BM_Find(benchmark::State& state) {
+    const auto         count = static_cast<std::size_t>(state.range(0));
+    atom::vector_t<Tp> data  = make_data<Tp>(count);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(atom::simd_find(&data[0], count, static_cast<Tp>(5000), level));
+    }
+
+    state.SetBytesProcessed(state.iterations() * count * sizeof(Tp));
+}
+
+template<typename Tp, atom::simd_level level>
+static void BM_Count(benchmark::State& state) {
+    const auto         count = static_cast<std::size_t>(state.range(0));
+    atom::vector_t<Tp> data  = make_data<Tp>(count);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(atom::simd_count(&data[0], count, static_cast<Tp>(7), level));
+    }
+
+    state.SetBytesProcessed(state.iterations() * count * sizeof(Tp));
+}
+
+template<typename Tp, atom::simd_level level>
+static void BM_MinMax(benchmark::State& state) {
+    const auto         count = static_cast<std::size_t>(state.range(0));
+    atom::vector_t<Tp> data  = make_data<Tp>(count);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(atom::simd_min(&data[0], count, level));
+        benchmark::DoNotOptimize(atom::simd_max(&data[0], count, level));
+    }
+
+    state.SetBytesProcessed(state.iterations() * 2 * count * sizeof(Tp));
+}
+
+template<typename Tp, atom::simd_level level>
+static void BM_Sum(benchmark::State& state) {
+    const auto         count = static_cast<std::size_t>(state.range(0));
+    atom::vector_t<Tp> data  = make_data<Tp>(count);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(atom::simd_sum(&data[0], count, level));
+    }
+
+    state.SetBytesProcessed(state.iterations() * count * sizeof(Tp));
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Words of count bits where about a half of bits is set
+//-----------------------------------------------------------------------------
+static std::vector<atom::bit_container_type> make_words(const std::size_t count) {
+    std::vector<atom::bit_container_type> words(count / atom::BIT_BLOCK_SIZE);
+
+    unsigned long long seed = 88172645463325252ull;
+    for (atom::bit_container_type& word : words) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        word  = seed;
+    }
+    return words;
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Mask of count bits where about a half of bits is set
+//-----------------------------------------------------------------------------
+static atom::vector_t<bool> make_mask(const std::size_t count) {
+    atom::vector_t<bool> mask(count, false);
+
+    unsigned int seed = 12345;
+    for (std::size_t i = 0; i < count; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        if (seed & (1u << 16)) {
+            mask.set(i);
+        }
+    }
+    return mask;
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Baseline: bit by bit loop which was used by count() before popcount
+//-----------------------------------------------------------------------------
+static void BM_BitLoopCount(benchmark::State& state) {
+    const auto           count = static_cast<std::size_t>(state.range(0));
+    const auto           words = make_words(count);
+
+    for (auto _ : state) {
+        std::size_t result = 0;
+        for (const atom::bit_container_type word : words) {
+            for (atom::bit_container_type block = word; block; block >>= 1) {
+                result += block & 1;
+            }
+        }
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.counters["bits_per_second"] = benchmark::Counter(static_cast<double>(state.iterations() * count),
+                                                           benchmark::Counter::kIsRate);
+}
+
+template<atom::simd_level level>
+static void BM_Popcount(benchmark::State& state) {
+    const auto           count = static_cast<std::size_t>(state.range(0));
+    const auto           words = make_words(count);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(atom::simd_popcount(words.data(), words.size(), level));
+    }
+
+    state.counters["bits_per_second"] = benchmark::Counter(static_cast<double>(state.iterations() * count),
+                                                           benchmark::Counter::kIsRate);
+}
+
+static void BM_VectorBoolCount(benchmark::State& state) {
+    const auto           count = static_cast<std::size_t>(state.range(0));
+    atom::vector_t<bool> mask  = make_mask(count);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mask.count());
+    }
+
+    state.counters["bits_per_second"] = benchmark::Counter(static_cast<double>(state.iterations() * count),
+                                                           benchmark::Counter::kIsRate);
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Baseline: intersection of two masks bit by bit through operator[]
+//-----------------------------------------------------------------------------
+static void BM_BitLoopAnd(benchmark::State& state) {
+    const auto           count = static_cast<std::size_t>(state.range(0));
+    atom::vector_t<bool> lhs   = make_mask(count);
+    atom::vector_t<bool> rhs   = make_mask(count);
+    atom::vector_t<bool> out(count, false);
+    rhs.invert();
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = lhs[i] && rhs[i];
+        }
+        benchmark::DoNotOptimize(out);
+    }
+
+    state.counters["bits_per_second"] = benchmark::Counter(static_cast<double>(state.iterations() * count),
+                                                           benchmark::Counter::kIsRate);
+}
+
+static void BM_VectorBoolAnd(benchmark::State& state) {
+    const auto           count = static_cast<std::size_t>(state.range(0));
+    atom::vector_t<bool> lhs   = make_mask(count);
+    atom::vector_t<bool> rhs   = make_mask(count);
+    rhs.invert();
+
+    for (auto _ : state) {
+        lhs &= rhs;
+        benchmark::DoNotOptimize(lhs);
+    }
+
+    state.counters["bits_per_second"] = benchmark::Counter(static_cast<double>(state.iterations() * count),
+                                                           benchmark::Counter::kIsRate);
+}
+
+static void BM_VectorBoolAndCount(benchmark::State& state) {
+    const auto           count = static_cast<std::size_t>(state.range(0));
+    atom::vector_t<bool> lhs   = make_mask(count);
+    atom::vector_t<bool> rhs   = make_mask(count);
+    rhs.invert();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(and_count(lhs, rhs));
+    }
+
+    state.counters["bits_per_second"] = benchmark::Counter(static_cast<double>(state.iterations() * count),
+                                                           benchmark::Counter::kIsRate);
+}
+
+template<atom::simd_level level>
+static void BM_BitCombine(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto       lhs   = make_words(count);
+    const auto rhs   = make_words(count);
+
+    for (auto _ : state) {
+        atom::simd_bit_combine(lhs.data(), lhs.data(), rhs.data(), lhs.size(), atom::simd_bit_op::xor_, level);
+        benchmark::DoNotOptimize(lhs.data());
+    }
+
+    state.counters["bits_per_second"] = benchmark::Counter(static_cast<double>(state.iterations() * count),
+                                                           benchmark::Counter::kIsRate);
+}
+
+// 16K elements stay in L1/L2, 4M elements are limited by memory bandwidth
+#define ATOM_BENCH_LEVELS(name, type)                                                   \
+    BENCHMARK_TEMPLATE(name, type, atom::simd_level::scalar)->Arg(1 << 14)->Arg(1 << 22); \
+    BENCHMARK_TEMPLATE(name, type, atom::simd_level::sse2)->Arg(1 << 14)->Arg(1 << 22);   \
+    BENCHMARK_TEMPLATE(name, type, atom::simd_level::avx2)->Arg(1 << 14)->Arg(1 << 22);   \
+    BENCHMARK_TEMPLATE(name, type, atom::simd_level::avx512)->Arg(1 << 14)->Arg(1 << 22)
+
+BENCHMARK_TEMPLATE(BM_IteratorSum, std::int32_t)->Arg(1 << 14)->Arg(1 << 22);
+BENCHMARK_TEMPLATE(BM_IteratorSum, float)->Arg(1 << 14)->Arg(1 << 22);
+
+ATOM_BENCH_LEVELS(BM_Find, std::int32_t);
+ATOM_BENCH_LEVELS(BM_Find, float);
+ATOM_BENCH_LEVELS(BM_Count, std::int32_t);
+ATOM_BENCH_LEVELS(BM_Count, float);
+ATOM_BENCH_LEVELS(BM_MinMax, std::int32_t);
+ATOM_BENCH_LEVELS(BM_MinMax, float);
+ATOM_BENCH_LEVELS(BM_Sum, std::int32_t);
+ATOM_BENCH_LEVELS(BM_Sum, float);
+
+// 64K bits stay in L1, 100M bits (12.5 MB) is a visibility mask from memory
+BENCHMARK(BM_BitLoopCount)->Arg(1 << 16)->Arg(100000000);
+BENCHMARK_TEMPLATE(BM_Popcount, atom::simd_level::scalar)->Arg(1 << 16)->Arg(100000000);
+BENCHMARK_TEMPLATE(BM_Popcount, atom::simd_level::sse2)->Arg(1 << 16)->Arg(100000000);
+BENCHMARK_TEMPLATE(BM_Popcount, atom::simd_level::avx2)->Arg(1 << 16)->Arg(100000000);
+BENCHMARK_TEMPLATE(BM_Popcount, atom::simd_level::avx512)->Arg(1 << 16)->Arg(100000000);
+BENCHMARK(BM_VectorBoolCount)->Arg(1 << 16)->Arg(100000000);
+
+BENCHMARK(BM_BitLoopAnd)->Arg(1 << 16)->Arg(100000000);
+BENCHMARK(BM_VectorBoolAnd)->Arg(1 << 16)->Arg(100000000);
+BENCHMARK(BM_VectorBoolAndCount)->Arg(1 << 16)->Arg(100000000);
+BENCHMARK_TEMPLATE(BM_BitCombine, atom::simd_level::scalar)->Arg(1 << 16)->Arg(100000000);
+BENCHMARK_TEMPLATE(BM_BitCombine, atom::simd_level::sse2)->Arg(1 << 16)->Arg(100000000);
+BENCHMARK_TEMPLATE(BM_BitCombine, atom::simd_level::avx2)->Arg(1 << 16)->Arg(100000000);
+BENCHMARK_TEMPLATE(BM_BitCombine, atom::simd_level::avx512)->Arg(1 << 16)->Arg(100000000);
+
+BENCHMARK_MAIN();
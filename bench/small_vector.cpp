@@ -0,0 +1,86 @@
+#define ATOM_NDEBUG
+#include "small_vector/small_vector.h"
+#include "vector/vector.h"
+#include "array/array.h"
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+//! @brief Builds one message of count items, as it is done for each request
+//-----------------------------------------------------------------------------
+template<typename Container>
+static void BM_Message(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        Container container;
+        for (int i = 0; i < count; ++i) {
+            container.push_back(i);
+        }
+        benchmark::DoNotOptimize(container.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Messages of 1..8 items with a message of 2000 items once per 256 messages
+//-----------------------------------------------------------------------------
+template<typename Container>
+static void BM_MixedMessages(benchmark::State& state) {
+    std::vector<int> sizes(256);
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        sizes[i] = 1 + static_cast<int>(i * 7 % 8);
+    }
+    sizes[100] = 2000;
+
+    long long items = 0;
+
+    for (auto _ : state) {
+        for (const int count : sizes) {
+            Container container;
+            for (int i = 0; i < count; ++i) {
+                container.push_back(i);
+            }
+            benchmark::DoNotOptimize(container.size());
+            items += count;
+        }
+    }
+
+    state.SetItemsProcessed(items);
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Messages of strings, element moves are visible on spill
+//-----------------------------------------------------------------------------
+template<typename Container>
+static void BM_StringMessage(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    const std::string item("message item");
+
+    for (auto _ : state) {
+        Container container;
+        for (int i = 0; i < count; ++i) {
+            container.push_back(item);
+        }
+        benchmark::DoNotOptimize(container.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_TEMPLATE(BM_Message, atom::small_vector_t<int, 8>)->DenseRange(2, 8, 3)->Arg(64);
+BENCHMARK_TEMPLATE(BM_Message, atom::vector_t<int>)->DenseRange(2, 8, 3)->Arg(64);
+BENCHMARK_TEMPLATE(BM_Message, atom::array_t<int, 64>)->DenseRange(2, 8, 3)->Arg(64);
+BENCHMARK_TEMPLATE(BM_Message, std::vector<int>)->DenseRange(2, 8, 3)->Arg(64);
+
+BENCHMARK_TEMPLATE(BM_MixedMessages, atom::small_vector_t<int, 8>);
+BENCHMARK_TEMPLATE(BM_MixedMessages, atom::vector_t<int>);
+BENCHMARK_TEMPLATE(BM_MixedMessages, atom::array_t<int, 2048>);
+
+BENCHMARK_TEMPLATE(BM_StringMessage, atom::small_vector_t<std::string, 8>)->Arg(4)->Arg(32);
+BENCHMARK_TEMPLATE(BM_StringMessage, atom::vector_t<std::string>)->Arg(4)->Arg(32);
+BENCHMARK_TEMPLATE(BM_StringMessage, atom::array_t<std::string, 32>)->Arg(4)->Arg(32);
+
+BENCHMARK_MAIN();
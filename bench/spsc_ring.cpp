@@ -0,0 +1,179 @@
+#define ATOM_NDEBUG
+#include "spsc_ring/spsc_ring.h"
+#include "vector/vector.h"
+#include <benchmark/benchmark.h>
+#include <pthread.h>
+#include <sched.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// Producer is the benchmark thread, consumer is started for each run, both are pinned
+// to their own cores when there are two of them. Waiting yields, so one core still works
+static constexpr std::size_t RING_SIZE = 1024;
+static constexpr std::size_t BATCH     = 64;
+
+static void pin_thread(const unsigned int cpu) {
+    const unsigned int count_cpus = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t          set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu % count_cpus, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+// Mutex-guarded vector_t of the same capacity
+class locked_ring_t {
+public:
+    locked_ring_t() : mutex_(), items_(RING_SIZE, 0), head_(0), tail_(0) {}
+
+    bool try_push(const std::uint64_t value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tail_ - head_ == RING_SIZE) {
+            return false;
+        }
+        items_[tail_++ % RING_SIZE] = value;
+        return true;
+    }
+
+    bool try_pop(std::uint64_t& value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tail_ == head_) {
+            return false;
+        }
+        value = items_[head_++ % RING_SIZE];
+        return true;
+    }
+
+private:
+    std::mutex                    mutex_;
+    atom::vector_t<std::uint64_t> items_;
+    std::size_t                   head_;
+    std::size_t                   tail_;
+};
+
+template<typename Ring>
+static void BM_RingThroughput(benchmark::State& state) {
+    auto               ring = std::make_unique<Ring>();
+    std::atomic<bool>  done(false);
+    std::uint64_t      sum  = 0;
+
+    pin_thread(0);
+    std::thread consumer([&]() {
+        pin_thread(1);
+        std::uint64_t value = 0;
+        while (!done.load(std::memory_order_relaxed)) {
+            while (ring->try_pop(value)) {
+                sum += value;
+            }
+            std::this_thread::yield();
+        }
+        while (ring->try_pop(value)) {
+            sum += value;
+        }
+    });
+
+    std::uint64_t next = 0;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < BATCH; ++i, ++next) {
+            while (!ring->try_push(next)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    done.store(true);
+    consumer.join();
+    benchmark::DoNotOptimize(sum);
+
+    state.SetItemsProcessed(state.iterations() * BATCH);
+}
+
+static void BM_SpscBatchThroughput(benchmark::State& state) {
+    auto              ring = std::make_unique<atom::spsc_ring_t<std::uint64_t, RING_SIZE> >();
+    std::atomic<bool> done(false);
+    std::uint64_t     sum  = 0;
+
+    pin_thread(0);
+    std::thread consumer([&]() {
+        pin_thread(1);
+        std::uint64_t batch[BATCH];
+        std::size_t   n = 0;
+        while (!done.load(std::memory_order_relaxed)) {
+            while ((n = ring->pop_n(batch, BATCH))) {
+                sum += batch[n - 1];
+            }
+            std::this_thread::yield();
+        }
+        while ((n = ring->pop_n(batch, BATCH))) {
+            sum += batch[n - 1];
+        }
+    });
+
+    std::uint64_t batch[BATCH];
+    std::uint64_t next = 0;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < BATCH; ++i) {
+            batch[i] = next++;
+        }
+        for (std::size_t pushed = 0; pushed < BATCH;) {
+            pushed += ring->push_n(batch + pushed, BATCH - pushed);
+            if (pushed < BATCH) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    done.store(true);
+    consumer.join();
+    benchmark::DoNotOptimize(sum);
+
+    state.SetItemsProcessed(state.iterations() * BATCH);
+}
+
+// Round trip of one message: ping goes to the echo thread, it sends it back
+static void BM_SpscPingPong(benchmark::State& state) {
+    using ring_type = atom::spsc_ring_t<std::uint64_t, 8>;
+
+    auto              ping = std::make_unique<ring_type>();
+    auto              pong = std::make_unique<ring_type>();
+    std::atomic<bool> done(false);
+
+    pin_thread(0);
+    std::thread echo([&]() {
+        pin_thread(1);
+        std::uint64_t value = 0;
+        while (!done.load(std::memory_order_relaxed)) {
+            if (ping->try_pop(value)) {
+                while (!pong->try_push(value)) {
+                    std::this_thread::yield();
+                }
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::uint64_t value = 0;
+    for (auto _ : state) {
+        ping->try_push(value);
+        while (!pong->try_pop(value)) {
+            std::this_thread::yield();
+        }
+        ++value;
+    }
+
+    done.store(true);
+    echo.join();
+}
+
+BENCHMARK_TEMPLATE(BM_RingThroughput, atom::spsc_ring_t<std::uint64_t, RING_SIZE>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingThroughput, locked_ring_t)->UseRealTime();
+BENCHMARK(BM_SpscBatchThroughput)->UseRealTime();
+BENCHMARK(BM_SpscPingPong)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,311 @@
+#define ATOM_NDEBUG
+#include "vector/vector.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+
+    //-----------------------------------------------------------------------------
+    //! @brief Element with non-trivial constructors and its own heap memory
+    //-----------------------------------------------------------------------------
+    struct heavy_t {
+        std::string      name;
+        std::vector<int> payload;
+
+        heavy_t() :
+            name   ("default heavy element with long name"),
+            payload(16) {
+        }
+
+        explicit heavy_t(int x) :
+            name   ("heavy element with long name #" + std::to_string(x)),
+            payload(16, x) {
+        }
+    };
+
+}
+
+template<typename Container>
+static void BM_PushBackHeavy(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        Container container;
+        for (int i = 0; i < count; ++i) {
+            container.push_back(heavy_t(i));
+        }
+        benchmark::DoNotOptimize(container.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template<typename Container>
+static void BM_ReserveHeavy(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Container container;
+        container.reserve(count);
+        container.push_back(heavy_t(1));
+        benchmark::DoNotOptimize(container.size());
+    }
+}
+
+template<typename Container>
+static void BM_PushBackDouble(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Container container;
+        for (std::size_t i = 0; i < count; ++i) {
+            container.push_back(static_cast<double>(i));
+        }
+        benchmark::DoNotOptimize(container.size());
+    }
+
+    state.SetBytesProcessed(state.iterations() * count * sizeof(double));
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Batches of 256 integers are ingested by push_back() or by append()
+//-----------------------------------------------------------------------------
+static void BM_IngestPushBack(benchmark::State& state) {
+    const auto       count = static_cast<std::size_t>(state.range(0));
+    std::vector<int> batch(256, 1);
+
+    for (auto _ : state) {
+        atom::vector_t<int> container;
+        for (std::size_t i = 0; i < count; i += batch.size()) {
+            for (const int x : batch) {
+                container.push_back(x);
+            }
+        }
+        benchmark::DoNotOptimize(container.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_IngestAppend(benchmark::State& state) {
+    const auto       count = static_cast<std::size_t>(state.range(0));
+    std::vector<int> batch(256, 1);
+
+    for (auto _ : state) {
+        atom::vector_t<int> container;
+        for (std::size_t i = 0; i < count; i += batch.size()) {
+            container.append(batch.data(), batch.size());
+        }
+        benchmark::DoNotOptimize(container.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Removes the first 64 elements until the vector is empty
+//-----------------------------------------------------------------------------
+static void BM_EraseFrontRange(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        atom::vector_t<int> container(count, 1);
+        while (container.erase(0, 64)) {
+        }
+        benchmark::DoNotOptimize(container.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Removes about half of the random integers by erase_if() or by erase-remove idiom
+//-----------------------------------------------------------------------------
+template<typename Container>
+static void BM_EraseIfRandom(benchmark::State& state) {
+    const auto       count = static_cast<std::size_t>(state.range(0));
+    std::vector<int> source(count);
+
+    unsigned int seed = 12345;
+    for (int& x : source) {
+        seed = seed * 1103515245u + 12345u;
+        x    = static_cast<int>(seed >> 16);
+    }
+
+    const auto is_odd = [](int x) { return (x & 1) != 0; };
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Container container;
+        container.assign(source.begin(), source.end());
+        state.ResumeTiming();
+
+        if constexpr (std::is_same<Container, std::vector<int> >::value) {
+            container.erase(std::remove_if(container.begin(), container.end(), is_odd), container.end());
+        }
+        else {
+            container.erase_if(is_odd);
+        }
+        benchmark::DoNotOptimize(container.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Mask where every 10000-th bit is set
+//-----------------------------------------------------------------------------
+static atom::vector_t<bool> make_sparse_mask(const std::size_t count) {
+    atom::vector_t<bool> mask(count, false);
+    for (std::size_t i = 0; i < count; i += 10000) {
+        mask.set(i);
+    }
+    return mask;
+}
+
+static void BM_SparseVisitIndex(benchmark::State& state) {
+    const auto                 count = static_cast<std::size_t>(state.range(0));
+    const atom::vector_t<bool> mask  = make_sparse_mask(count);
+
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (mask[i]) {
+                sum += i;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_SparseVisitForEach(benchmark::State& state) {
+    const auto                 count = static_cast<std::size_t>(state.range(0));
+    const atom::vector_t<bool> mask  = make_sparse_mask(count);
+
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        mask.for_each_set([&sum](std::size_t pos) { sum += pos; });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_SparseVisitRange(benchmark::State& state) {
+    const auto                 count = static_cast<std::size_t>(state.range(0));
+    const atom::vector_t<bool> mask  = make_sparse_mask(count);
+
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        for (std::size_t pos : mask.set_bits()) {
+            sum += pos;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Erase of one bit from the middle and insert of it back, the tail is shifted twice
+//-----------------------------------------------------------------------------
+template<typename BitVector>
+static void BM_BoolEraseInsertMiddle(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    BitVector  bits(count, false);
+    for (std::size_t i = 0; i < count; i += 3) {
+        bits[i] = true;
+    }
+
+    for (auto _ : state) {
+        bits.erase(bits.begin() + count / 2 + 1);
+        bits.insert(bits.begin() + count / 3 + 1, true);
+        benchmark::DoNotOptimize(&bits);
+    }
+
+    state.SetBytesProcessed(state.iterations() * count / 8);
+}
+
+template<>
+void BM_BoolEraseInsertMiddle<atom::vector_t<bool> >(benchmark::State& state) {
+    const auto           count = static_cast<std::size_t>(state.range(0));
+    atom::vector_t<bool> bits(count, false);
+    for (std::size_t i = 0; i < count; i += 3) {
+        bits.set(i);
+    }
+
+    for (auto _ : state) {
+        bits.erase(count / 2 + 1);
+        bits.insert(count / 3 + 1, true);
+        benchmark::DoNotOptimize(bits.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * count / 8);
+}
+
+//-----------------------------------------------------------------------------
+//! @brief Concatenation of windows at odd offsets, every copy is shifted in the blocks
+//-----------------------------------------------------------------------------
+template<typename BitVector>
+static void BM_BoolSpliceWindows(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    BitVector  bits(count, false);
+    for (std::size_t i = 0; i < count; i += 3) {
+        bits[i] = true;
+    }
+
+    for (auto _ : state) {
+        BitVector result;
+        for (std::size_t from = 1; from + count / 4 <= count; from += count / 4 - 7) {
+            result.insert(result.end(), bits.begin() + from, bits.begin() + from + count / 4 - 3);
+        }
+        benchmark::DoNotOptimize(&result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * count / 8);
+}
+
+template<>
+void BM_BoolSpliceWindows<atom::vector_t<bool> >(benchmark::State& state) {
+    const auto           count = static_cast<std::size_t>(state.range(0));
+    atom::vector_t<bool> bits(count, false);
+    for (std::size_t i = 0; i < count; i += 3) {
+        bits.set(i);
+    }
+
+    for (auto _ : state) {
+        atom::vector_t<bool> result;
+        for (std::size_t from = 1; from + count / 4 <= count; from += count / 4 - 7) {
+            result.append(bits.subvector(from, count / 4 - 3));
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * count / 8);
+}
+
+BENCHMARK_TEMPLATE(BM_PushBackHeavy, atom::vector_t<heavy_t>)->Range(8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_PushBackHeavy, std::vector<heavy_t>)->Range(8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_ReserveHeavy, atom::vector_t<heavy_t>)->Range(8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_ReserveHeavy, std::vector<heavy_t>)->Range(8, 1 << 14);
+
+BENCHMARK_TEMPLATE(BM_PushBackDouble, atom::vector_t<double>)->Range(1 << 10, 1 << 25);
+BENCHMARK_TEMPLATE(BM_PushBackDouble, atom::vector_t<double, std::allocator<double> >)->Range(1 << 10, 1 << 25);
+BENCHMARK_TEMPLATE(BM_PushBackDouble, std::vector<double>)->Range(1 << 10, 1 << 25);
+
+BENCHMARK(BM_IngestPushBack)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_IngestAppend)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_EraseFrontRange)->Range(1 << 10, 1 << 16);
+
+BENCHMARK_TEMPLATE(BM_EraseIfRandom, atom::vector_t<int>)->Range(1 << 12, 1 << 18);
+BENCHMARK_TEMPLATE(BM_EraseIfRandom, std::vector<int>)->Range(1 << 12, 1 << 18);
+
+BENCHMARK(BM_SparseVisitIndex)->Range(1 << 16, 1 << 24);
+BENCHMARK(BM_SparseVisitForEach)->Range(1 << 16, 1 << 24);
+BENCHMARK(BM_SparseVisitRange)->Range(1 << 16, 1 << 24);
+
+BENCHMARK_TEMPLATE(BM_BoolEraseInsertMiddle, atom::vector_t<bool>)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(BM_BoolEraseInsertMiddle, std::vector<bool>)->Range(1 << 12, 1 << 24);
+
+BENCHMARK_TEMPLATE(BM_BoolSpliceWindows, atom::vector_t<bool>)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(BM_BoolSpliceWindows, std::vector<bool>)->Range(1 << 12, 1 << 24);
+
+BENCHMARK_MAIN();
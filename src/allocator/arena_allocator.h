@@ -0,0 +1,298 @@
+//-----------------------------------------------------------------------------
+//! @file arena_allocator.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Implements a bump-pointer arena and an allocator on top of it
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_ARENA_ALLOCATOR_H
+#define ATOM_ARENA_ALLOCATOR_H 1
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include "exceptions.h"
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @class arena_t
+    //! @brief Bump-pointer memory arena
+    //! @details Memory is taken from a list of blocks, each allocation only moves the pointer.
+    //! @details Single deallocation returns memory only if it was the last allocation,
+    //! @details everything else is returned at once by reset() or release().
+    //! @details Arena is not thread-safe and must outlive all the allocators which use it.
+    //-----------------------------------------------------------------------------
+    class arena_t {
+    public:
+
+        using size_type = std::size_t; //!< Size type
+
+        static constexpr size_type DEFAULT_BLOCK_SIZE = 64 * 1024; //!< Size of the block by default
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @details Memory is not allocated until the first allocate()
+        //! @param block_size The size of the blocks in bytes
+        //-----------------------------------------------------------------------------
+        explicit arena_t(const size_type block_size = DEFAULT_BLOCK_SIZE) noexcept :
+            head_      (nullptr),
+            cur_       (nullptr),
+            end_       (nullptr),
+            block_size_(block_size) {
+        }
+
+        arena_t(const arena_t&) = delete;
+        arena_t& operator=(const arena_t&) = delete;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Destructor
+        //! @details Frees all the blocks
+        //-----------------------------------------------------------------------------
+        ~arena_t() {
+            release();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Allocate memory
+        //! @param bytes The number of bytes
+        //! @param align The alignment, must be a power of two
+        //! @throw atom::invalidArgument When align is not a power of two
+        //! @throw atom::badAlloc When memory is not allocated
+        //! @return Pointer to the memory
+        //-----------------------------------------------------------------------------
+        void* allocate(const size_type bytes, const size_type align = alignof(std::max_align_t));
+
+        //-----------------------------------------------------------------------------
+        //! @brief Deallocate memory
+        //! @details Memory is returned to the arena only if it was the last allocation
+        //! @param ptr Pointer returned by allocate()
+        //! @param bytes The number of bytes which was passed to allocate()
+        //-----------------------------------------------------------------------------
+        void deallocate(void* ptr, const size_type bytes) noexcept {
+            char* const first = static_cast<char*>(ptr);
+
+            if (first && first + bytes == cur_) {
+                cur_ = first;
+            }
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Free all the allocations
+        //! @details The last block is kept and reused, other blocks are freed
+        //-----------------------------------------------------------------------------
+        void reset() noexcept;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Free all the allocations and all the blocks
+        //-----------------------------------------------------------------------------
+        void release() noexcept;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Block size
+        //! @return The size of the blocks in bytes
+        //-----------------------------------------------------------------------------
+        size_type block_size() const noexcept {
+            return block_size_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Free memory
+        //! @return The number of bytes which are left in the current block
+        //-----------------------------------------------------------------------------
+        size_type available() const noexcept {
+            return end_ - cur_;
+        }
+
+    private:
+
+        //-----------------------------------------------------------------------------
+        //! @brief Header of the block, the memory of the block follows it
+        //-----------------------------------------------------------------------------
+        struct alignas(std::max_align_t) block_t {
+            block_t*  next; //!< Previous allocated block
+            size_type size; //!< Size of the memory after header
+        };
+
+        block_t*  head_;       //!< Last allocated block
+        char*     cur_;        //!< First free byte in the current block
+        char*     end_;        //!< End of the current block
+        size_type block_size_; //!< Size of the blocks
+
+        static char* memory(block_t* block) noexcept {
+            return reinterpret_cast<char*>(block + 1);
+        }
+
+        static char* align_up(char* ptr, const size_type align) noexcept {
+            const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(ptr);
+            return ptr + ((align - address % align) % align);
+        }
+
+        void new_block(const size_type min_size);
+    };
+
+    inline void* arena_t::allocate(const size_type bytes, const size_type align) {
+        ATOM_INVALID_ARGUMENT(!align || (align & (align - 1)));
+
+        char* first = align_up(cur_, align);
+
+        if (!cur_ || first > end_ || static_cast<size_type>(end_ - first) < bytes) {
+            ATOM_BAD_ALLOC(bytes > std::numeric_limits<size_type>::max() - align - sizeof(block_t));
+
+            new_block(bytes + align);
+            first = align_up(cur_, align);
+        }
+
+        cur_ = first + bytes;
+
+        return first;
+    }
+
+    inline void arena_t::reset() noexcept {
+        if (!head_) {
+            return;
+        }
+
+        block_t* block = head_->next;
+        while (block) {
+            block_t* next = block->next;
+            ::operator delete(block);
+            block = next;
+        }
+
+        head_->next = nullptr;
+        cur_        = memory(head_);
+        end_        = cur_ + head_->size;
+    }
+
+    inline void arena_t::release() noexcept {
+        while (head_) {
+            block_t* next = head_->next;
+            ::operator delete(head_);
+            head_ = next;
+        }
+
+        cur_ = nullptr;
+        end_ = nullptr;
+    }
+
+    inline void arena_t::new_block(const size_type min_size) {
+        const size_type size = min_size > block_size_ ? min_size : block_size_;
+
+        void* raw = ::operator new(sizeof(block_t) + size, std::nothrow);
+        ATOM_BAD_ALLOC(!raw);
+
+        block_t* block = static_cast<block_t*>(raw);
+        block->next = head_;
+        block->size = size;
+
+        head_ = block;
+        cur_  = memory(block);
+        end_  = cur_ + size;
+    }
+
+
+    //-----------------------------------------------------------------------------
+    //! @class arena_allocator
+    //! @brief Allocator which takes memory from atom::arena_t
+    //! @details Allocator is propagated on copy, move and swap of the container,
+    //! @details so containers which use the same arena can exchange memory.
+    //! @tparam Tp The type of the allocated values
+    //-----------------------------------------------------------------------------
+    template<typename Tp>
+    class arena_allocator {
+    public:
+
+        using value_type = Tp;          //!< Element type
+        using size_type  = std::size_t; //!< Size type
+
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap            = std::true_type;
+        using is_always_equal                        = std::false_type;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @param arena The source of the memory
+        //-----------------------------------------------------------------------------
+        explicit arena_allocator(arena_t& arena) noexcept :
+            arena_(&arena) {
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Converting constructor
+        //! @param that Allocator of the other type
+        //-----------------------------------------------------------------------------
+        template<typename Up>
+        arena_allocator(const arena_allocator<Up>& that) noexcept :
+            arena_(that.arena()) {
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Allocate memory
+        //! @param n The number of elements
+        //! @throws The same exceptions as the function arena_t::allocate()
+        //! @return Pointer to the memory for n elements
+        //-----------------------------------------------------------------------------
+        value_type* allocate(const size_type n) {
+            ATOM_BAD_ALLOC(n > max_size());
+
+            return static_cast<value_type*>(arena_->allocate(n * sizeof(value_type), alignof(value_type)));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Deallocate memory
+        //! @param ptr Pointer returned by allocate()
+        //! @param n The number of elements which was passed to allocate()
+        //-----------------------------------------------------------------------------
+        void deallocate(value_type* ptr, const size_type n) noexcept {
+            arena_->deallocate(ptr, n * sizeof(value_type));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Max size
+        //! @return The max number of elements which can be allocated
+        //-----------------------------------------------------------------------------
+        size_type max_size() const noexcept {
+            return std::numeric_limits<size_type>::max() / sizeof(value_type);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Arena
+        //! @return Pointer to the arena of the allocator
+        //-----------------------------------------------------------------------------
+        arena_t* arena() const noexcept {
+            return arena_;
+        }
+
+    private:
+
+        arena_t* arena_; //!< Source of the memory
+    };
+
+    template<typename Tp, typename Up>
+    inline bool operator==(const arena_allocator<Tp>& lhs, const arena_allocator<Up>& rhs) noexcept {
+        return lhs.arena() == rhs.arena();
+    }
+
+    template<typename Tp, typename Up>
+    inline bool operator!=(const arena_allocator<Tp>& lhs, const arena_allocator<Up>& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+}
+
+#endif // ATOM_ARENA_ALLOCATOR_H
@@ -0,0 +1,257 @@
+//-----------------------------------------------------------------------------
+//! @file realloc_allocator.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Implements the relocation trait and an allocator which grows memory in place
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_REALLOC_ALLOCATOR_H
+#define ATOM_REALLOC_ALLOCATOR_H 1
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "exceptions.h"
+
+#ifdef __linux__
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+//-----------------------------------------------------------------------------
+//! @def ATOM_MREMAP_THRESHOLD
+//! @brief Size in bytes from which realloc_allocator takes memory from mmap() and grows it by mremap()
+//! @details Can be defined before the include, has effect only on Linux
+//-----------------------------------------------------------------------------
+#ifndef ATOM_MREMAP_THRESHOLD
+    #define ATOM_MREMAP_THRESHOLD (static_cast<std::size_t>(1) << 20)
+#endif
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @struct is_trivially_relocatable
+    //! @brief Object of the type can be moved to the other address by memcpy() without destructor call
+    //! @details True for arithmetic types, user types are opted in by specialization:
+    //! @details template<> struct atom::is_trivially_relocatable<my_type> : std::true_type {};
+    //! @tparam Tp The type which is checked
+    //-----------------------------------------------------------------------------
+    template<typename Tp>
+    struct is_trivially_relocatable : std::is_arithmetic<Tp> {
+    };
+
+    //-----------------------------------------------------------------------------
+    //! @struct has_reallocate
+    //! @brief Allocator has method reallocate(ptr, old_n, new_n)
+    //! @tparam Allocator The type of the allocator which is checked
+    //-----------------------------------------------------------------------------
+    template<typename Allocator, typename = void>
+    struct has_reallocate : std::false_type {
+    };
+
+    template<typename Allocator>
+    struct has_reallocate<Allocator,
+                          decltype(void(std::declval<Allocator&>().reallocate(
+                              std::declval<typename std::allocator_traits<Allocator>::pointer>(),
+                              std::size_t(), std::size_t())))> : std::true_type {
+    };
+
+    //-----------------------------------------------------------------------------
+    //! @class realloc_allocator
+    //! @brief Stateless allocator on malloc() which can resize memory without copy
+    //! @details Blocks from ATOM_MREMAP_THRESHOLD bytes are mapped by mmap() and resized by mremap(),
+    //! @details smaller blocks are resized by realloc(). Choice depends only on the size,
+    //! @details so deallocate() and reallocate() must get the same n as allocate().
+    //! @details reallocate() moves bytes, it is correct only for trivially relocatable types.
+    //! @tparam Tp The type of the allocated values
+    //-----------------------------------------------------------------------------
+    template<typename Tp>
+    class realloc_allocator {
+    public:
+
+        using value_type      = Tp;             //!< Element type
+        using size_type       = std::size_t;    //!< Size type
+        using is_always_equal = std::true_type;
+
+        static_assert(alignof(Tp) <= alignof(std::max_align_t),
+                      "realloc_allocator does not support over-aligned types");
+
+        realloc_allocator() noexcept = default;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Converting constructor
+        //-----------------------------------------------------------------------------
+        template<typename Up>
+        realloc_allocator(const realloc_allocator<Up>&) noexcept {
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Allocate memory
+        //! @param n The number of elements
+        //! @throw atom::badAlloc When memory is not allocated
+        //! @return Pointer to the memory for n elements
+        //-----------------------------------------------------------------------------
+        value_type* allocate(const size_type n) {
+            ATOM_BAD_ALLOC(n > max_size());
+
+            void* ptr = raw_allocate(n * sizeof(value_type));
+            ATOM_BAD_ALLOC(!ptr);
+
+            return static_cast<value_type*>(ptr);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Deallocate memory
+        //! @param ptr Pointer returned by allocate() or reallocate()
+        //! @param n The number of elements which was passed there
+        //-----------------------------------------------------------------------------
+        void deallocate(value_type* ptr, const size_type n) noexcept {
+            raw_deallocate(ptr, n * sizeof(value_type));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Resize memory
+        //! @details Memory is grown in place when it is possible, otherwise the bytes are moved.
+        //! @details If exception is thrown ptr stays valid.
+        //! @param ptr Pointer returned by allocate() or reallocate(), may be nullptr when old_n is 0
+        //! @param old_n The number of elements in the memory ptr
+        //! @param new_n The new number of elements, must not be 0
+        //! @throw atom::badAlloc When memory is not allocated
+        //! @return Pointer to the memory for new_n elements, first min(old_n, new_n) elements are kept
+        //-----------------------------------------------------------------------------
+        value_type* reallocate(value_type* ptr, const size_type old_n, const size_type new_n);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Max size
+        //! @return The max number of elements which can be allocated
+        //-----------------------------------------------------------------------------
+        size_type max_size() const noexcept {
+            return std::numeric_limits<size_type>::max() / 2 / sizeof(value_type);
+        }
+
+    private:
+
+        static bool is_mapped(const size_type bytes) noexcept {
+#ifdef __linux__
+            return bytes >= ATOM_MREMAP_THRESHOLD;
+#else
+            (void)bytes;
+            return false;
+#endif
+        }
+
+#ifdef __linux__
+        static size_type page_round(const size_type bytes) noexcept {
+            static const size_type page = static_cast<size_type>(sysconf(_SC_PAGESIZE));
+            return (bytes + page - 1) / page * page;
+        }
+#endif
+
+        static void* raw_allocate(const size_type bytes) noexcept;
+
+        static void raw_deallocate(void* ptr, const size_type bytes) noexcept;
+    };
+
+    template<typename Tp>
+    void* realloc_allocator<Tp>::raw_allocate(const size_type bytes) noexcept {
+#ifdef __linux__
+        if (is_mapped(bytes)) {
+            void* ptr = mmap(nullptr, page_round(bytes), PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            return ptr == MAP_FAILED ? nullptr : ptr;
+        }
+#endif
+        return std::malloc(bytes);
+    }
+
+    template<typename Tp>
+    void realloc_allocator<Tp>::raw_deallocate(void* ptr, const size_type bytes) noexcept {
+        if (!ptr) {
+            return;
+        }
+#ifdef __linux__
+        if (is_mapped(bytes)) {
+            munmap(ptr, page_round(bytes));
+            return;
+        }
+#endif
+        std::free(ptr);
+    }
+
+    template<typename Tp>
+    typename realloc_allocator<Tp>::value_type*
+    realloc_allocator<Tp>::reallocate(value_type* ptr, const size_type old_n, const size_type new_n) {
+        if (!ptr) {
+            return allocate(new_n);
+        }
+
+        ATOM_BAD_ALLOC(new_n > max_size());
+
+        const size_type old_bytes = old_n * sizeof(value_type);
+        const size_type new_bytes = new_n * sizeof(value_type);
+
+        void* result = nullptr;
+
+        if (is_mapped(old_bytes) == is_mapped(new_bytes)) {
+#ifdef __linux__
+            if (is_mapped(new_bytes)) {
+                result = mremap(ptr, page_round(old_bytes), page_round(new_bytes), MREMAP_MAYMOVE);
+                result = result == MAP_FAILED ? nullptr : result;
+            }
+            else
+#endif
+            {
+                result = std::realloc(static_cast<void*>(ptr), new_bytes);
+            }
+        }
+        else {
+            result = raw_allocate(new_bytes);
+            if (result) {
+                std::memcpy(result, static_cast<void*>(ptr), old_bytes < new_bytes ? old_bytes : new_bytes);
+                raw_deallocate(ptr, old_bytes);
+            }
+        }
+
+        ATOM_BAD_ALLOC(!result);
+
+        return static_cast<value_type*>(result);
+    }
+
+    template<typename Tp, typename Up>
+    inline bool operator==(const realloc_allocator<Tp>&, const realloc_allocator<Up>&) noexcept {
+        return true;
+    }
+
+    template<typename Tp, typename Up>
+    inline bool operator!=(const realloc_allocator<Tp>&, const realloc_allocator<Up>&) noexcept {
+        return false;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! @brief Allocator of the containers by default
+    //! @details Trivially relocatable types use realloc_allocator, other types use std::allocator
+    //! @tparam Tp The type of the allocated values
+    //-----------------------------------------------------------------------------
+    template<typename Tp>
+    using default_allocator_t = typename std::conditional<is_trivially_relocatable<Tp>::value,
+                                                          realloc_allocator<Tp>,
+                                                          std::allocator<Tp> >::type;
+
+}
+
+#endif // ATOM_REALLOC_ALLOCATOR_H
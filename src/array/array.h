@@ -17,8 +17,13 @@
 #include "exceptions.h"
 #include "debug_tools.h"
 #include "va_iterator.h"
+#include "compact.h"
+#include "simd/simd.h"
 #include <initializer_list>
 #include <algorithm>
+#include <memory>
+#include <new>
+#include <type_traits>
 
 
 //-----------------------------------------------------------------------------
@@ -27,13 +32,109 @@
 //-----------------------------------------------------------------------------
 namespace atom {
 
+    //-----------------------------------------------------------------------------
+    //! @namespace atom::array_detail
+    //! @brief Storage of array_t
+    //-----------------------------------------------------------------------------
+    namespace array_detail {
+
+        //! @brief Tag of the constructors which value-initialize the whole buffer
+        struct zero_buffer_t {
+        };
+
+        //-----------------------------------------------------------------------------
+        //! @class array_base_t
+        //! @brief Buffer, size and status of array_t
+        //! @details Trivial types are kept in the plain array and the destructor is trivial,
+        //! @details so array_t of them is a literal type and can be built at compile time
+        //! @tparam Tp The type of the value in the array
+        //! @tparam max_size_ Max capacity of the array
+        //-----------------------------------------------------------------------------
+        template<typename Tp, std::size_t max_size_, bool = std::is_trivial<Tp>::value>
+        class array_base_t {
+        protected:
+
+            std::size_t   size_;            //!< Size of the array
+            Tp            items_[max_size_]; //!< Buffer of the array
+            unsigned char status_valid_: 1; //!< Status of the array
+
+            //! @brief The buffer is not initialized, O(1)
+            array_base_t() noexcept :
+                size_        (0),
+                status_valid_(1) {
+            }
+
+            //! @brief The buffer is value-initialized: constexpr constructors must initialize all members
+            constexpr explicit array_base_t(zero_buffer_t) noexcept :
+                size_        (0),
+                items_       (),
+                status_valid_(1) {
+            }
+
+            //! @brief The first element of the buffer
+            constexpr Tp* data() noexcept {
+                return items_;
+            }
+
+            //! @brief The first element of the buffer
+            constexpr const Tp* data() const noexcept {
+                return items_;
+            }
+        };
+
+        //-----------------------------------------------------------------------------
+        //! @class array_base_t
+        //! @brief Raw aligned buffer for the other types, only the first size_ elements are constructed
+        //-----------------------------------------------------------------------------
+        template<typename Tp, std::size_t max_size_>
+        class array_base_t<Tp, max_size_, false> {
+        protected:
+
+            std::size_t   size_;                                       //!< Size of the array
+            alignas(Tp) unsigned char bytes_[max_size_ * sizeof(Tp)]; //!< Raw buffer of the array
+            unsigned char status_valid_: 1;                           //!< Status of the array
+
+            array_base_t() noexcept :
+                size_        (0),
+                status_valid_(1) {
+            }
+
+            explicit array_base_t(zero_buffer_t) noexcept :
+                array_base_t() {
+            }
+
+            //! @brief Only size_ elements are destroyed
+            ~array_base_t() {
+                std::destroy_n(data(), size_);
+#ifndef ATOM_NDEBUG
+                size_ = POISON<std::size_t>::value;
+#endif
+                status_valid_ = 0;
+            }
+
+            //! @brief The first element of the buffer
+            Tp* data() noexcept {
+                return std::launder(reinterpret_cast<Tp*>(bytes_));
+            }
+
+            //! @brief The first element of the buffer
+            const Tp* data() const noexcept {
+                return std::launder(reinterpret_cast<const Tp*>(bytes_));
+            }
+        };
+    }
+
     //-----------------------------------------------------------------------------
     //! @class array_t
+    //! @brief Array with inline storage of max_size_ elements
+    //! @details Only the first size() elements are constructed. Arrays of trivial types are literal
+    //! @details types: the constructors with elements, generate() and the access are constexpr, e.g.
+    //! @details constexpr array_t<int, 4> table = {1, 2, 4, 8};
     //! @tparam Tp The type of the value in the array
     //! @tparam max_size_ Max capacity of the array
     //-----------------------------------------------------------------------------
     template<typename Tp, const std::size_t max_size_>
-    class array_t {
+    class array_t : private array_detail::array_base_t<Tp, max_size_> {
     public:
 
         friend class va_iterator<Tp>;
@@ -48,134 +149,152 @@ namespace atom {
 
         //-----------------------------------------------------------------------------
         //! @brief Default constructor
-        //! @details When switched debug fill all elements of the POISON
+        //! @details No element is constructed, O(1)
         //-----------------------------------------------------------------------------
         array_t() noexcept :
-            size_        (0),
-            status_valid_(1) {
-
-#ifndef ATOM_NDEBUG
-            std::fill_n(data_, max_size_, POISON<value_type>::value);
-#endif
+            base_type() {
         }
 
         //-----------------------------------------------------------------------------
         //! @brief Constructor
         //! @details Constructor which set size of the array and initialize them
-        //! @details Macro ATOM_NDEBUG for debug mode
+        //! @details constexpr for trivial types, the whole buffer is value-initialized then
         //! @param n The desired size of the array
         //! @param value initializer for n elements
         //! @throw atom::badAlloc If n less than max size
+        //! @throws The same exceptions as the copy constructor of value_type
         //-----------------------------------------------------------------------------
-        array_t(const size_type n,
+        constexpr array_t(const size_type n,
                 const_reference value) :
-            size_        (0),
-            status_valid_(1) {
+            base_type(array_detail::zero_buffer_t()) {
 
             if (n > max_size_) {
                 status_valid_ = 0;
                 throw atom::badAlloc(FULL_COORDINATES_FFL);
             }
 
-            size_ = n;
-            std::fill_n(data_, size_, value);
-
-#ifndef ATOM_NDEBUG
-            std::fill(data_ + size_, data_ + max_size_, POISON<value_type>::value);
-#endif
+            // size_ follows the constructed elements: the base destroys them when a copy throws
+            for (; size_ < n; ++size_) {
+                construct_at(size_, value);
+            }
         }
 
         //-----------------------------------------------------------------------------
         //! @brief Constructor
         //! @details Constructor which set size of the array and initialize them
-        //! @details Macro ATOM_NDEBUG for debug mode
+        //! @details constexpr for trivial types, the whole buffer is value-initialized then
         //! @param n The desired size of the array
         //! @param value rvalue reference (default value_type()) initializer for n elements
         //! @throw atom::badAlloc If n greater than max size
+        //! @throws The same exceptions as the copy constructor of value_type
         //-----------------------------------------------------------------------------
-        array_t(const size_type n,
+        constexpr array_t(const size_type n,
                 const_value_type&& value = value_type()) :
-            size_        (0),
-            status_valid_(1) {
+            base_type(array_detail::zero_buffer_t()) {
 
             if (n > max_size_) {
                 status_valid_ = 0;
                 throw atom::badAlloc(FULL_COORDINATES_FFL);
             }
 
-            size_ = n;
-            std::fill_n(data_, size_, value);
-
-#ifndef ATOM_NDEBUG
-            std::fill(data_ + size_, data_ + max_size_, POISON<value_type>::value);
-#endif
+            // size_ follows the constructed elements: the base destroys them when a copy throws
+            for (; size_ < n; ++size_) {
+                construct_at(size_, value);
+            }
         }
 
         //-----------------------------------------------------------------------------
-        //! @brief Default copy constructor
+        //! @brief Copy constructor
+        //! @details Only size() elements are copied, trivially copyable types by memcpy()
+        //! @param that The copy source
+        //! @throws The same exceptions as the copy constructor of value_type
         //-----------------------------------------------------------------------------
-        array_t(const array_t& that) = default;
+        array_t(const array_t& that) :
+            base_type() {
+
+            construct_live(data(), that.data(), that.size_);
+            size_         = that.size_;
+            status_valid_ = that.status_valid_;
+        }
 
         //-----------------------------------------------------------------------------
         //! @brief The move constructor
+        //! @details Only size() elements are moved, that becomes empty
         //! @param that The move source
         //-----------------------------------------------------------------------------
         array_t(array_t&& that) noexcept :
-            size_        (0),
-            status_valid_(1) {
+            base_type() {
 
-            swap(that);
+            relocate_live(data(), that.data(), that.size_);
+            size_         = that.size_;
+            status_valid_ = that.status_valid_;
+            that.size_    = 0;
         }
 
         //-----------------------------------------------------------------------------
         //! @brief Constructor with std::initializer_list
         //! @details Constructor which copy from std::initializer_list
+        //! @details constexpr for trivial types, the whole buffer is value-initialized then
         //! @param init List of elements
         //! @throw atom::badAlloc If n greater than max size
+        //! @throws The same exceptions as the copy constructor of value_type
         //-----------------------------------------------------------------------------
-        array_t(const std::initializer_list<value_type>& init) :
-            size_        (0),
-            status_valid_(1) {
+        constexpr array_t(const std::initializer_list<value_type>& init) :
+            base_type(array_detail::zero_buffer_t()) {
 
             if (init.size() > max_size_) {
                 status_valid_ = 0;
                 throw atom::badAlloc(FULL_COORDINATES_FFL);
             }
 
-            size_ = init.size();
-            std::copy(init.begin(), init.end(), data_);
-
-#ifndef ATOM_NDEBUG
-            std::fill(data_ + size_, data_ + max_size_, POISON<value_type>::value);
-#endif
+            for (const_reference x : init) {
+                construct_at(size_, x);
+                ++size_;
+            }
         }
 
         //-----------------------------------------------------------------------------
-        //! @brief Default destructor
-        //! @details Macro ATOM_NDEBUG for debug mode
+        //! @brief Array of fn(0), ..., fn(n - 1)
+        //! @details constexpr for trivial types: constexpr auto squares = array_t<int, 16>::generate(16, square);
+        //! @tparam Fn Type of the generator
+        //! @param n The desired size of the array
+        //! @param fn Is called as fn(i) for every element
+        //! @throw atom::badAlloc If n greater than max size
+        //! @throws The same exceptions as fn and the copy constructor of value_type
+        //! @return The array
         //-----------------------------------------------------------------------------
-        ~array_t() {
-#ifndef ATOM_NDEBUG
-            std::fill_n(data_, size_, POISON<value_type>::value);
-            size_ = POISON<size_type>::value;
-#endif
-            status_valid_ = 0;
+        template<typename Fn>
+        static constexpr array_t generate(const size_type n, Fn fn) {
+            return array_t(array_detail::zero_buffer_t(), n, fn);
         }
 
         //-----------------------------------------------------------------------------
         //! @brief The assignment operator
-        //! @details Use copy and move idiom
+        //! @details Only that.size() elements are copied, without the temporary array:
+        //! @details live elements are assigned, the rest is constructed or destroyed
         //! @param that The source of the assignment
+        //! @throws The same exceptions as the copy assignment and the copy constructor of value_type
         //! @return Constant reference to the calling object
         //-----------------------------------------------------------------------------
         const array_t& operator=(const array_t& that) {
-            array_t<value_type, max_size_> tmp_array(that);
-            swap(tmp_array);
+            if (this != &that) {
+                if (that.size_ <= size_) {
+                    copy_live(data(), that.data(), that.size_);
+                    std::destroy(data() + that.size_, data() + size_);
+                }
+                else {
+                    copy_live(data(), that.data(), size_);
+                    construct_live(data() + size_, that.data() + size_, that.size_ - size_);
+                }
+                size_         = that.size_;
+                status_valid_ = that.status_valid_;
+            }
             return *this;
         }
 
         //-----------------------------------------------------------------------------
         //! @brief The move assignment operator
+        //! @details The same as swap()
         //! @param that The move source
         //! @return Reference to the calling object
         //-----------------------------------------------------------------------------
@@ -194,11 +313,11 @@ namespace atom {
         //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
         //! @return Const reference on the nth item of the array
         //-----------------------------------------------------------------------------
-        const_reference operator[](const size_type n) const {
+        constexpr const_reference operator[](const size_type n) const {
             ATOM_ASSERT_VALID(this);
 
             ATOM_OUT_OF_RANGE(n >= size_);
-            return data_[n];
+            return data()[n];
         }
 
         //-----------------------------------------------------------------------------
@@ -208,7 +327,7 @@ namespace atom {
         //! @throws The same exceptions as the operator[] returns const reference
         //! @return Reference on the nth item of the array
         //-----------------------------------------------------------------------------
-        reference operator[](const size_type n) {
+        constexpr reference operator[](const size_type n) {
             return const_cast<reference>(static_cast<const array_t*>(this)->operator [](n));
         }
 
@@ -217,7 +336,7 @@ namespace atom {
         //! @return Iterator on the begin of the array
         //-----------------------------------------------------------------------------
         iterator begin() {
-            return iterator(data_);
+            return iterator(data());
         }
 
         //-----------------------------------------------------------------------------
@@ -225,7 +344,7 @@ namespace atom {
         //! @return Iterator on the end of the array
         //-----------------------------------------------------------------------------
         iterator end() {
-            return iterator(data_ + size_);
+            return iterator(data() + size_);
         }
 
         //-----------------------------------------------------------------------------
@@ -233,7 +352,7 @@ namespace atom {
         //! @return Iterator on the begin of the array
         //-----------------------------------------------------------------------------
         const_iterator cbegin() {
-            return const_iterator(data_);
+            return const_iterator(data());
         }
 
         //-----------------------------------------------------------------------------
@@ -241,14 +360,14 @@ namespace atom {
         //! @return Iterator on the end of the array
         //-----------------------------------------------------------------------------
         const_iterator cend() {
-            return const_iterator(data_ + size_);
+            return const_iterator(data() + size_);
         }
 
         //-----------------------------------------------------------------------------
         //! @brief First element
         //! @throws The same exceptions as the operator[]
         //-----------------------------------------------------------------------------
-        const_reference front() const {
+        constexpr const_reference front() const {
             return operator[](0);
         }
 
@@ -256,7 +375,7 @@ namespace atom {
         //! @brief Last element
         //! @throws The same exceptions as the operator[]
         //-----------------------------------------------------------------------------
-        const_reference back() const {
+        constexpr const_reference back() const {
             return operator[](size_ - 1);
         }
 
@@ -266,11 +385,12 @@ namespace atom {
         //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
         //! @throw atom::badAlloc When currently size equalent max_size of the array
         //-----------------------------------------------------------------------------
-        void push_back(const_reference x) {
+        constexpr void push_back(const_reference x) {
             ATOM_ASSERT_VALID(this);
 
             ATOM_BAD_ALLOC(size_ >= max_size_);
-            data_[size_++] = x;
+            construct_at(size_, x);
+            ++size_;
 
             ATOM_ASSERT_VALID(this);
         }
@@ -281,11 +401,12 @@ namespace atom {
         //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
         //! @throw atom::badAlloc When currently size equalent max_size of the array
         //-----------------------------------------------------------------------------
-        void push_back(const_value_type&& x) {
+        constexpr void push_back(const_value_type&& x) {
             ATOM_ASSERT_VALID(this);
 
             ATOM_BAD_ALLOC(size_ >= max_size_);
-            data_[size_++] = x;
+            construct_at(size_, x);
+            ++size_;
 
             ATOM_ASSERT_VALID(this);
         }
@@ -307,33 +428,142 @@ namespace atom {
             --size_;
 
             for (size_type i = position; i < size_; ++i) {
-                data_[i] = data_[i + 1];
+                data()[i] = std::move(data()[i + 1]);
             }
 
-#ifndef ATOM_NDEBUG
-            data_[size_] = POISON<value_type>::value;
-#endif
+            std::destroy_at(data() + size_);
+
             ATOM_ASSERT_VALID(this);
             return true;
         }
 
+        //-----------------------------------------------------------------------------
+        //! @brief Remove nth element without keeping the order
+        //! @details The last element is moved to position, O(1)
+        //! @details Macro ATOM_NDEBUG for debug mode
+        //! @param position number of the item in the array
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @return True if element was delete, otherwise false
+        //-----------------------------------------------------------------------------
+        bool erase_unordered(const size_type position) {
+            ATOM_ASSERT_VALID(this);
+
+            if (position >= size_) {
+                return false;
+            }
+
+            --size_;
+
+            if (position != size_) {
+                data()[position] = std::move(data()[size_]);
+            }
+
+            std::destroy_at(data() + size_);
+
+            ATOM_ASSERT_VALID(this);
+            return true;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Remove all elements which satisfy pred
+        //! @details One pass, order of the kept elements is preserved
+        //! @details Arithmetic types use branchless compaction (see compact_if())
+        //! @details Macro ATOM_NDEBUG for debug mode
+        //! @tparam Pred Type of the predicate
+        //! @param pred Returns true for elements which are removed
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @throws The same exceptions as pred and the move assignment of value_type
+        //! @return Count of the removed elements
+        //-----------------------------------------------------------------------------
+        template<typename Pred>
+        size_type erase_if(Pred pred) {
+            ATOM_ASSERT_VALID(this);
+
+            const size_type kept  = compact_if(data(), size_, pred);
+            const size_type count = size_ - kept;
+
+            std::destroy(data() + kept, data() + size_);
+            size_ = kept;
+
+            ATOM_ASSERT_VALID(this);
+            return count;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Search of the value
+        //! @details Elements are scanned by simd_find(), int and float use vector kernels
+        //! @param value Searched value
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @return Number of the first element which is equal to value, size() when there is no such element
+        //-----------------------------------------------------------------------------
+        size_type find(const_reference value) const {
+            ATOM_ASSERT_VALID(this);
+            return simd_find(data(), size_, value);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the value
+        //! @details Elements are scanned by simd_count(), int and float use vector kernels
+        //! @param value Counted value
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @return Count of elements which are equal to value
+        //-----------------------------------------------------------------------------
+        size_type count(const_reference value) const {
+            ATOM_ASSERT_VALID(this);
+            return simd_count(data(), size_, value);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Minimal element
+        //! @details Elements are scanned by simd_min(), int and float use vector kernels
+        //! @throw atom::outOfRange When array is empty
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @return Copy of the minimal element
+        //-----------------------------------------------------------------------------
+        value_type min() const {
+            ATOM_ASSERT_VALID(this);
+            return simd_min(data(), size_);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Maximal element
+        //! @details Elements are scanned by simd_max(), int and float use vector kernels
+        //! @throw atom::outOfRange When array is empty
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @return Copy of the maximal element
+        //-----------------------------------------------------------------------------
+        value_type max() const {
+            ATOM_ASSERT_VALID(this);
+            return simd_max(data(), size_);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Sum of elements
+        //! @details Elements are summed by simd_sum(), integers are summed in 64 bits
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @return Sum of elements, zero when array is empty
+        //-----------------------------------------------------------------------------
+        simd_sum_t<value_type> sum() const {
+            ATOM_ASSERT_VALID(this);
+            return simd_sum(data(), size_);
+        }
+
         //-----------------------------------------------------------------------------
         //! @brief Checks the array on the void
         //! @return True if array is empty, otherwise false
         //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
         //-----------------------------------------------------------------------------
-        bool empty() const {
+        constexpr bool empty() const {
             ATOM_ASSERT_VALID(this);
             return !size_;
         }
 
         //-----------------------------------------------------------------------------
         //! @brief Clear the array
+        //! @details Only size() elements are destroyed
         //-----------------------------------------------------------------------------
         void clear() noexcept {
-#ifndef ATOM_NDEBUG
-            std::fill_n(data_, size_, POISON<value_type>::value);
-#endif
+            std::destroy_n(data(), size_);
             size_ = 0;
         }
 
@@ -342,7 +572,7 @@ namespace atom {
         //! @return size of the array
         //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
         //-----------------------------------------------------------------------------
-        size_type size() const {
+        constexpr size_type size() const {
             ATOM_ASSERT_VALID(this);
             return size_;
         }
@@ -352,7 +582,7 @@ namespace atom {
         //! @return capacity of the array
         //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
         //-----------------------------------------------------------------------------
-        size_type capacity() const {
+        constexpr size_type capacity() const {
             ATOM_ASSERT_VALID(this);
             return max_size_;
         }
@@ -361,24 +591,34 @@ namespace atom {
         //! @brief Fill the array
         //! @param value The value to be assigned to all elements of the array
         //-----------------------------------------------------------------------------
-        void fill(const_reference value) {
+        constexpr void fill(const_reference value) {
             ATOM_ASSERT_VALID(this);
-            std::fill_n(data_, size_, value);
+            for (size_type i = 0; i < size_; ++i) {
+                data()[i] = value;
+            }
             ATOM_ASSERT_VALID(this);
         }
 
         //-----------------------------------------------------------------------------
         //! @brief Set new size of the array within max_size
+        //! @details New elements are default constructed, removed elements are destroyed
         //! @details Macro ATOM_NDEBUG for debug mode
         //! @param n The desired size of the array
+        //! @throws The same exceptions as the default constructor of value_type
         //! @return True if n less than max_size, otherwise false
         //-----------------------------------------------------------------------------
-        bool use_array(const size_type n) noexcept {
+        bool use_array(const size_type n) noexcept(std::is_nothrow_default_constructible<value_type>::value) {
             if (n <= max_size_) {
+                if (n > size_) {
+                    std::uninitialized_default_construct(data() + size_, data() + n);
 
 #ifndef ATOM_NDEBUG
-                std::fill(data_ + size_, data_ + n, POISON<value_type>::value);
+                    std::fill(data() + size_, data() + n, POISON<value_type>::value);
 #endif
+                }
+                else {
+                    std::destroy(data() + n, data() + size_);
+                }
                 size_ = n;
                 return true;
             }
@@ -388,10 +628,17 @@ namespace atom {
 
         //-----------------------------------------------------------------------------
         //! @brief Swap two array
+        //! @details Only max(size(), rhs.size()) elements are touched: the common part is swapped,
+        //! @details the rest of the longer array is relocated to the shorter one
         //! @param rhs other array to which you want to exchange
         //-----------------------------------------------------------------------------
         void swap(array_t& rhs) noexcept {
-            std::swap_ranges(data_, data_ + max_size_, rhs.data_);
+            array_t& longer  = size_ < rhs.size_ ? rhs : *this;
+            array_t& shorter = size_ < rhs.size_ ? *this : rhs;
+
+            std::swap_ranges(shorter.data(), shorter.data() + shorter.size_, longer.data());
+            relocate_live(shorter.data() + shorter.size_, longer.data() + shorter.size_, longer.size_ - shorter.size_);
+
             std::swap(size_, rhs.size_);
             unsigned char tmp_status = rhs.status_valid_;
             rhs.status_valid_ = status_valid_;
@@ -402,7 +649,7 @@ namespace atom {
         //! @brief Silent verifier
         //! @return True if array is valid else return false
         //-----------------------------------------------------------------------------
-        bool is_valid() const noexcept {
+        constexpr bool is_valid() const noexcept {
             return this &&
                     status_valid_ &&
                     size_ <= max_size_;
@@ -410,10 +657,59 @@ namespace atom {
 
     private:
 
-        size_type  size_;            //!< Size of the array
-        value_type data_[max_size_]; //!< Buffer of the array
+        using base_type = array_detail::array_base_t<Tp, max_size_>;
+
+        using base_type::size_;
+        using base_type::status_valid_;
+        using base_type::data;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor of generate()
+        //-----------------------------------------------------------------------------
+        template<typename Fn>
+        constexpr array_t(array_detail::zero_buffer_t, const size_type n, Fn& fn) :
+            base_type(array_detail::zero_buffer_t()) {
+
+            if (n > max_size_) {
+                status_valid_ = 0;
+                throw atom::badAlloc(FULL_COORDINATES_FFL);
+            }
+
+            for (; size_ < n; ++size_) {
+                construct_at(size_, fn(size_));
+            }
+        }
 
-        unsigned char status_valid_: 1; //!< Status of the array
+        //-----------------------------------------------------------------------------
+        //! @brief Construction of the element at pos from x
+        //! @details Trivial types are assigned, the buffer of them is a plain array
+        //-----------------------------------------------------------------------------
+        constexpr void construct_at(const size_type pos, const_reference x) {
+            if constexpr (std::is_trivial<value_type>::value) {
+                data()[pos] = x;
+            }
+            else {
+                ::new (static_cast<void*>(data() + pos)) value_type(x);
+            }
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Copy assignment of n elements to the live elements of the other array
+        //! @details Trivially copyable types are copied by memcpy()
+        //-----------------------------------------------------------------------------
+        static void copy_live(value_type* dst, const value_type* src, size_type n);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Copy construction of n elements in the raw memory of the other array
+        //! @details Trivially copyable types are copied by memcpy()
+        //-----------------------------------------------------------------------------
+        static void construct_live(value_type* dst, const value_type* src, size_type n);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Move of n elements to the raw memory of the other array, the sources are destroyed
+        //! @details Trivially copyable types are copied by memcpy()
+        //-----------------------------------------------------------------------------
+        static void relocate_live(value_type* dst, value_type* src, size_type n) noexcept;
 
         //-----------------------------------------------------------------------------
         //! @brief Dumper
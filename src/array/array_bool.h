@@ -18,8 +18,11 @@
 #include "exceptions.h"
 #include "debug_tools.h"
 #include "bool/va_bool_ref.h"
+#include "bool/va_set_bit_iterator.h"
+#include "simd/simd.h"
 #include "bool/va_bool_iterator.h"
 #include <algorithm>
+#include <utility>
 
 
 //-----------------------------------------------------------------------------
@@ -31,6 +34,8 @@ namespace atom {
     //-----------------------------------------------------------------------------
     //! @class array_t
     //! @details Specialized for bool type
+    //! @details Literal type: tables are built at compile time by the constexpr constructors,
+    //! @details push_back(), set() and reset(), e.g. in a constexpr function which returns the array
     //-----------------------------------------------------------------------------
     template<const std::size_t max_size_>
     class array_t<bool, max_size_> {
@@ -47,8 +52,9 @@ namespace atom {
         //! @brief Default constructor
         //! @details When switched debug fill all elements of the POISON
         //-----------------------------------------------------------------------------
-        array_t() noexcept :
+        constexpr array_t() noexcept :
             size_        (0),
+            data_        (),
             status_valid_(1) {
 
 #ifndef ATOM_NDEBUG
@@ -64,9 +70,10 @@ namespace atom {
         //! @param value initializer for n elements
         //! @throw atom::badAlloc If n less than max size
         //-----------------------------------------------------------------------------
-        array_t(const size_type n,
-                const bool      value = false) :
+        constexpr array_t(const size_type n,
+                          const bool      value = false) :
             size_        (0),
+            data_        (),
             status_valid_(1) {
 
             if (n > max_size_) {
@@ -89,26 +96,21 @@ namespace atom {
 
         //-----------------------------------------------------------------------------
         //! @brief The move constructor
+        //! @details Blocks of size() bits are copied, that becomes empty
         //! @param that The move source
         //-----------------------------------------------------------------------------
-        array_t(array_t&& that) noexcept :
-            size_        (0),
-            status_valid_(1) {
+        constexpr array_t(array_t&& that) noexcept :
+            size_        (that.size_),
+            data_        (),
+            status_valid_(that.status_valid_) {
 
-            swap(that);
+            for (size_type i = 0; i < bit_to_block(size_); ++i) {
+                data_[i] = that.data_[i];
+            }
+            that.size_ = 0;
         }
 
-        //-----------------------------------------------------------------------------
-        //! @brief Default destructor
-        //! @details Macro ATOM_NDEBUG for debug mode
-        //-----------------------------------------------------------------------------
-        ~array_t() {
-#ifndef ATOM_NDEBUG
-            fill_n_bit(0, size_, POISON<value_type>::value);
-            size_ = POISON<size_type>::value;
-#endif
-            status_valid_ = 0;
-        }
+        // The destructor is trivial, so the array is a literal type
 
         //-----------------------------------------------------------------------------
         //! @brief The assignment operator
@@ -157,7 +159,7 @@ namespace atom {
         //! @throws The same exceptions as the get_bit
         //! @return First bit
         //-----------------------------------------------------------------------------
-        bool front() const {
+        constexpr bool front() const {
             ATOM_ASSERT_VALID(this);
             ATOM_OUT_OF_RANGE(!size_);
             return get_bit(0);
@@ -168,7 +170,7 @@ namespace atom {
         //! @throws The same exceptions as the get_bit
         //! @retrurn Last bit
         //-----------------------------------------------------------------------------
-        bool back() const {
+        constexpr bool back() const {
             ATOM_ASSERT_VALID(this);
             ATOM_OUT_OF_RANGE(!size_);
             return get_bit(size_ - 1);
@@ -181,7 +183,7 @@ namespace atom {
         //! @throw The same exceptions as the get_bit
         //! @return Nth item of the array
         //-----------------------------------------------------------------------------
-        bool operator[](const size_type pos) const {
+        constexpr bool operator[](const size_type pos) const {
             ATOM_ASSERT_VALID(this);
 
             ATOM_OUT_OF_RANGE(pos >= size_);
@@ -201,7 +203,7 @@ namespace atom {
         //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
         //! @throw atom::badAlloc When currently size equalent max_size of the array
         //-----------------------------------------------------------------------------
-        void push_back(const bool x) {
+        constexpr void push_back(const bool x) {
             ATOM_ASSERT_VALID(this);
 
             ATOM_BAD_ALLOC(size_ >= max_size_);
@@ -211,7 +213,49 @@ namespace atom {
             ATOM_ASSERT_VALID(this);
         }
 
-        bool erase(const size_type pos);
+        //-----------------------------------------------------------------------------
+        //! @brief Remove the bit at pos
+        //! @param pos Position of the removed bit
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @return True if bit was deleted, otherwise false
+        //-----------------------------------------------------------------------------
+        bool erase(const size_type pos) {
+            return erase(pos, pos + 1);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Remove bits [first, last)
+        //! @details The tail is moved by move_bits(): whole blocks are funnel shifts of two
+        //! @details source blocks, so the cost is O(size / 64) for any first and last
+        //! @details last is clamped to the size of the array
+        //! @param first Position of the first removed bit
+        //! @param last Position after the last removed bit
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @return True if bits were deleted, otherwise false
+        //-----------------------------------------------------------------------------
+        bool erase(const size_type first, size_type last);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Insert the bit before pos
+        //! @param pos Position of the new bit, it can be equal to size()
+        //! @param value Value of the new bit
+        //! @throws The same exceptions as insert(pos, count, value)
+        //-----------------------------------------------------------------------------
+        void insert(const size_type pos, const bool value) {
+            insert(pos, 1, value);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Insert count bits equal to value before pos
+        //! @details The tail is moved by move_bits() in O(size / 64)
+        //! @param pos Position of the first new bit, it can be equal to size()
+        //! @param count Count of the new bits
+        //! @param value Value of the new bits
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @throw atom::outOfRange When pos is bigger than size()
+        //! @throw atom::badAlloc When the new size is bigger than max_size of the array
+        //-----------------------------------------------------------------------------
+        void insert(const size_type pos, const size_type count, const bool value);
 
         //-----------------------------------------------------------------------------
         //! @brief Clear the array
@@ -233,7 +277,12 @@ namespace atom {
             if (n <= max_size_) {
 
 #ifndef ATOM_NDEBUG
-                fill_n_bit(size_, n - size_, POISON<value_type>::value);
+                if (n > size_) {
+                    fill_n_bit(size_, n - size_, POISON<value_type>::value);
+                }
+                else {
+                    fill_n_bit(n, size_ - n, POISON<value_type>::value);
+                }
 #endif
                 size_ = n;
                 return true;
@@ -242,9 +291,15 @@ namespace atom {
             return false;
         }
 
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the set bits
+        //! @details Full blocks are counted by simd_popcount(), the last block is masked
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @return Count of the true elements
+        //-----------------------------------------------------------------------------
         size_type count() const;
 
-        void set(const size_type pos) {
+        constexpr void set(const size_type pos) {
             ATOM_ASSERT_VALID(this);
 
             ATOM_OUT_OF_RANGE(pos >= size_);
@@ -253,12 +308,12 @@ namespace atom {
             ATOM_ASSERT_VALID(this);
         }
 
-        void reset(const size_type pos) {
+        constexpr void reset(const size_type pos) {
             ATOM_OUT_OF_RANGE(pos >= size_);
             set_bit(pos, false);
         }
 
-        void flip(const size_type pos) {
+        constexpr void flip(const size_type pos) {
             ATOM_ASSERT_VALID(this);
             ATOM_OUT_OF_RANGE(pos >= size_);
 
@@ -269,12 +324,81 @@ namespace atom {
 
         void invert();
 
+        //-----------------------------------------------------------------------------
+        //! @brief Position of the first set bit
+        //! @details Blocks are scanned with count-trailing-zeros, not bit by bit
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @return Position of the bit, size() when there are no set bits
+        //-----------------------------------------------------------------------------
+        constexpr size_type find_first() const {
+            ATOM_ASSERT_VALID(this);
+            return find_next_bit(data_, size_, 0);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Position of the first set bit after pos
+        //! @param pos Position to start after, it can be greater than size()
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @return Position of the bit, size() when there are no set bits after pos
+        //-----------------------------------------------------------------------------
+        constexpr size_type find_next(const size_type pos) const {
+            ATOM_ASSERT_VALID(this);
+            return pos < size_ ? find_next_bit(data_, size_, pos + 1) : size_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Position of the last set bit before pos
+        //! @details find_prev(size()) is the last set bit
+        //! @param pos Position to start before, it can be greater than size()
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @return Position of the bit, size() when there are no set bits before pos
+        //-----------------------------------------------------------------------------
+        constexpr size_type find_prev(const size_type pos) const {
+            ATOM_ASSERT_VALID(this);
+            return find_prev_bit(data_, size_, pos);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Visit the set bits in ascending order
+        //! @details Cost is proportional to the count of blocks plus the count of set bits
+        //! @tparam Fn Type of the visitor
+        //! @param fn Is called as fn(pos) for every set bit, it must not change the array
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @throws The same exceptions as fn
+        //-----------------------------------------------------------------------------
+        template<typename Fn>
+        void for_each_set(Fn&& fn) const {
+            ATOM_ASSERT_VALID(this);
+            for_each_set_bit(data_, size_, std::forward<Fn>(fn));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Range of the positions of the set bits
+        //! @details for (size_t pos : mask.set_bits()), the range is invalidated by any change of the array
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
+        //! @return Range of va_set_bit_iterator
+        //-----------------------------------------------------------------------------
+        va_set_bit_range set_bits() const {
+            ATOM_ASSERT_VALID(this);
+            return va_set_bit_range(data_, size_);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Blocks of the bits
+        //! @details Bit pos is (data()[pos / BIT_BLOCK_SIZE] >> pos % BIT_BLOCK_SIZE) & 1,
+        //! @details bits of the last block behind size() are unspecified
+        //! @return Pointer on the first block, it is valid while the array is alive
+        //-----------------------------------------------------------------------------
+        constexpr const bit_container_type* data() const noexcept {
+            return data_;
+        }
+
         //-----------------------------------------------------------------------------
         //! @brief Checks the array on the void
         //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
         //! @return True if array is empty, otherwise false
         //-----------------------------------------------------------------------------
-        bool empty() const {
+        constexpr bool empty() const {
             ATOM_ASSERT_VALID(this);
             return !size_;
         }
@@ -284,7 +408,7 @@ namespace atom {
         //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
         //! @return capacity of the array
         //-----------------------------------------------------------------------------
-        size_type capacity() const {
+        constexpr size_type capacity() const {
             ATOM_ASSERT_VALID(this);
             return max_size_;
         }
@@ -294,7 +418,7 @@ namespace atom {
         //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when array is not valid
         //! @return Count bits in the array
         //-----------------------------------------------------------------------------
-        size_type size() const {
+        constexpr size_type size() const {
             ATOM_ASSERT_VALID(this);
             return size_;
         }
@@ -316,7 +440,7 @@ namespace atom {
         //! @brief Silent verifier
         //! @return True if array is valid else return false
         //-----------------------------------------------------------------------------
-        bool is_valid() const noexcept {
+        constexpr bool is_valid() const noexcept {
             return this &&
                     status_valid_ &&
                     size_ <= max_size_;
@@ -330,7 +454,7 @@ namespace atom {
 
         unsigned char status_valid_: 1; //!< Status of the array
 
-        void set_bit(const size_type pos, const bool value) {
+        constexpr void set_bit(const size_type pos, const bool value) {
             ATOM_ASSERT_VALID(this);
 
             if (value) {
@@ -343,7 +467,7 @@ namespace atom {
             ATOM_ASSERT_VALID(this);
         }
 
-        bool get_bit(const size_type pos) const {
+        constexpr bool get_bit(const size_type pos) const {
             ATOM_ASSERT_VALID(this);
             return get_n_bit(data_[n_block(pos)], pos_in_block(pos));
         }
@@ -353,27 +477,27 @@ namespace atom {
             return get_n_bit(data_[pos / BIT_BLOCK_SIZE], pos % BIT_BLOCK_SIZE);
         }
 
-        size_type n_block(const size_type pos) const {
+        constexpr size_type n_block(const size_type pos) const {
             ATOM_OUT_OF_RANGE(pos >= max_size_);
             return pos / BIT_BLOCK_SIZE;
         }
 
-        size_type pos_in_block(const size_type pos) const {
+        constexpr size_type pos_in_block(const size_type pos) const {
             ATOM_OUT_OF_RANGE(pos >= max_size_);
             return pos % BIT_BLOCK_SIZE;
         }
 
-        size_type block_to_bit(const size_type count_blocks) const noexcept {
+        constexpr size_type block_to_bit(const size_type count_blocks) const noexcept {
             return count_blocks * BIT_BLOCK_SIZE;
         }
 
-        size_type bit_to_block(const size_type count_bits) const {
+        constexpr size_type bit_to_block(const size_type count_bits) const {
             return div_ceil(count_bits, BIT_BLOCK_SIZE);
         }
 
-        void fill_n_bit(const size_type begin,
-                        const size_type n,
-                        const bool      value);
+        constexpr void fill_n_bit(const size_type begin,
+                                  const size_type n,
+                                  const bool      value);
 
         void dump(const char* file,
                   const char* function_name,
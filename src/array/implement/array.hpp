@@ -2,11 +2,51 @@
 #define ATOM_ARRAY_HPP 1
 
 #include <fstream>
+#include <cstring>
+#include <memory>
+#include <type_traits>
 #include "debug_tools.h"
 
 
 namespace atom {
 
+    template<typename Tp, std::size_t max_size_>
+    void array_t<Tp, max_size_>::copy_live(value_type* dst, const value_type* src, const size_type n) {
+        if constexpr (std::is_trivially_copyable<value_type>::value) {
+            if (n) {
+                memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+            }
+        }
+        else {
+            std::copy(src, src + n, dst);
+        }
+    }
+
+    template<typename Tp, std::size_t max_size_>
+    void array_t<Tp, max_size_>::construct_live(value_type* dst, const value_type* src, const size_type n) {
+        if constexpr (std::is_trivially_copyable<value_type>::value) {
+            if (n) {
+                memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+            }
+        }
+        else {
+            std::uninitialized_copy_n(src, n, dst);
+        }
+    }
+
+    template<typename Tp, std::size_t max_size_>
+    void array_t<Tp, max_size_>::relocate_live(value_type* dst, value_type* src, const size_type n) noexcept {
+        if constexpr (std::is_trivially_copyable<value_type>::value) {
+            if (n) {
+                memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+            }
+        }
+        else {
+            std::uninitialized_move_n(src, n, dst);
+            std::destroy_n(src, n);
+        }
+    }
+
     template<typename Tp, std::size_t max_size_>
     void array_t<Tp, max_size_>::dump(const char* file,
                                       const char* function_name,
@@ -29,12 +69,9 @@ namespace atom {
                 "\tfield_status: " << (status_valid_ ? "ok\n\n" : "fail\n\n");
 
 #ifndef ATOM_NWRITE
-        for (size_type i = 0; i < size_; ++i) {
-            fout << "\t* [" << i << "] =  " << data_[i] << "\n";
-        }
-        for (size_type i = size_; i < max_size_; ++i) {
-            fout << "\t  [" << i << "] =  " << data_[i]
-                 << (data_[i] != POISON<value_type>::value ? "\t//ERROR!\n" : "\n");
+        // Elements behind size() are not constructed
+        for (size_type i = 0; i < size_ && i < max_size_; ++i) {
+            fout << "\t* [" << i << "] =  " << data()[i] << "\n";
         }
 #endif
         fout << "}\n"
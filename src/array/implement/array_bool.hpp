@@ -13,20 +13,15 @@ namespace atom {
     array_t<bool, max_size_>::count() const {
         ATOM_ASSERT_VALID(this);
 
-        size_type result       = 0;
-        size_type count_blocks = size_ / BIT_BLOCK_SIZE;
+        const size_type count_blocks = size_ / BIT_BLOCK_SIZE;
+        const size_type remain_bits  = size_ % BIT_BLOCK_SIZE;
 
-        for (size_type i = 0; i < count_blocks; ++i) {
-            bit_container_type copy_block = data_[i];
-            while (copy_block) {
-                result += last_bit(copy_block);
-                copy_block >>= 1;
-            }
-        }
-        bit_container_type copy_block = data_[count_blocks];
-        for (size_type i = block_to_bit(count_blocks); i < size_; ++i) {
-            result += last_bit(copy_block);
-            copy_block >>= 1;
+        size_type result = simd_popcount(data_, count_blocks);
+
+        if (remain_bits) {
+            // Bits behind size_ are not part of the container
+            result += static_cast<size_type>(
+                __builtin_popcountll(data_[count_blocks] & ((ONE << remain_bits) - 1)));
         }
 
         return result;
@@ -53,9 +48,9 @@ namespace atom {
     }
 
     template<const std::size_t max_size_>
-    void array_t<bool, max_size_>::fill_n_bit(const size_type begin,
-                                              const size_type n,
-                                              const bool      value) {
+    constexpr void array_t<bool, max_size_>::fill_n_bit(const size_type begin,
+                                                        const size_type n,
+                                                        const bool      value) {
 
         ATOM_ASSERT_VALID(this);
 
@@ -81,35 +76,41 @@ namespace atom {
     }
 
     template<const std::size_t max_size_>
-    bool array_t<bool, max_size_>::erase(const size_type pos) {
+    bool array_t<bool, max_size_>::erase(const size_type first, size_type last) {
         ATOM_ASSERT_VALID(this);
 
-        if (pos >= size_) {
+        last = std::min(last, size_);
+        if (first >= last) {
             return false;
         }
 
-        size_type it = pos;
-        --size_;
-
-        while (it % BIT_BLOCK_SIZE && it != size_) {
-            set_bit(it, get_bit(it + 1));
-            ++it;
-        }
-        while (it + BIT_BLOCK_SIZE <= size_) {
-            data_[n_block(it)] >>= 1;
-            it += BIT_BLOCK_SIZE;
-        }
-        for (; it < size_; ++it) {
-            set_bit(it, get_bit(it + 1));
-        }
+        move_bits(data_, first, last, size_ - last);
+        size_ -= last - first;
 
 #ifndef ATOM_NDEBUG
-        set_bit(size_, POISON<bool>::value);
+        fill_n_bit(size_, last - first, POISON<bool>::value);
 #endif
         ATOM_ASSERT_VALID(this);
         return true;
     }
 
+    template<const std::size_t max_size_>
+    void array_t<bool, max_size_>::insert(const size_type pos, const size_type count, const bool value) {
+        ATOM_ASSERT_VALID(this);
+        ATOM_OUT_OF_RANGE(pos > size_);
+        ATOM_BAD_ALLOC(count > max_size_ - size_);
+
+        if (!count) {
+            return;
+        }
+
+        move_bits(data_, pos + count, pos, size_ - pos);
+        fill_n_bit(pos, count, value);
+        size_ += count;
+
+        ATOM_ASSERT_VALID(this);
+    }
+
     template<const std::size_t max_size_>
     void array_t<bool, max_size_>::dump(const char* file,
                                         const char* function_name,
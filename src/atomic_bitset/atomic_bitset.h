@@ -0,0 +1,211 @@
+//-----------------------------------------------------------------------------
+//! @file atomic_bitset.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Bitset with lock-free changes from many threads
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_ATOMIC_BITSET_H
+#define ATOM_ATOMIC_BITSET_H 1
+
+#include "bool/bool_space.h"
+#include "vector/vector.h"
+#include "simd/simd.h"
+#include "exceptions.h"
+#include "debug_tools.h"
+#include <atomic>
+#include <utility>
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @class atomic_bitset_t
+    //! @brief Bitset of fixed size, every change is an atomic operation on one block
+    //! @details Layout is the layout of vector_t<bool>: the bits are kept in vector_t<bool>,
+    //! @details changes are __atomic_fetch_or/__atomic_fetch_and on its blocks (as std::atomic_ref
+    //! @details of C++20 does), so concurrent set() of the bits of one block do not lose bits.
+    //! @details When marking is finished (threads are joined) bits() is a read-only vector
+    //! @details without a copy and release() takes it
+    //-----------------------------------------------------------------------------
+    class atomic_bitset_t {
+    public:
+
+        using size_type = std::size_t; //!< Size type
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @param n Count of the bits, all bits are reset
+        //! @throws The same exceptions as the constructor of vector_t<bool>
+        //-----------------------------------------------------------------------------
+        explicit atomic_bitset_t(const size_type n) :
+            bits_(n, false) {
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Value of the bit
+        //! @param pos Position of the bit
+        //! @param order Memory order of the load
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitset is not valid
+        //! @throw atom::outOfRange When pos is not less than size()
+        //-----------------------------------------------------------------------------
+        bool test(const size_type pos, const std::memory_order order = std::memory_order_seq_cst) const {
+            ATOM_ASSERT_VALID(this);
+            ATOM_OUT_OF_RANGE(pos >= bits_.size());
+
+            return __atomic_load_n(bits_.data() + pos / BIT_BLOCK_SIZE, gcc_order(order)) & mask_of(pos);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Set the bit and return its old value
+        //! @details Exactly one of the threads which mark the same bit gets false
+        //! @param pos Position of the bit
+        //! @param order Memory order of the read-modify-write
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitset is not valid
+        //! @throw atom::outOfRange When pos is not less than size()
+        //! @return Value of the bit before the call
+        //-----------------------------------------------------------------------------
+        bool test_and_set(const size_type pos, const std::memory_order order = std::memory_order_seq_cst) {
+            ATOM_ASSERT_VALID(this);
+            ATOM_OUT_OF_RANGE(pos >= bits_.size());
+
+            return __atomic_fetch_or(bits_.data() + pos / BIT_BLOCK_SIZE, mask_of(pos), gcc_order(order)) & mask_of(pos);
+        }
+
+        //! @brief Set the bit, see test_and_set()
+        void set(const size_type pos, const std::memory_order order = std::memory_order_seq_cst) {
+            test_and_set(pos, order);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Reset the bit
+        //! @param pos Position of the bit
+        //! @param order Memory order of the read-modify-write
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitset is not valid
+        //! @throw atom::outOfRange When pos is not less than size()
+        //-----------------------------------------------------------------------------
+        void reset(const size_type pos, const std::memory_order order = std::memory_order_seq_cst) {
+            ATOM_ASSERT_VALID(this);
+            ATOM_OUT_OF_RANGE(pos >= bits_.size());
+
+            __atomic_fetch_and(bits_.data() + pos / BIT_BLOCK_SIZE, ~mask_of(pos), gcc_order(order));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Set the bits of mask in the block by one operation
+        //! @details Bit i of mask is the bit block * BIT_BLOCK_SIZE + i, bits behind size() are ignored
+        //! @param block Number of the block
+        //! @param mask Bits to set
+        //! @param order Memory order of the read-modify-write
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitset is not valid
+        //! @throw atom::outOfRange When block is not less than count_blocks()
+        //! @return Value of the block before the call
+        //-----------------------------------------------------------------------------
+        bit_container_type fetch_or_block(const size_type          block,
+                                          const bit_container_type mask,
+                                          const std::memory_order  order = std::memory_order_seq_cst) {
+            ATOM_ASSERT_VALID(this);
+            ATOM_OUT_OF_RANGE(block >= count_blocks());
+
+            return __atomic_fetch_or(bits_.data() + block, mask & valid_mask(block), gcc_order(order)) & valid_mask(block);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the set bits
+        //! @details Every block is loaded with memory_order_relaxed, the result is exact
+        //! @details when there are no concurrent changes, otherwise it is a value between
+        //! @details the counts before and after the changes for sets-only or resets-only phases
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitset is not valid
+        //-----------------------------------------------------------------------------
+        size_type count() const;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the bits
+        //-----------------------------------------------------------------------------
+        size_type size() const noexcept {
+            return bits_.size();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the blocks
+        //-----------------------------------------------------------------------------
+        size_type count_blocks() const noexcept {
+            return div_ceil(bits_.size(), BIT_BLOCK_SIZE);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Read-only view of the bits without a copy
+        //! @details Reads through the view must happen after the changes, e.g. after the join
+        //! @details of the marking threads
+        //-----------------------------------------------------------------------------
+        const vector_t<bool>& bits() const noexcept {
+            return bits_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Take the bits, the bitset becomes empty
+        //! @return Vector with the memory of the bitset
+        //-----------------------------------------------------------------------------
+        vector_t<bool> release() noexcept {
+            return std::move(bits_);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Silent verifier
+        //! @return True if bitset is valid else return false
+        //-----------------------------------------------------------------------------
+        bool is_valid() const noexcept {
+            return this && bits_.is_valid();
+        }
+
+    private:
+
+        vector_t<bool> bits_;
+
+        static bit_container_type mask_of(const size_type pos) noexcept {
+            return ONE << (pos % BIT_BLOCK_SIZE);
+        }
+
+        bit_container_type valid_mask(const size_type block) const noexcept {
+            const size_type remain_bits = bits_.size() - block * BIT_BLOCK_SIZE;
+            return remain_bits >= BIT_BLOCK_SIZE ? ~bit_container_type(0) : (ONE << remain_bits) - 1;
+        }
+
+        static size_type count_relaxed(const bit_container_type* data, const size_type n) noexcept;
+#ifdef ATOM_SIMD_X86
+        static size_type count_relaxed_popcnt(const bit_container_type* data, const size_type n) noexcept;
+#endif
+
+        static int gcc_order(const std::memory_order order) noexcept {
+            switch (order) {
+                case std::memory_order_relaxed: return __ATOMIC_RELAXED;
+                case std::memory_order_consume: return __ATOMIC_CONSUME;
+                case std::memory_order_acquire: return __ATOMIC_ACQUIRE;
+                case std::memory_order_release: return __ATOMIC_RELEASE;
+                case std::memory_order_acq_rel: return __ATOMIC_ACQ_REL;
+                case std::memory_order_seq_cst: break;
+            }
+            return __ATOMIC_SEQ_CST;
+        }
+
+        void dump(const char* file,
+                  const char* function_name,
+                  int         line_number,
+                  const char* output_file = "__atomic_bitset_dump.txt") const;
+    };
+
+}
+
+#include "implement/atomic_bitset.hpp"
+
+#endif // ATOM_ATOMIC_BITSET_H
@@ -0,0 +1,81 @@
+#ifndef ATOM_ATOMIC_BITSET_HPP
+#define ATOM_ATOMIC_BITSET_HPP 1
+
+#include <fstream>
+#include "exceptions.h"
+#include "debug_tools.h"
+
+namespace atom {
+
+    inline atomic_bitset_t::size_type
+    atomic_bitset_t::count_relaxed(const bit_container_type* data, const size_type n) noexcept {
+        size_type result = 0;
+        for (size_type i = 0; i < n; ++i) {
+            result += static_cast<size_type>(__builtin_popcountll(__atomic_load_n(data + i, __ATOMIC_RELAXED)));
+        }
+        return result;
+    }
+
+#ifdef ATOM_SIMD_X86
+    ATOM_SIMD_TARGET("popcnt")
+    inline atomic_bitset_t::size_type
+    atomic_bitset_t::count_relaxed_popcnt(const bit_container_type* data, const size_type n) noexcept {
+        size_type result = 0;
+        for (size_type i = 0; i < n; ++i) {
+            result += static_cast<size_type>(__builtin_popcountll(__atomic_load_n(data + i, __ATOMIC_RELAXED)));
+        }
+        return result;
+    }
+#endif
+
+    inline atomic_bitset_t::size_type atomic_bitset_t::count() const {
+        ATOM_ASSERT_VALID(this);
+
+        const bit_container_type* data        = bits_.data();
+        const size_type           full_blocks = bits_.size() / BIT_BLOCK_SIZE;
+        size_type                 result      = 0;
+
+#ifdef ATOM_SIMD_X86
+        if (simd_kernel::has_popcnt()) {
+            result = count_relaxed_popcnt(data, full_blocks);
+        }
+        else
+#endif
+        {
+            result = count_relaxed(data, full_blocks);
+        }
+
+        if (bits_.size() % BIT_BLOCK_SIZE) {
+            const bit_container_type word = __atomic_load_n(data + full_blocks, __ATOMIC_RELAXED) & valid_mask(full_blocks);
+            result += static_cast<size_type>(__builtin_popcountll(word));
+        }
+
+        return result;
+    }
+
+    inline void atomic_bitset_t::dump(const char* file,
+                                      const char* function_name,
+                                      int         line_number,
+                                      const char* output_file) const {
+
+        std::ofstream fout(output_file, std::ios_base::app);
+
+        ATOM_BAD_STREAM(!fout.is_open());
+
+        fout << "-------------------\n"
+                "Class atomic_bitset_t:\n"
+                "time: "     << __TIME__      << "\n"
+                "file: "     << file          << "\n"
+                "function: " << function_name << "\n"
+                "line: "     << line_number   << "\n"
+                "status: "   << (is_valid() ? "ok\n{\n" : "FAIL\n{\n");
+        fout << "\tsize: "   << bits_.size()  << "\n"
+                "}\n"
+                "-------------------\n";
+
+        fout.close();
+    }
+
+}
+
+#endif // ATOM_ATOMIC_BITSET_HPP
@@ -0,0 +1,330 @@
+//-----------------------------------------------------------------------------
+//! @file bloom.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Blocked Bloom filter and counting Bloom filter
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_BLOOM_H
+#define ATOM_BLOOM_H 1
+
+#include "bool/bool_space.h"
+#include "vector/vector.h"
+#include "packed_vector/packed_vector.h"
+#include "exceptions.h"
+#include "debug_tools.h"
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @namespace bloom_detail
+    //! @brief Hashing of the Bloom filters
+    //-----------------------------------------------------------------------------
+    namespace bloom_detail {
+
+        //! Finalizer of MurmurHash3, std::hash of integers is the identity
+        inline std::uint64_t mix(std::uint64_t x) noexcept {
+            x ^= x >> 33;
+            x *= 0xFF51AFD7ED558CCDULL;
+            x ^= x >> 33;
+            x *= 0xC4CEB9FE1A85EC53ULL;
+            x ^= x >> 33;
+            return x;
+        }
+
+        //! Number of the block in [0, count_blocks) from the high bits of hash
+        inline std::size_t block_of(const std::uint64_t hash, const std::size_t count_blocks) noexcept {
+            return static_cast<std::size_t>((static_cast<unsigned __int128>(hash) * count_blocks) >> 64);
+        }
+
+        //! Probes inside the block: probe i is the high bits of h * SALT[i], the salts are odd,
+        //! so every probe takes its own bits of the hash (double hashing in a block of 512 bits
+        //! has few different probe patterns and makes more false positives)
+        struct probes_t {
+            std::uint32_t h;
+
+            explicit probes_t(const std::uint64_t hash) noexcept :
+                h(static_cast<std::uint32_t>(hash)) {
+            }
+
+            //! Position in the block of 2^log_size
+            unsigned int operator()(const unsigned int i, const unsigned int log_size) const noexcept {
+                static const std::uint32_t SALT[16] = {
+                    0x47B6137BU, 0x44974D91U, 0x8824AD5BU, 0xA2B7289DU, 0x705495C7U, 0x2DF1424BU, 0x9EFC4947U, 0x5C6BFB31U,
+                    0x9E3779B1U, 0x85EBCA77U, 0xC2B2AE3DU, 0x27D4EB2FU, 0x165667B1U, 0xD3A2646DU, 0xFD7046C5U, 0xB55A4F09U
+                };
+                return (h * SALT[i]) >> (32 - log_size);
+            }
+        };
+
+    }
+
+    //-----------------------------------------------------------------------------
+    //! @class bloom_filter_t
+    //! @brief Set of hashes without false negatives and with rare false positives
+    //! @details Bits are kept in vector_t<bool> and split in blocks of 512 bits (one cache line):
+    //! @details the high bits of the hash choose the block, all k probes fall in it by salted multiplies of the low bits.
+    //! @details Lookup touches one block instead of k random lines, batch lookup prefetches
+    //! @details the blocks of the next keys. False positive rate is a bit higher than the rate of
+    //! @details the classic filter of the same size, with_capacity() sizes the filter by the rate of the blocks
+    //-----------------------------------------------------------------------------
+    class bloom_filter_t {
+    public:
+
+        using size_type = std::size_t; //!< Size type
+
+        static constexpr size_type    BLOCK_BITS = 512; //!< Bits per block
+        static constexpr unsigned int MAX_PROBES = 16;  //!< The biggest k
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @param count_bits Count of the bits, it is rounded up to BLOCK_BITS
+        //! @param k Count of the probes of key
+        //! @throw atom::invalidArgument When count_bits is zero or k is not in [1, MAX_PROBES]
+        //! @throws The same exceptions as the constructor of vector_t<bool>
+        //-----------------------------------------------------------------------------
+        bloom_filter_t(const size_type count_bits, const unsigned int k);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Filter for count_items keys with the expected false positive rate
+        //! @param count_items Expected count of the keys
+        //! @param false_positive_rate Rate in (0, 1)
+        //! @throw atom::invalidArgument When count_items is zero or rate is not in (0, 1)
+        //! @throws The same exceptions as the constructor of vector_t<bool>
+        //! @return New filter
+        //-----------------------------------------------------------------------------
+        static bloom_filter_t with_capacity(const size_type count_items, const double false_positive_rate);
+
+        //-----------------------------------------------------------------------------
+        //! @brief 64-bit hash of the key for insert() and contains()
+        //! @details std::hash is mixed, because it is the identity for integers
+        //! @tparam Key Type of the key, std::hash<Key> must exist
+        //-----------------------------------------------------------------------------
+        template<typename Key>
+        static std::uint64_t hash(const Key& key) {
+            return bloom_detail::mix(static_cast<std::uint64_t>(std::hash<Key>()(key)));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Add the hash
+        //! @param hash Hash of the key, see hash()
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when filter is not valid
+        //-----------------------------------------------------------------------------
+        void insert(const std::uint64_t hash);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Check the hash
+        //! @param hash Hash of the key, see hash()
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when filter is not valid
+        //! @return False if hash was not inserted, true if it was inserted or on false positive
+        //-----------------------------------------------------------------------------
+        bool contains(const std::uint64_t hash) const;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Check n hashes
+        //! @details Blocks of the next keys are prefetched while the current ones are checked,
+        //! @details so misses of the cache overlap
+        //! @param hashes Pointer on the first hash
+        //! @param n Count of the hashes
+        //! @param result Bit i is contains(hashes[i]), it is resized to n
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when filter is not valid
+        //! @throws The same exceptions as vector_t<bool>::resize()
+        //-----------------------------------------------------------------------------
+        void contains(const std::uint64_t* hashes, const size_type n, vector_t<bool>& result) const;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Add the hashes of that
+        //! @details Blocks are combined by vector_t<bool>::operator|=()
+        //! @param that Filter with the same count of bits and k
+        //! @throw atom::invalidArgument When size or k of that are other
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when filter is not valid
+        //! @return Reference to the calling object
+        //-----------------------------------------------------------------------------
+        bloom_filter_t& operator|=(const bloom_filter_t& that);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Write the filter: k, count of the blocks and the words of the bits
+        //! @details Integers are written in the byte order of the processor
+        //! @param out Output stream
+        //! @throw atom::badStream When writing fails
+        //-----------------------------------------------------------------------------
+        void write(std::ostream& out) const;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Read the filter written by write()
+        //! @param in Input stream
+        //! @throw atom::badStream When reading fails or the header is wrong
+        //! @throws The same exceptions as the constructor
+        //! @return New filter
+        //-----------------------------------------------------------------------------
+        static bloom_filter_t read(std::istream& in);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the bits
+        //-----------------------------------------------------------------------------
+        size_type size() const noexcept {
+            return bits_.size();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the probes of key
+        //-----------------------------------------------------------------------------
+        unsigned int k() const noexcept {
+            return k_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Bits of the filter
+        //-----------------------------------------------------------------------------
+        const vector_t<bool>& bits() const noexcept {
+            return bits_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Silent verifier
+        //! @return True if filter is valid else return false
+        //-----------------------------------------------------------------------------
+        bool is_valid() const noexcept {
+            return this &&
+                    bits_.is_valid() &&
+                    k_ && k_ <= MAX_PROBES &&
+                    bits_.size() && bits_.size() % BLOCK_BITS == 0;
+        }
+
+    private:
+
+        static constexpr size_type    BLOCK_WORDS = BLOCK_BITS / BIT_BLOCK_SIZE;
+        static constexpr size_type    BATCH       = 16;
+        static constexpr unsigned int LOG_BLOCK   = 9;
+
+        vector_t<bool> bits_;
+        unsigned int   k_;
+
+        const bit_container_type* block(const std::uint64_t hash) const noexcept {
+            return bits_.data() + bloom_detail::block_of(hash, bits_.size() / BLOCK_BITS) * BLOCK_WORDS;
+        }
+
+        bit_container_type* block(const std::uint64_t hash) noexcept {
+            return bits_.data() + bloom_detail::block_of(hash, bits_.size() / BLOCK_BITS) * BLOCK_WORDS;
+        }
+
+        bool contains_in(const bit_container_type* block, const std::uint64_t hash) const noexcept;
+
+        static double blocked_rate(const double bits_per_key, const unsigned int k);
+
+        void dump(const char* file,
+                  const char* function_name,
+                  int         line_number,
+                  const char* output_file = "__bloom_dump.txt") const;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! @class counting_bloom_filter_t
+    //! @brief Bloom filter which supports erase()
+    //! @details Every bit is a 4-bit counter of packed_vector_t<4>, blocks are 128 counters
+    //! @details (one cache line) with the same hashing as bloom_filter_t.
+    //! @details Counter stops at 15 and is not decremented after that, so erase() never makes
+    //! @details false negatives for the keys which were inserted
+    //-----------------------------------------------------------------------------
+    class counting_bloom_filter_t {
+    public:
+
+        using size_type = std::size_t; //!< Size type
+
+        static constexpr size_type    BLOCK_COUNTERS = 128; //!< Counters per block
+        static constexpr unsigned int MAX_PROBES     = 16;  //!< The biggest k
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @param count_counters Count of the counters, it is rounded up to BLOCK_COUNTERS
+        //! @param k Count of the probes of key
+        //! @throw atom::invalidArgument When count_counters is zero or k is not in [1, MAX_PROBES]
+        //! @throws The same exceptions as packed_vector_t::push_back()
+        //-----------------------------------------------------------------------------
+        counting_bloom_filter_t(const size_type count_counters, const unsigned int k);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Add the hash
+        //! @param hash Hash of the key, see bloom_filter_t::hash()
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when filter is not valid
+        //-----------------------------------------------------------------------------
+        void insert(const std::uint64_t hash);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Remove the hash which was inserted
+        //! @param hash Hash of the key, see bloom_filter_t::hash()
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when filter is not valid
+        //! @return False if hash is not in the filter, then nothing is changed
+        //-----------------------------------------------------------------------------
+        bool erase(const std::uint64_t hash);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Check the hash
+        //! @param hash Hash of the key, see bloom_filter_t::hash()
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when filter is not valid
+        //! @return False if hash is not in the filter, true if it is or on false positive
+        //-----------------------------------------------------------------------------
+        bool contains(const std::uint64_t hash) const;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the counters
+        //-----------------------------------------------------------------------------
+        size_type size() const noexcept {
+            return counters_.size();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the probes of key
+        //-----------------------------------------------------------------------------
+        unsigned int k() const noexcept {
+            return k_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Silent verifier
+        //! @return True if filter is valid else return false
+        //-----------------------------------------------------------------------------
+        bool is_valid() const noexcept {
+            return this &&
+                    counters_.is_valid() &&
+                    k_ && k_ <= MAX_PROBES &&
+                    counters_.size() && counters_.size() % BLOCK_COUNTERS == 0;
+        }
+
+    private:
+
+        static constexpr unsigned int LOG_BLOCK = 7;
+
+        packed_vector_t<4> counters_;
+        unsigned int       k_;
+
+        size_type first_counter(const std::uint64_t hash) const noexcept {
+            return bloom_detail::block_of(hash, counters_.size() / BLOCK_COUNTERS) * BLOCK_COUNTERS;
+        }
+
+        void dump(const char* file,
+                  const char* function_name,
+                  int         line_number,
+                  const char* output_file = "__bloom_dump.txt") const;
+    };
+
+}
+
+#include "implement/bloom.hpp"
+
+#endif // ATOM_BLOOM_H
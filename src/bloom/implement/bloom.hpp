@@ -0,0 +1,278 @@
+#ifndef ATOM_BLOOM_HPP
+#define ATOM_BLOOM_HPP 1
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include "exceptions.h"
+#include "debug_tools.h"
+
+namespace atom {
+
+    inline bloom_filter_t::bloom_filter_t(const size_type count_bits, const unsigned int k) :
+        bits_(),
+        k_   (k) {
+
+        ATOM_INVALID_ARGUMENT(!count_bits || !k || k > MAX_PROBES);
+
+        bits_.resize(div_ceil(count_bits, BLOCK_BITS) * BLOCK_BITS, false);
+    }
+
+    inline double bloom_filter_t::blocked_rate(const double bits_per_key, const unsigned int k) {
+        // Count of the keys in the block is Poisson with mean BLOCK_BITS / bits_per_key,
+        // the block of j keys answers yes with the rate of the classic filter of BLOCK_BITS bits
+        const double mean = BLOCK_BITS / bits_per_key;
+        const double last = mean + 10 * std::sqrt(mean) + 10;
+        double       pmf  = std::exp(-mean);
+        double       rate = 0;
+
+        for (double j = 0; j <= last; ++j) {
+            rate += pmf * std::pow(1 - std::pow(1 - 1.0 / BLOCK_BITS, k * j), k);
+            pmf  *= mean / (j + 1);
+        }
+        return rate;
+    }
+
+    inline bloom_filter_t bloom_filter_t::with_capacity(const size_type count_items, const double false_positive_rate) {
+        ATOM_INVALID_ARGUMENT(!count_items || !(false_positive_rate > 0 && false_positive_rate < 1));
+
+        // Start from the size of the classic filter and grow it by 5% until the blocked filter
+        // with the best k reaches the rate: overfull blocks make its rate higher
+        const double ln2          = std::log(2.0);
+        double       bits_per_key = -std::log(false_positive_rate) / (ln2 * ln2);
+        unsigned int best_k       = 1;
+
+        for (int step = 0; step < 100; ++step, bits_per_key *= 1.05) {
+            double best_rate = 1;
+            for (unsigned int k = 1; k <= MAX_PROBES; ++k) {
+                const double rate = blocked_rate(bits_per_key, k);
+                if (rate < best_rate) {
+                    best_rate = rate;
+                    best_k    = k;
+                }
+            }
+
+            if (best_rate <= false_positive_rate) {
+                break;
+            }
+        }
+
+        return bloom_filter_t(static_cast<size_type>(std::ceil(bits_per_key * count_items)), best_k);
+    }
+
+    inline bool bloom_filter_t::contains_in(const bit_container_type* block, const std::uint64_t hash) const noexcept {
+        const bloom_detail::probes_t probes(hash);
+        bit_container_type           result = 1;
+
+        // Without early exit: the answer of a random key is unpredictable, the branch costs more than the probes
+        for (unsigned int i = 0; i < k_; ++i) {
+            const unsigned int pos = probes(i, LOG_BLOCK);
+            result &= block[pos / BIT_BLOCK_SIZE] >> (pos % BIT_BLOCK_SIZE);
+        }
+        return result & 1;
+    }
+
+    inline void bloom_filter_t::insert(const std::uint64_t hash) {
+        ATOM_ASSERT_VALID(this);
+
+        bit_container_type*          words = block(hash);
+        const bloom_detail::probes_t probes(hash);
+
+        for (unsigned int i = 0; i < k_; ++i) {
+            const unsigned int pos = probes(i, LOG_BLOCK);
+            words[pos / BIT_BLOCK_SIZE] |= ONE << (pos % BIT_BLOCK_SIZE);
+        }
+    }
+
+    inline bool bloom_filter_t::contains(const std::uint64_t hash) const {
+        ATOM_ASSERT_VALID(this);
+        return contains_in(block(hash), hash);
+    }
+
+    inline void bloom_filter_t::contains(const std::uint64_t* hashes, const size_type n, vector_t<bool>& result) const {
+        ATOM_ASSERT_VALID(this);
+
+        result.resize(n, false);
+
+        for (size_type i = 0; i < n && i < BATCH; ++i) {
+            __builtin_prefetch(block(hashes[i]));
+            __builtin_prefetch(block(hashes[i]) + BLOCK_WORDS - 1);
+        }
+
+        // Answers are collected in a word and stored by blocks of the result
+        for (size_type first = 0; first < n; first += BIT_BLOCK_SIZE) {
+            const size_type    count = std::min(BIT_BLOCK_SIZE, n - first);
+            bit_container_type word  = 0;
+
+            for (size_type j = 0; j < count; ++j) {
+                const size_type i = first + j;
+
+                if (i + BATCH < n) {
+                    __builtin_prefetch(block(hashes[i + BATCH]));
+                    __builtin_prefetch(block(hashes[i + BATCH]) + BLOCK_WORDS - 1);
+                }
+                word |= static_cast<bit_container_type>(contains_in(block(hashes[i]), hashes[i])) << j;
+            }
+
+            store_bits(result.data(), first, count, word);
+        }
+    }
+
+    inline bloom_filter_t& bloom_filter_t::operator|=(const bloom_filter_t& that) {
+        ATOM_ASSERT_VALID(this);
+        ATOM_ASSERT_VALID(&that);
+        ATOM_INVALID_ARGUMENT(bits_.size() != that.bits_.size() || k_ != that.k_);
+
+        bits_ |= that.bits_;
+
+        return *this;
+    }
+
+    inline void bloom_filter_t::write(std::ostream& out) const {
+        ATOM_ASSERT_VALID(this);
+
+        const std::uint32_t k            = k_;
+        const std::uint64_t count_blocks = bits_.size() / BLOCK_BITS;
+
+        out.write(reinterpret_cast<const char*>(&k), sizeof(k));
+        out.write(reinterpret_cast<const char*>(&count_blocks), sizeof(count_blocks));
+        out.write(reinterpret_cast<const char*>(bits_.data()), count_blocks * BLOCK_WORDS * sizeof(bit_container_type));
+
+        ATOM_BAD_STREAM(!out);
+    }
+
+    inline bloom_filter_t bloom_filter_t::read(std::istream& in) {
+        std::uint32_t k            = 0;
+        std::uint64_t count_blocks = 0;
+
+        in.read(reinterpret_cast<char*>(&k), sizeof(k));
+        in.read(reinterpret_cast<char*>(&count_blocks), sizeof(count_blocks));
+
+        ATOM_BAD_STREAM(!in || !k || k > MAX_PROBES || !count_blocks ||
+                        count_blocks > ~size_type(0) / BLOCK_BITS);
+
+        bloom_filter_t result(static_cast<size_type>(count_blocks) * BLOCK_BITS, k);
+
+        in.read(reinterpret_cast<char*>(result.bits_.data()), count_blocks * BLOCK_WORDS * sizeof(bit_container_type));
+
+        ATOM_BAD_STREAM(!in);
+        return result;
+    }
+
+    inline void bloom_filter_t::dump(const char* file,
+                                     const char* function_name,
+                                     int         line_number,
+                                     const char* output_file) const {
+
+        std::ofstream fout(output_file, std::ios_base::app);
+
+        ATOM_BAD_STREAM(!fout.is_open());
+
+        fout << "-------------------\n"
+                "Class bloom_filter_t:\n"
+                "time: "     << __TIME__      << "\n"
+                "file: "     << file          << "\n"
+                "function: " << function_name << "\n"
+                "line: "     << line_number   << "\n"
+                "status: "   << (is_valid() ? "ok\n{\n" : "FAIL\n{\n");
+        fout << "\tsize: "   << bits_.size()  << "\n"
+                "\tk: "      << k_            << "\n"
+                "}\n"
+                "-------------------\n";
+
+        fout.close();
+    }
+
+    inline counting_bloom_filter_t::counting_bloom_filter_t(const size_type count_counters, const unsigned int k) :
+        counters_(),
+        k_       (k) {
+
+        ATOM_INVALID_ARGUMENT(!count_counters || !k || k > MAX_PROBES);
+
+        const size_type size = div_ceil(count_counters, BLOCK_COUNTERS) * BLOCK_COUNTERS;
+
+        counters_.reserve(size);
+        for (size_type i = 0; i < size; ++i) {
+            counters_.push_back(0);
+        }
+    }
+
+    inline void counting_bloom_filter_t::insert(const std::uint64_t hash) {
+        ATOM_ASSERT_VALID(this);
+
+        const size_type              first = first_counter(hash);
+        const bloom_detail::probes_t probes(hash);
+
+        for (unsigned int i = 0; i < k_; ++i) {
+            const size_type     pos   = first + probes(i, LOG_BLOCK);
+            const std::uint32_t value = counters_.get(pos);
+
+            if (value < counters_.max_value()) {
+                counters_.set(pos, value + 1);
+            }
+        }
+    }
+
+    inline bool counting_bloom_filter_t::erase(const std::uint64_t hash) {
+        ATOM_ASSERT_VALID(this);
+
+        if (!contains(hash)) {
+            return false;
+        }
+
+        const size_type              first = first_counter(hash);
+        const bloom_detail::probes_t probes(hash);
+
+        for (unsigned int i = 0; i < k_; ++i) {
+            const size_type     pos   = first + probes(i, LOG_BLOCK);
+            const std::uint32_t value = counters_.get(pos);
+
+            // Saturated counter does not know how many keys it counts
+            if (value < counters_.max_value()) {
+                counters_.set(pos, value - 1);
+            }
+        }
+        return true;
+    }
+
+    inline bool counting_bloom_filter_t::contains(const std::uint64_t hash) const {
+        ATOM_ASSERT_VALID(this);
+
+        const size_type              first = first_counter(hash);
+        const bloom_detail::probes_t probes(hash);
+
+        for (unsigned int i = 0; i < k_; ++i) {
+            if (!counters_.get(first + probes(i, LOG_BLOCK))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    inline void counting_bloom_filter_t::dump(const char* file,
+                                              const char* function_name,
+                                              int         line_number,
+                                              const char* output_file) const {
+
+        std::ofstream fout(output_file, std::ios_base::app);
+
+        ATOM_BAD_STREAM(!fout.is_open());
+
+        fout << "-------------------\n"
+                "Class counting_bloom_filter_t:\n"
+                "time: "     << __TIME__         << "\n"
+                "file: "     << file             << "\n"
+                "function: " << function_name    << "\n"
+                "line: "     << line_number      << "\n"
+                "status: "   << (is_valid() ? "ok\n{\n" : "FAIL\n{\n");
+        fout << "\tsize: "   << counters_.size() << "\n"
+                "\tk: "      << k_               << "\n"
+                "}\n"
+                "-------------------\n";
+
+        fout.close();
+    }
+
+}
+
+#endif // ATOM_BLOOM_HPP
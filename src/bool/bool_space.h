@@ -1,7 +1,10 @@
 #ifndef ATOM_BOOL_SPACE_H
 #define ATOM_BOOL_SPACE_H
 
-#include <cmath>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include "simd/simd.h"
 
 
 namespace atom {
@@ -13,20 +16,21 @@ namespace atom {
     const bit_container_type ONE            = 1;
 
 
+    // Integer division rounded up: exact for any size_t, without the round trip through double
     inline constexpr std::size_t div_ceil(const std::size_t dividend,
                                           const std::size_t divider) {
 
-        return std::ceil(static_cast<double>(dividend) / divider);
+        return dividend / divider + (dividend % divider != 0);
     }
 
     template<typename Tp>
-    inline bool last_bit(const Tp x) {
+    inline constexpr bool last_bit(const Tp x) {
         return x & 1;
     }
 
     template<typename Tp>
-    inline bool get_n_bit(const Tp x,
-                          const std::size_t n) {
+    inline constexpr bool get_n_bit(const Tp x,
+                                    const std::size_t n) {
 
         return last_bit(x >> n);
     }
@@ -43,12 +47,230 @@ namespace atom {
 
         const std::size_t end = size % bit_block_size;
 
-        for (std::size_t i = 0; i < end; ++i) {
-            if (get_n_bit(src[count_full_blocks], i)) {
-                dst[count_full_blocks] |= static_cast<Tp>(1) << i;
+        if (end) {
+            // The other bits of the last block are kept
+            const Tp mask = (static_cast<Tp>(1) << end) - 1;
+
+            dst[count_full_blocks] = (dst[count_full_blocks] & ~mask) | (src[count_full_blocks] & mask);
+        }
+    }
+
+    // Position of the first set bit in [from, size), size when there is no such bit
+    inline constexpr std::size_t find_next_bit(const bit_container_type* data,
+                                               const std::size_t         size,
+                                               const std::size_t         from) {
+
+        if (from >= size) {
+            return size;
+        }
+
+        const std::size_t  count_blocks = div_ceil(size, BIT_BLOCK_SIZE);
+        std::size_t        block        = from / BIT_BLOCK_SIZE;
+        bit_container_type word         = data[block] & (~bit_container_type(0) << (from % BIT_BLOCK_SIZE));
+
+        while (!word) {
+            if (++block == count_blocks) {
+                return size;
+            }
+            word = data[block];
+        }
+
+        const std::size_t pos = block * BIT_BLOCK_SIZE + static_cast<std::size_t>(__builtin_ctzll(word));
+        return pos < size ? pos : size;
+    }
+
+    // Position of the last set bit in [0, before), size when there is no such bit
+    inline constexpr std::size_t find_prev_bit(const bit_container_type* data,
+                                               const std::size_t         size,
+                                               const std::size_t         before) {
+
+        const std::size_t end = before < size ? before : size;
+
+        if (!end) {
+            return size;
+        }
+
+        std::size_t        block = (end - 1) / BIT_BLOCK_SIZE;
+        bit_container_type word  = data[block] & (~bit_container_type(0) >> (BIT_BLOCK_SIZE - 1 - (end - 1) % BIT_BLOCK_SIZE));
+
+        while (!word) {
+            if (!block) {
+                return size;
+            }
+            word = data[--block];
+        }
+
+        return block * BIT_BLOCK_SIZE + BIT_BLOCK_SIZE - 1 - static_cast<std::size_t>(__builtin_clzll(word));
+    }
+
+    // Calls fn(pos) for every set bit in [0, size) in ascending order
+    template<typename Fn>
+    constexpr void for_each_set_bit(const bit_container_type* data,
+                                    const std::size_t         size,
+                                    Fn&&                      fn) {
+
+        const std::size_t count_blocks = size / BIT_BLOCK_SIZE;
+        const std::size_t remain_bits  = size % BIT_BLOCK_SIZE;
+
+        for (std::size_t block = 0; block <= count_blocks; ++block) {
+            bit_container_type word = 0;
+
+            if (block < count_blocks) {
+                word = data[block];
+            }
+            else if (remain_bits) {
+                word = data[block] & ((ONE << remain_bits) - 1);
             }
             else {
-                dst[count_full_blocks] &= ~(static_cast<Tp>(1) << i);
+                break;
+            }
+
+            for (; word; word &= word - 1) {
+                fn(block * BIT_BLOCK_SIZE + static_cast<std::size_t>(__builtin_ctzll(word)));
+            }
+        }
+    }
+
+    // Sets bits [first, last), the other bits of the blocks are not changed
+    inline constexpr void set_bit_range(bit_container_type* data,
+                                        const std::size_t   first,
+                                        const std::size_t   last) {
+
+        if (first >= last) {
+            return;
+        }
+
+        const std::size_t        first_block = first / BIT_BLOCK_SIZE;
+        const std::size_t        last_block  = (last - 1) / BIT_BLOCK_SIZE;
+        const bit_container_type first_mask  = ~bit_container_type(0) << (first % BIT_BLOCK_SIZE);
+        const bit_container_type last_mask   = ~bit_container_type(0) >> (BIT_BLOCK_SIZE - 1 - (last - 1) % BIT_BLOCK_SIZE);
+
+        if (first_block == last_block) {
+            data[first_block] |= first_mask & last_mask;
+            return;
+        }
+
+        data[first_block] |= first_mask;
+        for (std::size_t block = first_block + 1; block < last_block; ++block) {
+            data[block] = ~bit_container_type(0);
+        }
+        data[last_block] |= last_mask;
+    }
+
+    // Bits [pos, pos + n) as the low bits of the word, n in [1, 64]
+    inline constexpr bit_container_type load_bits(const bit_container_type* data,
+                                                  const std::size_t         pos,
+                                                  const std::size_t         n) {
+
+        const std::size_t  block  = pos / BIT_BLOCK_SIZE;
+        const std::size_t  offset = pos % BIT_BLOCK_SIZE;
+        bit_container_type word   = data[block] >> offset;
+
+        if (offset + n > BIT_BLOCK_SIZE) {
+            word |= data[block + 1] << (BIT_BLOCK_SIZE - offset);
+        }
+        return n == BIT_BLOCK_SIZE ? word : word & ((ONE << n) - 1);
+    }
+
+    // Writes the low n bits of word to [pos, pos + n), the range must not cross the block
+    inline constexpr void store_bits(bit_container_type*      data,
+                                     const std::size_t        pos,
+                                     const std::size_t        n,
+                                     const bit_container_type word) {
+
+        const std::size_t        offset = pos % BIT_BLOCK_SIZE;
+        const bit_container_type mask   = (n == BIT_BLOCK_SIZE ? ~bit_container_type(0) : (ONE << n) - 1) << offset;
+
+        data[pos / BIT_BLOCK_SIZE] = (data[pos / BIT_BLOCK_SIZE] & ~mask) | ((word << offset) & mask);
+    }
+
+    // Copies [src_pos, src_pos + n) of src to [dst_pos, dst_pos + n) of dst, the other bits of dst are kept.
+    // Ranges must not overlap unless dst_pos <= src_pos in the same buffer: blocks are written in ascending order.
+    // The head aligns dst, then every block of dst is a funnel shift of two source blocks, then the tail
+    inline void copy_bit_range(bit_container_type*       dst,
+                               std::size_t               dst_pos,
+                               const bit_container_type* src,
+                               std::size_t               src_pos,
+                               std::size_t               n) {
+
+        if (!n) {
+            return;
+        }
+
+        if (dst_pos % BIT_BLOCK_SIZE) {
+            const std::size_t head = std::min(BIT_BLOCK_SIZE - dst_pos % BIT_BLOCK_SIZE, n);
+
+            store_bits(dst, dst_pos, head, load_bits(src, src_pos, head));
+            dst_pos += head;
+            src_pos += head;
+            n       -= head;
+        }
+
+        const std::size_t  count_blocks = n / BIT_BLOCK_SIZE;
+        const unsigned int shift        = static_cast<unsigned int>(src_pos % BIT_BLOCK_SIZE);
+
+        if (count_blocks && shift) {
+            simd_shift_right_words(dst + dst_pos / BIT_BLOCK_SIZE, src + src_pos / BIT_BLOCK_SIZE, count_blocks, shift);
+        }
+        else if (count_blocks) {
+            memmove(dst + dst_pos / BIT_BLOCK_SIZE, src + src_pos / BIT_BLOCK_SIZE, count_blocks * sizeof(bit_container_type));
+        }
+
+        dst_pos += count_blocks * BIT_BLOCK_SIZE;
+        src_pos += count_blocks * BIT_BLOCK_SIZE;
+        n       -= count_blocks * BIT_BLOCK_SIZE;
+
+        if (n) {
+            store_bits(dst, dst_pos, n, load_bits(src, src_pos, n));
+        }
+    }
+
+    // memmove() for bits: moves [src, src + n) to [dst, dst + n), the other bits are kept.
+    // The destination is filled by whole blocks, every block is a funnel shift of two source blocks
+    inline void move_bits(bit_container_type* data,
+                          std::size_t         dst,
+                          std::size_t         src,
+                          std::size_t         n) {
+
+        if (!n || dst == src) {
+            return;
+        }
+
+        if (dst < src) {
+            copy_bit_range(data, dst, data, src, n);
+        }
+        else {
+            // Descending: the head aligns the end of dst, then whole blocks, then the tail
+            std::size_t dst_end = dst + n;
+            std::size_t src_end = src + n;
+
+            if (dst_end % BIT_BLOCK_SIZE) {
+                const std::size_t head = std::min(dst_end % BIT_BLOCK_SIZE, n);
+
+                dst_end -= head;
+                src_end -= head;
+                n       -= head;
+                store_bits(data, dst_end, head, load_bits(data, src_end, head));
+            }
+
+            const std::size_t count_blocks = n / BIT_BLOCK_SIZE;
+
+            dst_end -= count_blocks * BIT_BLOCK_SIZE;
+            src_end -= count_blocks * BIT_BLOCK_SIZE;
+            n       -= count_blocks * BIT_BLOCK_SIZE;
+
+            const unsigned int shift = static_cast<unsigned int>(src_end % BIT_BLOCK_SIZE);
+
+            if (count_blocks && shift) {
+                simd_shift_left_words(data + dst_end / BIT_BLOCK_SIZE, data + src_end / BIT_BLOCK_SIZE + 1,
+                                      count_blocks, BIT_BLOCK_SIZE - shift);
+            }
+            else if (count_blocks) {
+                memmove(data + dst_end / BIT_BLOCK_SIZE, data + src_end / BIT_BLOCK_SIZE, count_blocks * sizeof(bit_container_type));
+            }
+
+            if (n) {
+                store_bits(data, dst, n, load_bits(data, src, n));
             }
         }
     }
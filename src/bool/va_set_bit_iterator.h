@@ -0,0 +1,181 @@
+//-----------------------------------------------------------------------------
+//! @file va_set_bit_iterator.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Iterator over the positions of the set bits of bool array or vector
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_VA_SET_BIT_ITERATOR_H
+#define ATOM_VA_SET_BIT_ITERATOR_H 1
+
+#include "bool_space.h"
+#include <cstddef>
+#include <iterator>
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @class va_set_bit_iterator
+    //! @brief Forward iterator which yields positions of the set bits in ascending order
+    //! @details Keeps the not visited bits of the current block, so increment is
+    //! @details one tzcnt and one blsr while the block has set bits
+    //! @details Iterator is invalidated by any change of the container
+    //-----------------------------------------------------------------------------
+    class va_set_bit_iterator {
+    public:
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::size_t;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const std::size_t*;
+        using reference         = std::size_t;             //!< Positions are returned by value
+
+        //-----------------------------------------------------------------------------
+        //! @brief Default constructor
+        //-----------------------------------------------------------------------------
+        va_set_bit_iterator() noexcept :
+            data_        (nullptr),
+            size_        (0),
+            count_blocks_(0),
+            block_       (0),
+            word_        (0) {
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @details Iterator on the first set bit, it is equal to end when there are no set bits
+        //! @param data Pointer on the first block
+        //! @param size Count of bits
+        //-----------------------------------------------------------------------------
+        va_set_bit_iterator(const bit_container_type* data,
+                            const std::size_t         size) noexcept :
+            data_        (data),
+            size_        (size),
+            count_blocks_(div_ceil(size, BIT_BLOCK_SIZE)),
+            block_       (0),
+            word_        (count_blocks_ ? load(0) : 0) {
+
+            skip_empty();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Iterator behind the last set bit
+        //! @param data Pointer on the first block
+        //! @param size Count of bits
+        //! @return End iterator
+        //-----------------------------------------------------------------------------
+        static va_set_bit_iterator end(const bit_container_type* data,
+                                       const std::size_t         size) noexcept {
+            va_set_bit_iterator result;
+
+            result.data_         = data;
+            result.size_         = size;
+            result.count_blocks_ = div_ceil(size, BIT_BLOCK_SIZE);
+            result.block_        = result.count_blocks_;
+
+            return result;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Position of the current set bit
+        //-----------------------------------------------------------------------------
+        reference operator*() const noexcept {
+            return block_ * BIT_BLOCK_SIZE + static_cast<std::size_t>(__builtin_ctzll(word_));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Move to the next set bit
+        //-----------------------------------------------------------------------------
+        va_set_bit_iterator& operator++() noexcept {
+            word_ &= word_ - 1;
+            skip_empty();
+
+            return *this;
+        }
+
+        va_set_bit_iterator operator++(int) noexcept {
+            va_set_bit_iterator old = *this;
+            ++(*this);
+
+            return old;
+        }
+
+        friend bool operator==(const va_set_bit_iterator& lhs, const va_set_bit_iterator& rhs) noexcept {
+            return lhs.block_ == rhs.block_ && lhs.word_ == rhs.word_;
+        }
+
+        friend bool operator!=(const va_set_bit_iterator& lhs, const va_set_bit_iterator& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+    private:
+
+        const bit_container_type* data_;
+        std::size_t               size_;
+        std::size_t               count_blocks_;
+        std::size_t               block_;        //!< Number of the current block
+        bit_container_type        word_;         //!< Not visited set bits of the current block
+
+        //-----------------------------------------------------------------------------
+        //! @brief Block without bits behind the size
+        //-----------------------------------------------------------------------------
+        bit_container_type load(const std::size_t block) const noexcept {
+            const std::size_t remain_bits = size_ % BIT_BLOCK_SIZE;
+
+            if (block + 1 == count_blocks_ && remain_bits) {
+                return data_[block] & ((ONE << remain_bits) - 1);
+            }
+            return data_[block];
+        }
+
+        void skip_empty() noexcept {
+            while (!word_ && block_ < count_blocks_) {
+                if (++block_ < count_blocks_) {
+                    word_ = load(block_);
+                }
+            }
+        }
+    };
+
+    //-----------------------------------------------------------------------------
+    //! @class va_set_bit_range
+    //! @brief Range of the set bits for range-for: for (std::size_t pos : mask.set_bits())
+    //-----------------------------------------------------------------------------
+    class va_set_bit_range {
+    public:
+
+        using iterator = va_set_bit_iterator;
+
+        va_set_bit_range(const bit_container_type* data,
+                         const std::size_t         size) noexcept :
+            data_(data),
+            size_(size) {
+        }
+
+        iterator begin() const noexcept {
+            return iterator(data_, size_);
+        }
+
+        iterator end() const noexcept {
+            return iterator::end(data_, size_);
+        }
+
+    private:
+
+        const bit_container_type* data_;
+        std::size_t               size_;
+    };
+
+}
+
+#endif // ATOM_VA_SET_BIT_ITERATOR_H
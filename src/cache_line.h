@@ -0,0 +1,37 @@
+//-----------------------------------------------------------------------------
+//! @file cache_line.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Size of the cache line for the padding of the shared indices
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_CACHE_LINE_H
+#define ATOM_CACHE_LINE_H 1
+
+#include <cstddef>
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @brief Size of the cache line of x86-64 and most of ARM cores
+    //! @details Fields which are written by different threads are aligned to it, otherwise
+    //! @details every write invalidates the line of the other thread (false sharing).
+    //! @details std::hardware_destructive_interference_size is not used: GCC warns that it
+    //! @details depends on -mtune, the value must be the same in all translation units
+    //-----------------------------------------------------------------------------
+    constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+}
+
+#endif // ATOM_CACHE_LINE_H
@@ -0,0 +1,65 @@
+//-----------------------------------------------------------------------------
+//! @file compact.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! In-place compaction of the contiguous elements for erase_if()
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_COMPACT_H
+#define ATOM_COMPACT_H 1
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @brief Move elements which do not satisfy pred to the front in one pass
+    //! @details Order of the kept elements is preserved
+    //! @details Arithmetic types use branchless kernel: every element is stored
+    //! @details and the output position is advanced by the result of pred,
+    //! @details so the loop has no mispredictions on random data
+    //! @details Other types use std::remove_if(), elements behind the result are moved-from
+    //! @tparam Tp The type of the elements
+    //! @tparam Pred Type of the predicate
+    //! @param data Pointer on the first element
+    //! @param n Count of elements
+    //! @param pred Returns true for elements which are removed
+    //! @throws The same exceptions as pred and the move assignment of Tp
+    //! @return Count of the kept elements
+    //-----------------------------------------------------------------------------
+    template<typename Tp, typename Pred>
+    std::size_t compact_if(Tp* data, const std::size_t n, Pred& pred) {
+        if constexpr (std::is_arithmetic<Tp>::value) {
+            std::size_t kept = 0;
+
+            for (std::size_t i = 0; i < n; ++i) {
+                const Tp x = data[i];
+
+                data[kept] = x;
+                kept += !static_cast<bool>(pred(x));
+            }
+
+            return kept;
+        }
+        else {
+            return static_cast<std::size_t>(std::remove_if(data, data + n, std::ref(pred)) - data);
+        }
+    }
+
+}
+
+#endif // ATOM_COMPACT_H
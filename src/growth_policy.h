@@ -0,0 +1,119 @@
+//-----------------------------------------------------------------------------
+//! @file growth_policy.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Policies of the capacity growth for vector_t and small_vector_t
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_GROWTH_POLICY_H
+#define ATOM_GROWTH_POLICY_H 1
+
+#include <cstddef>
+#include <type_traits>
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @details Growth policy is a type with the static function
+    //! @details std::size_t next_capacity(std::size_t current, std::size_t required) noexcept
+    //! @details which returns the new capacity not less than required.
+    //! @details Any such type can be passed as GrowthPolicy, it is a hook for the custom policy.
+    //-----------------------------------------------------------------------------
+
+    //-----------------------------------------------------------------------------
+    //! @struct factor_growth_policy
+    //! @brief Capacity is multiplied by numerator / denominator until it is enough
+    //! @tparam numerator_ Numerator of the factor
+    //! @tparam denominator_ Denominator of the factor
+    //-----------------------------------------------------------------------------
+    template<const std::size_t numerator_, const std::size_t denominator_ = 1>
+    struct factor_growth_policy {
+        static_assert(denominator_ > 0 && numerator_ > denominator_, "Growth factor must be bigger than 1");
+
+        //-----------------------------------------------------------------------------
+        //! @brief Capacity after growth
+        //! @param current Current capacity
+        //! @param required Required capacity
+        //! @return Capacity which is not less than required
+        //-----------------------------------------------------------------------------
+        static constexpr std::size_t next_capacity(const std::size_t current,
+                                                   const std::size_t required) noexcept {
+            std::size_t new_capacity = current ? current : 1;
+
+            while (new_capacity < required) {
+                const std::size_t grown = new_capacity / denominator_ * numerator_ +
+                                          new_capacity % denominator_ * numerator_ / denominator_;
+
+                new_capacity = grown > new_capacity ? grown : new_capacity + 1;
+            }
+
+            return new_capacity;
+        }
+    };
+
+    //-----------------------------------------------------------------------------
+    //! @brief Capacity is doubled, policy by default
+    //-----------------------------------------------------------------------------
+    using doubling_growth_policy = factor_growth_policy<2>;
+
+    //-----------------------------------------------------------------------------
+    //! @brief Capacity is multiplied by 1.5, freed blocks can be reused by the next growth
+    //-----------------------------------------------------------------------------
+    using one_and_half_growth_policy = factor_growth_policy<3, 2>;
+
+    //-----------------------------------------------------------------------------
+    //! @struct fixed_step_growth_policy
+    //! @brief Capacity is increased by step_ elements
+    //! @details Memory overhead is bounded, but growth by push_back is quadratic
+    //! @tparam step_ The number of elements which are added
+    //-----------------------------------------------------------------------------
+    template<const std::size_t step_>
+    struct fixed_step_growth_policy {
+        static_assert(step_ > 0, "Growth step must be positive");
+
+        //-----------------------------------------------------------------------------
+        //! @brief Capacity after growth
+        //! @param current Current capacity
+        //! @param required Required capacity
+        //! @return Capacity which is not less than required
+        //-----------------------------------------------------------------------------
+        static constexpr std::size_t next_capacity(const std::size_t current,
+                                                   const std::size_t required) noexcept {
+            if (required <= current) {
+                return current;
+            }
+
+            return current + (required - current + step_ - 1) / step_ * step_;
+        }
+    };
+
+    //-----------------------------------------------------------------------------
+    //! @struct is_growth_policy
+    //! @brief Checks that type has function next_capacity(current, required)
+    //! @tparam Policy The type which is checked
+    //-----------------------------------------------------------------------------
+    template<typename Policy, typename = void>
+    struct is_growth_policy : std::false_type {
+    };
+
+    template<typename Policy>
+    struct is_growth_policy<Policy,
+                            typename std::enable_if<std::is_convertible<
+                                decltype(Policy::next_capacity(std::size_t(), std::size_t())),
+                                std::size_t>::value>::type> : std::true_type {
+    };
+
+}
+
+#endif // ATOM_GROWTH_POLICY_H
@@ -0,0 +1,188 @@
+//-----------------------------------------------------------------------------
+//! @file hierarchical_bitset.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Bitset with summary levels for sparse search
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_HIERARCHICAL_BITSET_H
+#define ATOM_HIERARCHICAL_BITSET_H 1
+
+#include "bool/bool_space.h"
+#include "vector/vector.h"
+#include "simd/simd.h"
+#include "exceptions.h"
+#include "debug_tools.h"
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @class hierarchical_bitset_t
+    //! @brief Bitset of fixed size which skips empty regions in find_next()
+    //! @details Level 0 keeps the bits in bit_container_type blocks, bit i of level l + 1 is set
+    //! @details when block i of level l is not zero. Summaries are added while the top level is
+    //! @details longer than one block, up to MAX_SUMMARIES (one top block covers 2^24 bits).
+    //! @details set() and reset() update at most one block per level, find_next() goes up
+    //! @details to the first level which has a set bit after pos and down by count-trailing-zeros,
+    //! @details so empty regions cost O(log64 n) instead of one read per 64 bits
+    //-----------------------------------------------------------------------------
+    class hierarchical_bitset_t {
+    public:
+
+        using size_type = std::size_t; //!< Size type
+
+        static constexpr size_type MAX_SUMMARIES = 3; //!< The biggest count of the summary levels
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @param n Count of the bits, all bits are reset
+        //! @throws The same exceptions as the constructor of vector_t
+        //-----------------------------------------------------------------------------
+        explicit hierarchical_bitset_t(const size_type n);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Value of the bit
+        //! @param pos Position of the bit
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitset is not valid
+        //! @throw atom::outOfRange When pos is not less than size()
+        //-----------------------------------------------------------------------------
+        bool test(const size_type pos) const {
+            ATOM_ASSERT_VALID(this);
+            ATOM_OUT_OF_RANGE(pos >= size_);
+
+            return get_n_bit(levels_[0][pos / BIT_BLOCK_SIZE], pos % BIT_BLOCK_SIZE);
+        }
+
+        //! @brief The same as test()
+        bool operator[](const size_type pos) const {
+            return test(pos);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Set the bit
+        //! @details Summary bits are set up to the first level where the block was not zero
+        //! @param pos Position of the bit
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitset is not valid
+        //! @throw atom::outOfRange When pos is not less than size()
+        //-----------------------------------------------------------------------------
+        void set(size_type pos);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Reset the bit
+        //! @details Summary bits are reset up to the first level where the block stays not zero
+        //! @param pos Position of the bit
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitset is not valid
+        //! @throw atom::outOfRange When pos is not less than size()
+        //-----------------------------------------------------------------------------
+        void reset(size_type pos);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Position of the first set bit
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitset is not valid
+        //! @return Position of the bit, size() when there are no set bits
+        //-----------------------------------------------------------------------------
+        size_type find_first() const {
+            ATOM_ASSERT_VALID(this);
+            return find_from(0);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Position of the first set bit after pos
+        //! @param pos Position to start after, it can be greater than size()
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitset is not valid
+        //! @return Position of the bit, size() when there are no set bits after pos
+        //-----------------------------------------------------------------------------
+        size_type find_next(const size_type pos) const {
+            ATOM_ASSERT_VALID(this);
+            return pos + 1 < size_ ? find_from(pos + 1) : size_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the set bits
+        //! @details Blocks of level 0 are counted by simd_popcount()
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitset is not valid
+        //-----------------------------------------------------------------------------
+        size_type count() const {
+            ATOM_ASSERT_VALID(this);
+            return simd_popcount(levels_[0].data(), levels_[0].size());
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Checks the bitset on the set bits in O(1)
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitset is not valid
+        //-----------------------------------------------------------------------------
+        bool none() const {
+            ATOM_ASSERT_VALID(this);
+            return find_next_bit(levels_[count_levels_ - 1].data(), BIT_BLOCK_SIZE * levels_[count_levels_ - 1].size(), 0) ==
+                   BIT_BLOCK_SIZE * levels_[count_levels_ - 1].size();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the bits
+        //-----------------------------------------------------------------------------
+        size_type size() const noexcept {
+            return size_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the levels with level 0
+        //-----------------------------------------------------------------------------
+        size_type count_levels() const noexcept {
+            return count_levels_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Blocks of level 0
+        //! @details Bit pos is (data()[pos / BIT_BLOCK_SIZE] >> pos % BIT_BLOCK_SIZE) & 1, bits behind size() are zero
+        //-----------------------------------------------------------------------------
+        const bit_container_type* data() const noexcept {
+            return levels_[0].data();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Memory of all levels in bytes
+        //-----------------------------------------------------------------------------
+        size_type memory_usage() const noexcept {
+            size_type result = 0;
+            for (size_type level = 0; level < count_levels_; ++level) {
+                result += levels_[level].capacity() * sizeof(bit_container_type);
+            }
+            return result;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Silent verifier
+        //! @return True if bitset is valid else return false
+        //-----------------------------------------------------------------------------
+        bool is_valid() const noexcept;
+
+    private:
+
+        size_type                    size_;
+        size_type                    count_levels_;
+        vector_t<bit_container_type> levels_[MAX_SUMMARIES + 1]; //!< Level 0 is the bits
+
+        size_type find_from(size_type pos) const noexcept;
+
+        void dump(const char* file,
+                  const char* function_name,
+                  int         line_number,
+                  const char* output_file = "__hierarchical_bitset_dump.txt") const;
+    };
+
+}
+
+#include "implement/hierarchical_bitset.hpp"
+
+#endif // ATOM_HIERARCHICAL_BITSET_H
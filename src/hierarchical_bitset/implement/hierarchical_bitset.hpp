@@ -0,0 +1,143 @@
+#ifndef ATOM_HIERARCHICAL_BITSET_HPP
+#define ATOM_HIERARCHICAL_BITSET_HPP 1
+
+#include <fstream>
+#include "exceptions.h"
+#include "debug_tools.h"
+
+namespace atom {
+
+    inline hierarchical_bitset_t::hierarchical_bitset_t(const size_type n) :
+        size_        (n),
+        count_levels_(1),
+        levels_      () {
+
+        levels_[0] = vector_t<bit_container_type>(div_ceil(n, BIT_BLOCK_SIZE), bit_container_type(0));
+
+        while (count_levels_ <= MAX_SUMMARIES && levels_[count_levels_ - 1].size() > 1) {
+            levels_[count_levels_] = vector_t<bit_container_type>(div_ceil(levels_[count_levels_ - 1].size(), BIT_BLOCK_SIZE),
+                                                                  bit_container_type(0));
+            ++count_levels_;
+        }
+    }
+
+    inline void hierarchical_bitset_t::set(size_type pos) {
+        ATOM_ASSERT_VALID(this);
+        ATOM_OUT_OF_RANGE(pos >= size_);
+
+        // pos is the bit of the current level, its block is the bit of the next one
+        for (size_type level = 0; level < count_levels_; ++level) {
+            bit_container_type&      word = levels_[level][pos / BIT_BLOCK_SIZE];
+            const bit_container_type was  = word;
+
+            word |= ONE << (pos % BIT_BLOCK_SIZE);
+            if (was) {
+                return;
+            }
+            pos /= BIT_BLOCK_SIZE;
+        }
+    }
+
+    inline void hierarchical_bitset_t::reset(size_type pos) {
+        ATOM_ASSERT_VALID(this);
+        ATOM_OUT_OF_RANGE(pos >= size_);
+
+        for (size_type level = 0; level < count_levels_; ++level) {
+            bit_container_type& word = levels_[level][pos / BIT_BLOCK_SIZE];
+
+            word &= ~(ONE << (pos % BIT_BLOCK_SIZE));
+            if (word) {
+                return;
+            }
+            pos /= BIT_BLOCK_SIZE;
+        }
+    }
+
+    inline hierarchical_bitset_t::size_type hierarchical_bitset_t::find_from(size_type pos) const noexcept {
+        if (pos >= size_) {
+            return size_;
+        }
+
+        // Up: the rest of the block at each level, then the next block is the bit of the level above
+        const size_type top   = count_levels_ - 1;
+        size_type       level = 0;
+
+        for (; level < top; ++level) {
+            const size_type          block = pos / BIT_BLOCK_SIZE;
+            const bit_container_type word  = levels_[level][block] & (~bit_container_type(0) << (pos % BIT_BLOCK_SIZE));
+
+            if (word) {
+                pos = block * BIT_BLOCK_SIZE + static_cast<size_type>(__builtin_ctzll(word));
+                break;
+            }
+
+            pos = block + 1;
+            if (pos == levels_[level].size()) {
+                return size_;
+            }
+        }
+
+        if (level == top) {
+            // Bits of the top level are the blocks of the level below
+            const size_type count_bits = top ? levels_[top - 1].size() : size_;
+
+            pos = find_next_bit(levels_[top].data(), count_bits, pos);
+            if (pos == count_bits) {
+                return size_;
+            }
+        }
+
+        // Down: the first set bit of the block which is known to be not zero
+        for (; level > 0; --level) {
+            pos = pos * BIT_BLOCK_SIZE + static_cast<size_type>(__builtin_ctzll(levels_[level - 1][pos]));
+        }
+        return pos;
+    }
+
+    inline bool hierarchical_bitset_t::is_valid() const noexcept {
+        if (!this || !count_levels_ || count_levels_ > MAX_SUMMARIES + 1 ||
+            levels_[0].size() != div_ceil(size_, BIT_BLOCK_SIZE)) {
+            return false;
+        }
+
+        for (size_type level = 0; level < count_levels_; ++level) {
+            if (!levels_[level].is_valid() ||
+                (level && levels_[level].size() != div_ceil(levels_[level - 1].size(), BIT_BLOCK_SIZE))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    inline void hierarchical_bitset_t::dump(const char* file,
+                                            const char* function_name,
+                                            int         line_number,
+                                            const char* output_file) const {
+
+        std::ofstream fout(output_file, std::ios_base::app);
+
+        ATOM_BAD_STREAM(!fout.is_open());
+
+        fout << "-------------------\n"
+                "Class hierarchical_bitset_t:\n"
+                "time: "        << __TIME__      << "\n"
+                "file: "        << file          << "\n"
+                "function: "    << function_name << "\n"
+                "line: "        << line_number   << "\n"
+                "status: "      << (is_valid() ? "ok\n{\n" : "FAIL\n{\n");
+        fout << "\tsize: "      << size_         << "\n"
+                "\tlevels: "    << count_levels_ << "\n";
+
+        for (size_type level = 0; level < count_levels_ && level <= MAX_SUMMARIES; ++level) {
+            fout << "\tlevel " << level << " blocks: " << levels_[level].size() << "\n";
+        }
+
+        fout << "}\n"
+                "-------------------\n";
+
+        fout.close();
+    }
+
+}
+
+#endif // ATOM_HIERARCHICAL_BITSET_HPP
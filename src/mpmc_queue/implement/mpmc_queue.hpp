@@ -0,0 +1,151 @@
+#ifndef ATOM_MPMC_QUEUE_HPP
+#define ATOM_MPMC_QUEUE_HPP 1
+
+#include <fstream>
+#include "exceptions.h"
+#include "debug_tools.h"
+
+namespace atom {
+
+    template<typename Tp, std::size_t capacity_>
+    mpmc_queue_t<Tp, capacity_>::mpmc_queue_t() noexcept :
+        producer_(),
+        consumer_() {
+
+        for (size_type i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    template<typename Tp, std::size_t capacity_>
+    mpmc_queue_t<Tp, capacity_>::~mpmc_queue_t() {
+        const size_type tail = producer_.tail.load(std::memory_order_acquire);
+
+        for (size_type head = consumer_.head.load(std::memory_order_relaxed); head != tail; ++head) {
+            std::destroy_at(element(cells_[head & MASK]));
+        }
+    }
+
+    template<typename Tp, std::size_t capacity_>
+    typename mpmc_queue_t<Tp, capacity_>::cell_t*
+    mpmc_queue_t<Tp, capacity_>::claim_push(size_type& pos) noexcept {
+        pos = producer_.tail.load(std::memory_order_relaxed);
+
+        for (;;) {
+            cell_t&              cell     = cells_[pos & MASK];
+            const size_type      sequence = cell.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff     = static_cast<std::ptrdiff_t>(sequence - pos);
+
+            if (!diff) {
+                // The slot is free for pos, the failed CAS loads the new tail into pos
+                if (producer_.tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return &cell;
+                }
+            }
+            else if (diff < 0) {
+                // The element of the previous lap is not popped yet
+                return nullptr;
+            }
+            else {
+                pos = producer_.tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template<typename Tp, std::size_t capacity_>
+    template<typename Arg>
+    bool mpmc_queue_t<Tp, capacity_>::emplace(Arg&& x) {
+        ATOM_ASSERT_VALID(this);
+
+        size_type pos = 0;
+
+        if constexpr (std::is_nothrow_constructible<value_type, Arg&&>::value) {
+            cell_t* cell = claim_push(pos);
+            if (!cell) {
+                return false;
+            }
+
+            ::new (static_cast<void*>(cell->bytes)) value_type(std::forward<Arg>(x));
+            cell->sequence.store(pos + 1, std::memory_order_release);
+        }
+        else {
+            // The constructor which can throw runs before the slot is claimed
+            value_type copy(std::forward<Arg>(x));
+
+            cell_t* cell = claim_push(pos);
+            if (!cell) {
+                return false;
+            }
+
+            ::new (static_cast<void*>(cell->bytes)) value_type(std::move(copy));
+            cell->sequence.store(pos + 1, std::memory_order_release);
+        }
+        return true;
+    }
+
+    template<typename Tp, std::size_t capacity_>
+    bool mpmc_queue_t<Tp, capacity_>::try_pop(value_type& out) {
+        ATOM_ASSERT_VALID(this);
+
+        size_type pos = consumer_.head.load(std::memory_order_relaxed);
+        cell_t*   cell = nullptr;
+
+        for (;;) {
+            cell = &cells_[pos & MASK];
+
+            const size_type      sequence = cell->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff     = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+
+            if (!diff) {
+                if (consumer_.head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (diff < 0) {
+                // The element of pos is not pushed yet
+                return false;
+            }
+            else {
+                pos = consumer_.head.load(std::memory_order_relaxed);
+            }
+        }
+
+        value_type* item = element(*cell);
+
+        out = std::move(*item);
+        std::destroy_at(item);
+
+        // Free for the push of the next lap
+        cell->sequence.store(pos + capacity_, std::memory_order_release);
+        return true;
+    }
+
+    template<typename Tp, std::size_t capacity_>
+    void mpmc_queue_t<Tp, capacity_>::dump(const char* file,
+                                           const char* function_name,
+                                           int         line_number,
+                                           const char* output_file) const {
+
+        std::ofstream fout(output_file, std::ios_base::app);
+
+        ATOM_BAD_STREAM(!fout.is_open());
+
+        fout << "-------------------\n"
+                "Class mpmc_queue_t:\n"
+                "time: "       << __TIME__      << "\n"
+                "file: "       << file          << "\n"
+                "function: "   << function_name << "\n"
+                "line: "       << line_number   << "\n"
+                "status: "     << (is_valid() ? "ok\n{\n" : "FAIL\n{\n");
+        fout << "\thead: "     << consumer_.head.load(std::memory_order_relaxed) << "\n"
+                "\ttail: "     << producer_.tail.load(std::memory_order_relaxed) << "\n"
+                "\tcapacity: " << capacity_     << "\n"
+                "}\n"
+                "-------------------\n";
+
+        fout.close();
+    }
+
+}
+
+#endif // ATOM_MPMC_QUEUE_HPP
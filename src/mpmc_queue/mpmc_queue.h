@@ -0,0 +1,205 @@
+//-----------------------------------------------------------------------------
+//! @file mpmc_queue.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Bounded lock-free queue of many producers and many consumers
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_MPMC_QUEUE_H
+#define ATOM_MPMC_QUEUE_H 1
+
+#include "cache_line.h"
+#include "exceptions.h"
+#include "debug_tools.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @class mpmc_queue_t
+    //! @brief Bounded FIFO queue for any count of producer and consumer threads
+    //! @details Slots are kept inline as the storage of array_t, capacity_ is fixed as max_size_.
+    //! @details Each slot has the sequence number (D. Vyukov's scheme): the slot of position pos is
+    //! @details free for the push of pos when its sequence is pos, and ready for the pop of pos when
+    //! @details it is pos + 1. A thread claims pos by CAS of the shared head or tail, builds or takes
+    //! @details the element and publishes the slot by the release store of the sequence, after the
+    //! @details pop it becomes pos + capacity_ for the push of the next lap. Threads do not wait
+    //! @details for each other on the shared indices, only on the slot they claimed.
+    //! @details tail (producers) and head (consumers) are on their own cache lines.
+    //! @details The claimed slot must be published, so value_type is moved without exceptions,
+    //! @details the copy for try_push() is made before the slot is claimed
+    //! @tparam Tp The type of the elements, nothrow move constructible and move assignable
+    //! @tparam capacity_ Count of the slots, the power of two not less than 2
+    //-----------------------------------------------------------------------------
+    template<typename Tp, const std::size_t capacity_>
+    class mpmc_queue_t {
+    public:
+
+        static_assert(capacity_ >= 2 && !(capacity_ & (capacity_ - 1)),
+                      "Capacity of mpmc_queue_t must be a power of two not less than 2");
+        static_assert(std::is_nothrow_move_constructible<Tp>::value && std::is_nothrow_move_assignable<Tp>::value,
+                      "Elements of mpmc_queue_t must be moved without exceptions");
+
+        using value_type = Tp;          //!< Element type
+        using size_type  = std::size_t; //!< Size type
+
+        //-----------------------------------------------------------------------------
+        //! @brief Default constructor
+        //! @details No element is constructed, sequence of slot i is i
+        //-----------------------------------------------------------------------------
+        mpmc_queue_t() noexcept;
+
+        mpmc_queue_t(const mpmc_queue_t&)            = delete;
+        mpmc_queue_t& operator=(const mpmc_queue_t&) = delete;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Destructor
+        //! @details Elements which were not popped are destroyed, all threads must be finished
+        //-----------------------------------------------------------------------------
+        ~mpmc_queue_t();
+
+        //-----------------------------------------------------------------------------
+        //! @brief Push the copy of x
+        //! @param x New element
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when queue is not valid
+        //! @throws The same exceptions as the copy constructor of value_type, the queue is not changed then
+        //! @return True if x was pushed, false when the queue is full
+        //-----------------------------------------------------------------------------
+        bool try_push(const value_type& x) {
+            return emplace(x);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Push x by move
+        //! @param x New element, it is not moved from when the queue is full
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when queue is not valid
+        //! @return True if x was pushed, false when the queue is full
+        //-----------------------------------------------------------------------------
+        bool try_push(value_type&& x) {
+            return emplace(std::move(x));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Push the copy of x
+        //! @param x New element
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when queue is not valid
+        //! @throw atom::badAlloc When the queue is full as push_back() of the full array_t
+        //! @throws The same exceptions as the copy constructor of value_type, the queue is not changed then
+        //-----------------------------------------------------------------------------
+        void push(const value_type& x) {
+            ATOM_BAD_ALLOC(!emplace(x));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Push x by move
+        //! @param x New element, it is not moved from when the queue is full
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when queue is not valid
+        //! @throw atom::badAlloc When the queue is full as push_back() of the full array_t
+        //-----------------------------------------------------------------------------
+        void push(value_type&& x) {
+            ATOM_BAD_ALLOC(!emplace(std::move(x)));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Pop the oldest element
+        //! @param out Receives the element by move assignment
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when queue is not valid
+        //! @return True if an element was popped, false when the queue is empty or the oldest
+        //! @return element is claimed by the producer which has not built it yet
+        //-----------------------------------------------------------------------------
+        bool try_pop(value_type& out);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the elements
+        //! @details Approximate while other threads push and pop, exact when they are finished
+        //-----------------------------------------------------------------------------
+        size_type size() const noexcept {
+            // head first: tail read later is not less than it
+            const size_type head = consumer_.head.load(std::memory_order_acquire);
+            const size_type tail = producer_.tail.load(std::memory_order_acquire);
+            return std::min(tail - head, capacity_);
+        }
+
+        //! @brief The same as size() == 0
+        bool empty() const noexcept {
+            return !size();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the slots
+        //-----------------------------------------------------------------------------
+        static constexpr size_type capacity() noexcept {
+            return capacity_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Silent verifier
+        //! @return True if queue is valid else return false
+        //-----------------------------------------------------------------------------
+        bool is_valid() const noexcept {
+            return this && size() <= capacity_;
+        }
+
+    private:
+
+        static constexpr size_type MASK = capacity_ - 1;
+
+        //! @brief Slot of the element
+        struct cell_t {
+            std::atomic<size_type>    sequence;
+            alignas(Tp) unsigned char bytes[sizeof(Tp)];
+        };
+
+        //! @brief Position of the next push, shared by the producers
+        struct alignas(CACHE_LINE_SIZE) producer_t {
+            std::atomic<size_type> tail{0};
+        };
+
+        //! @brief Position of the next pop, shared by the consumers
+        struct alignas(CACHE_LINE_SIZE) consumer_t {
+            std::atomic<size_type> head{0};
+        };
+
+        producer_t producer_;
+        consumer_t consumer_;
+
+        alignas(CACHE_LINE_SIZE) cell_t cells_[capacity_];
+
+        static value_type* element(cell_t& cell) noexcept {
+            return std::launder(reinterpret_cast<value_type*>(cell.bytes));
+        }
+
+        template<typename Arg>
+        bool emplace(Arg&& x);
+
+        //! @brief Claims the slot for the push, nullptr when the queue is full
+        cell_t* claim_push(size_type& pos) noexcept;
+
+        void dump(const char* file,
+                  const char* function_name,
+                  int         line_number,
+                  const char* output_file = "__mpmc_queue_dump.txt") const;
+    };
+
+}
+
+#include "implement/mpmc_queue.hpp"
+
+#endif // ATOM_MPMC_QUEUE_H
@@ -0,0 +1,78 @@
+#ifndef ATOM_PACKED_VECTOR_HPP
+#define ATOM_PACKED_VECTOR_HPP 1
+
+#include <algorithm>
+#include <fstream>
+#include "exceptions.h"
+#include "debug_tools.h"
+
+namespace atom {
+
+    template<unsigned int Bits>
+    void packed_vector_t<Bits>::write(const size_type pos, const value_type value) noexcept {
+        const size_type bit  = pos * width();
+        const size_type head = std::min<size_type>(width(), BIT_BLOCK_SIZE - bit % BIT_BLOCK_SIZE);
+
+        store_bits(blocks_.data(), bit, head, value);
+
+        // The field crosses the block
+        if (head < width()) {
+            store_bits(blocks_.data(), bit + head, width() - head, static_cast<bit_container_type>(value) >> head);
+        }
+    }
+
+    template<unsigned int Bits>
+    void packed_vector_t<Bits>::push_back(const value_type value) {
+        ATOM_ASSERT_VALID(this);
+        ATOM_INVALID_ARGUMENT(value > max_value());
+
+        if ((size_ + 1) * width() > blocks_.size() * BIT_BLOCK_SIZE) {
+            blocks_.push_back(0);
+        }
+
+        write(size_, value);
+        ++size_;
+
+        ATOM_ASSERT_VALID(this);
+    }
+
+    template<unsigned int Bits>
+    void packed_vector_t<Bits>::unpack(const size_type first, const size_type count, vector_t<value_type>& out) const {
+        ATOM_ASSERT_VALID(this);
+        ATOM_OUT_OF_RANGE(first > size_ || count > size_ - first);
+
+        out.resize(count);
+        if (count) {
+            simd_unpack_bits(out.data(), blocks_.data(), first, count, width());
+        }
+    }
+
+    template<unsigned int Bits>
+    void packed_vector_t<Bits>::dump(const char* file,
+                                     const char* function_name,
+                                     int         line_number,
+                                     const char* output_file) const {
+
+        std::ofstream fout(output_file, std::ios_base::app);
+
+        ATOM_BAD_STREAM(!fout.is_open());
+
+        fout << "-------------------\n"
+                "Class packed_vector_t:\n"
+                "time: "      << __TIME__       << "\n"
+                "file: "      << file           << "\n"
+                "function: "  << function_name  << "\n"
+                "line: "      << line_number    << "\n"
+                "status: "    << (is_valid() ? "ok\n{\n" : "FAIL\n{\n");
+        fout << "\tsize: "    << size_          << "\n"
+                "\twidth: "   << width()        << "\n"
+                "\tblocks: "  << blocks_.size() << "\n"
+                "}\n"
+                "-------------------\n";
+
+        fout.close();
+    }
+
+}
+
+#endif // ATOM_PACKED_VECTOR_HPP
@@ -0,0 +1,248 @@
+//-----------------------------------------------------------------------------
+//! @file packed_vector.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Vector of unsigned integers packed in fields of k bits
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_PACKED_VECTOR_H
+#define ATOM_PACKED_VECTOR_H 1
+
+#include "bool/bool_space.h"
+#include "vector/vector.h"
+#include "simd/simd.h"
+#include "exceptions.h"
+#include "debug_tools.h"
+#include <cstdint>
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @namespace packed_detail
+    //! @brief Width of the fields of packed_vector_t
+    //-----------------------------------------------------------------------------
+    namespace packed_detail {
+
+        //! Width is known at compile time, shifts and masks are constants
+        template<unsigned int Bits>
+        class width_holder {
+        protected:
+            explicit width_holder(unsigned int) noexcept {
+            }
+
+            static constexpr unsigned int width() noexcept {
+                return Bits;
+            }
+        };
+
+        //! Width is chosen at runtime
+        template<>
+        class width_holder<0> {
+        protected:
+            explicit width_holder(const unsigned int width) noexcept :
+                width_(width) {
+            }
+
+            unsigned int width() const noexcept {
+                return width_;
+            }
+
+        private:
+            unsigned int width_;
+        };
+
+    }
+
+    //-----------------------------------------------------------------------------
+    //! @class packed_vector_t
+    //! @brief Vector of unsigned integers of Bits bits, fields are packed in bit_container_type blocks
+    //! @details Field pos takes bits [pos * width, (pos + 1) * width) with the same block/offset
+    //! @details arithmetic as vector_t<bool>, a field can cross two blocks.
+    //! @details Codes of 3..20 bits take 10..60% of vector_t<std::uint32_t> memory,
+    //! @details unpack() restores them to 32-bit values by simd_unpack_bits()
+    //! @tparam Bits Width of the field in [1, 32], 0 when the width is passed to the constructor
+    //-----------------------------------------------------------------------------
+    template<unsigned int Bits = 0>
+    class packed_vector_t : private packed_detail::width_holder<Bits> {
+    public:
+
+        using size_type  = std::size_t;   //!< Size type
+        using value_type = std::uint32_t; //!< Type of the value of field
+
+        static_assert(Bits <= 32, "packed_vector_t: field is wider than 32 bits");
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @param width Width of the field, it is Bits by default
+        //! @throw atom::invalidArgument When width is not in [1, 32] or is not equal to Bits
+        //-----------------------------------------------------------------------------
+        explicit packed_vector_t(const unsigned int width = Bits) :
+            width_holder(width),
+            size_       (0) {
+
+            ATOM_INVALID_ARGUMENT(!width || width > 32 || (Bits && width != Bits));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Width of the field in bits
+        //-----------------------------------------------------------------------------
+        unsigned int width() const noexcept {
+            return width_holder::width();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief The biggest value of the field
+        //-----------------------------------------------------------------------------
+        value_type max_value() const noexcept {
+            return static_cast<value_type>((1ULL << width()) - 1);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Value of the field pos
+        //! @param pos Number of the field
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throw atom::outOfRange When pos is not less than size()
+        //-----------------------------------------------------------------------------
+        value_type get(const size_type pos) const {
+            ATOM_ASSERT_VALID(this);
+            ATOM_OUT_OF_RANGE(pos >= size_);
+
+            return static_cast<value_type>(load_bits(blocks_.data(), pos * width(), width()));
+        }
+
+        //! @brief The same as get()
+        value_type operator[](const size_type pos) const {
+            return get(pos);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Change the value of the field pos
+        //! @param pos Number of the field
+        //! @param value New value
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throw atom::outOfRange When pos is not less than size()
+        //! @throw atom::invalidArgument When value is bigger than max_value()
+        //-----------------------------------------------------------------------------
+        void set(const size_type pos, const value_type value) {
+            ATOM_ASSERT_VALID(this);
+            ATOM_OUT_OF_RANGE(pos >= size_);
+            ATOM_INVALID_ARGUMENT(value > max_value());
+
+            write(pos, value);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Push new field in back of the vector
+        //! @details Blocks grow by the growth policy of vector_t
+        //! @param value Value of the new field
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throw atom::invalidArgument When value is bigger than max_value()
+        //! @throws The same exceptions as vector_t::push_back()
+        //-----------------------------------------------------------------------------
+        void push_back(const value_type value);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Unpack the fields [first, first + count) to 32-bit values
+        //! @details Fields are unpacked by simd_unpack_bits(), out is resized to count
+        //! @param first Number of the first field
+        //! @param count Count of the fields
+        //! @param out Buffer of the result
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throw atom::outOfRange When first + count is bigger than size()
+        //! @throws The same exceptions as vector_t::resize()
+        //-----------------------------------------------------------------------------
+        void unpack(const size_type first, const size_type count, vector_t<value_type>& out) const;
+
+        //! @brief Unpack all fields, see unpack(first, count, out)
+        void unpack(vector_t<value_type>& out) const {
+            unpack(0, size_, out);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Reserve the memory for n fields
+        //! @param n Count of the fields
+        //! @throws The same exceptions as vector_t::reserve()
+        //-----------------------------------------------------------------------------
+        void reserve(const size_type n) {
+            blocks_.reserve(div_ceil(n * width(), BIT_BLOCK_SIZE));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Remove all fields and free the memory
+        //-----------------------------------------------------------------------------
+        void clear() noexcept {
+            blocks_.clear();
+            size_ = 0;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the fields
+        //-----------------------------------------------------------------------------
+        size_type size() const noexcept {
+            return size_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Checks the vector on the void
+        //-----------------------------------------------------------------------------
+        bool empty() const noexcept {
+            return !size_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Blocks of the fields
+        //! @details Bits of the last block behind size() * width() are zero
+        //-----------------------------------------------------------------------------
+        const bit_container_type* data() const noexcept {
+            return blocks_.data();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Memory of the blocks in bytes
+        //-----------------------------------------------------------------------------
+        size_type memory_usage() const noexcept {
+            return blocks_.capacity() * sizeof(bit_container_type);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Silent verifier
+        //! @return True if vector is valid else return false
+        //-----------------------------------------------------------------------------
+        bool is_valid() const noexcept {
+            return this &&
+                    width() && width() <= 32 &&
+                    blocks_.is_valid() &&
+                    blocks_.size() == div_ceil(size_ * width(), BIT_BLOCK_SIZE);
+        }
+
+    private:
+
+        using width_holder = packed_detail::width_holder<Bits>;
+
+        vector_t<bit_container_type> blocks_; //!< Packed fields
+        size_type                    size_;   //!< Count of the fields
+
+        void write(const size_type pos, const value_type value) noexcept;
+
+        void dump(const char* file,
+                  const char* function_name,
+                  int         line_number,
+                  const char* output_file = "__packed_vector_dump.txt") const;
+    };
+
+}
+
+#include "implement/packed_vector.hpp"
+
+#endif // ATOM_PACKED_VECTOR_H
@@ -0,0 +1,227 @@
+#ifndef ATOM_RANK_SELECT_HPP
+#define ATOM_RANK_SELECT_HPP 1
+
+#include <algorithm>
+#include <fstream>
+#include "exceptions.h"
+#include "debug_tools.h"
+
+namespace atom {
+
+    template<typename BitVector>
+    typename rank_select_index<BitVector>::size_type
+    rank_select_index<BitVector>::popcount_words(const bit_container_type* data, const size_type n) noexcept {
+#ifdef ATOM_SIMD_X86
+        if (simd_kernel::has_popcnt()) {
+            return simd_kernel::popcount_popcnt(data, n);
+        }
+#endif
+        return simd_kernel::popcount_scalar(data, n);
+    }
+
+    template<typename BitVector>
+    void rank_select_index<BitVector>::update() {
+        ATOM_ASSERT_VALID(this);
+
+        const size_type new_size = bits_->size();
+        ATOM_OUT_OF_RANGE(new_size < size_);
+
+        const bit_container_type* data        = bits_->data();
+        const size_type           count_words = div_ceil(new_size, BIT_BLOCK_SIZE);
+        const size_type           remain_bits = new_size % BIT_BLOCK_SIZE;
+
+        // The last partial block is counted again
+        size_type block = size_ / BLOCK_BITS;
+        if (block < entries_.size()) {
+            count_ = upper_[block / BLOCKS_PER_UPPER] + lower_count(entries_[block]);
+            entries_.erase(block, entries_.size());
+            samples_.erase(div_ceil(count_, SELECT_STEP), samples_.size());
+        }
+
+        try {
+            entries_.reserve(div_ceil(new_size, BLOCK_BITS));
+            upper_.reserve(div_ceil(new_size, UPPER_BITS));
+
+            for (; block * BLOCK_BITS < new_size; ++block) {
+                if (upper_.size() <= block / BLOCKS_PER_UPPER) {
+                    upper_.push_back(count_);
+                }
+
+                unsigned long long entry       = count_ - upper_[block / BLOCKS_PER_UPPER];
+                size_type          block_count = 0;
+
+                for (size_type sub = 0; sub < BLOCK_BITS / SUB_BITS; ++sub) {
+                    const size_type first = block * BLOCK_WORDS + sub * SUB_WORDS;
+                    const size_type last  = std::min(first + SUB_WORDS, count_words);
+
+                    if (first >= last) {
+                        break;
+                    }
+
+                    size_type sub_total = popcount_words(data + first, last - first);
+                    if (last == count_words && remain_bits) {
+                        // Bits behind the size are not part of the vector
+                        const bit_container_type behind = data[last - 1] & ~((ONE << remain_bits) - 1);
+                        sub_total -= popcount_words(&behind, 1);
+                    }
+
+                    if (sub + 1 < BLOCK_BITS / SUB_BITS) {
+                        entry |= static_cast<unsigned long long>(sub_total) << (32 + SUB_COUNT_BITS * sub);
+                    }
+                    block_count += sub_total;
+                }
+
+                entries_.push_back(entry);
+
+                // Samples of the set bits with numbers in [count_, count_ + block_count)
+                while (samples_.size() * SELECT_STEP < count_ + block_count) {
+                    samples_.push_back(block);
+                }
+                count_ += block_count;
+            }
+        }
+        catch (...) {
+            entries_.clear();
+            upper_.clear();
+            samples_.clear();
+            size_  = 0;
+            count_ = 0;
+            throw;
+        }
+
+        size_ = new_size;
+
+        ATOM_ASSERT_VALID(this);
+    }
+
+    template<typename BitVector>
+    typename rank_select_index<BitVector>::size_type
+    rank_select_index<BitVector>::rank(const size_type pos) const {
+        ATOM_ASSERT_VALID(this);
+        ATOM_OUT_OF_RANGE(pos > size_);
+
+        if (pos == size_) {
+            return count_;
+        }
+
+        const size_type          block = pos / BLOCK_BITS;
+        const size_type          sub   = pos % BLOCK_BITS / SUB_BITS;
+        const unsigned long long entry = entries_[block];
+
+        size_type result = upper_[block / BLOCKS_PER_UPPER] + lower_count(entry);
+        for (size_type i = 0; i < sub; ++i) {
+            result += sub_count(entry, i);
+        }
+
+        const bit_container_type* data  = bits_->data();
+        const size_type           first = block * BLOCK_WORDS + sub * SUB_WORDS;
+        const size_type           word  = pos / BIT_BLOCK_SIZE;
+        const bit_container_type  last  = data[word] & ((ONE << pos % BIT_BLOCK_SIZE) - 1);
+
+        return result + popcount_words(data + first, word - first) + popcount_words(&last, 1);
+    }
+
+    template<typename BitVector>
+    typename rank_select_index<BitVector>::size_type
+    rank_select_index<BitVector>::find_block(const size_type upper, const size_type rest, const size_type k) const {
+        const size_type first_block = upper * BLOCKS_PER_UPPER;
+        const size_type end_block   = std::min(entries_.size(), first_block + BLOCKS_PER_UPPER);
+        const size_type sample      = k / SELECT_STEP;
+
+        // The block is between the samples of the neighbouring set bits
+        size_type lo = std::max(static_cast<size_type>(samples_[sample]), first_block);
+        size_type hi = sample + 1 < samples_.size() ?
+                       std::min(static_cast<size_type>(samples_[sample + 1]) + 1, end_block) : end_block;
+
+        // The last block in [lo, hi) which starts before the set bit
+        while (hi - lo > 1) {
+            const size_type mid = lo + (hi - lo) / 2;
+
+            if (lower_count(entries_[mid]) <= rest) {
+                lo = mid;
+            }
+            else {
+                hi = mid;
+            }
+        }
+
+        return lo;
+    }
+
+    template<typename BitVector>
+    typename rank_select_index<BitVector>::size_type
+    rank_select_index<BitVector>::select(const size_type k) const {
+        ATOM_ASSERT_VALID(this);
+        ATOM_OUT_OF_RANGE(k >= count_);
+
+        size_type upper = upper_.size() - 1;
+        while (upper_[upper] > k) {
+            --upper;
+        }
+
+        size_type                rest  = k - upper_[upper];
+        const size_type          block = find_block(upper, rest, k);
+        const unsigned long long entry = entries_[block];
+
+        rest -= lower_count(entry);
+
+        size_type word = block * BLOCK_WORDS;
+        for (size_type sub = 0; sub + 1 < BLOCK_BITS / SUB_BITS; ++sub) {
+            const size_type sub_total = sub_count(entry, sub);
+
+            if (rest < sub_total) {
+                break;
+            }
+            rest -= sub_total;
+            word += SUB_WORDS;
+        }
+
+        const bit_container_type* data = bits_->data();
+        for (;; ++word) {
+            const size_type word_count = popcount_words(data + word, 1);
+
+            if (rest < word_count) {
+                break;
+            }
+            rest -= word_count;
+        }
+
+#ifdef ATOM_SIMD_X86
+        if (simd_kernel::has_bmi2()) {
+            return word * BIT_BLOCK_SIZE + simd_kernel::select_in_word_bmi2(data[word], static_cast<unsigned int>(rest));
+        }
+#endif
+        return word * BIT_BLOCK_SIZE + simd_kernel::select_in_word_scalar(data[word], static_cast<unsigned int>(rest));
+    }
+
+    template<typename BitVector>
+    void rank_select_index<BitVector>::dump(const char* file,
+                                            const char* function_name,
+                                            int         line_number,
+                                            const char* output_file) const {
+
+        std::ofstream fout(output_file, std::ios_base::app);
+
+        ATOM_BAD_STREAM(!fout.is_open());
+
+        fout << "-------------------\n"
+                "Class rank_select_index:\n"
+                "time: "       << __TIME__        << "\n"
+                "file: "       << file            << "\n"
+                "function: "   << function_name   << "\n"
+                "line: "       << line_number     << "\n"
+                "status: "     << (is_valid() ? "ok\n{\n" : "FAIL\n{\n");
+        fout << "\tsize: "     << size_           << "\n"
+                "\tcount: "    << count_          << "\n"
+                "\tentries: "  << entries_.size() << "\n"
+                "\tupper: "    << upper_.size()   << "\n"
+                "\tsamples: "  << samples_.size() << "\n"
+                "}\n"
+                "-------------------\n";
+
+        fout.close();
+    }
+
+}
+
+#endif // ATOM_RANK_SELECT_HPP
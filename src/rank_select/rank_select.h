@@ -0,0 +1,193 @@
+//-----------------------------------------------------------------------------
+//! @file rank_select.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Succinct rank/select index over a bit vector
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_RANK_SELECT_H
+#define ATOM_RANK_SELECT_H 1
+
+#include "bool/bool_space.h"
+#include "vector/vector.h"
+#include "simd/simd.h"
+#include "exceptions.h"
+#include "debug_tools.h"
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @class rank_select_index
+    //! @brief Index which answers rank and select over a bit vector without scans
+    //! @details Layout is interleaved: one 64-bit entry per block of 2048 bits keeps
+    //! @details 32-bit count of set bits from the start of the 2^32-bit superblock
+    //! @details and three 10-bit counts of the first 512-bit sub-blocks.
+    //! @details rank() reads one entry and at most 8 words, select() takes a sample
+    //! @details of every 8192-th set bit, searches entries between two samples and
+    //! @details finishes in the word by pdep (BMI2) when processor has it.
+    //! @details Overhead is 3.2% of the bits plus 64 bits per 8192 set bits
+    //! @details Vector must be frozen: appends are indexed by update(), other changes need rebuild()
+    //! @tparam BitVector Type of the vector, it must have functions: data() and size()
+    //-----------------------------------------------------------------------------
+    template<typename BitVector = vector_t<bool> >
+    class rank_select_index {
+    public:
+
+        using size_type      = std::size_t; //!< Size type
+        using container_type = BitVector;   //!< Type of the indexed vector
+
+        static constexpr size_type BLOCK_BITS  = 2048;                  //!< Bits per entry
+        static constexpr size_type SUB_BITS    = 512;                   //!< Bits per sub-block
+        static constexpr size_type UPPER_BITS  = size_type(1) << 32;    //!< Bits per superblock
+        static constexpr size_type SELECT_STEP = 8192;                  //!< Set bits between the samples of select
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @details Builds the index, bits must outlive the index
+        //! @param bits Indexed vector
+        //! @throws The same exceptions as vector_t::push_back()
+        //-----------------------------------------------------------------------------
+        explicit rank_select_index(const container_type& bits) :
+            bits_ (&bits),
+            size_ (0),
+            count_(0) {
+
+            build();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Index the bits which were appended after the last build
+        //! @details Only the last partial block and the new blocks are counted,
+        //! @details memory of the index grows by the growth policy of vector_t
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when index is not valid
+        //! @throw atom::outOfRange When the vector became shorter, use rebuild()
+        //! @throws The same exceptions as vector_t::push_back()
+        //-----------------------------------------------------------------------------
+        void update();
+
+        //-----------------------------------------------------------------------------
+        //! @brief Index the vector from the beginning
+        //! @details Is needed after any change of the vector except appends,
+        //! @details memory of the index is shrunk to fit
+        //! @throws The same exceptions as vector_t::push_back()
+        //-----------------------------------------------------------------------------
+        void rebuild() {
+            entries_.clear();
+            upper_.clear();
+            samples_.clear();
+            size_  = 0;
+            count_ = 0;
+
+            build();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the set bits before pos
+        //! @param pos Position, it can be equal to size()
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when index is not valid
+        //! @throw atom::outOfRange When pos is greater than size()
+        //! @return Count of the set bits in [0, pos)
+        //-----------------------------------------------------------------------------
+        size_type rank(const size_type pos) const;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Position of the set bit with number k
+        //! @param k Number of the set bit from zero
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when index is not valid
+        //! @throw atom::outOfRange When k is not less than count()
+        //! @return Position pos such as bits[pos] is true and rank(pos) == k
+        //-----------------------------------------------------------------------------
+        size_type select(const size_type k) const;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the indexed set bits
+        //-----------------------------------------------------------------------------
+        size_type count() const noexcept {
+            return count_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the indexed bits
+        //-----------------------------------------------------------------------------
+        size_type size() const noexcept {
+            return size_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Memory of the index in bytes without the vector
+        //-----------------------------------------------------------------------------
+        size_type memory_usage() const noexcept {
+            return (entries_.capacity() + upper_.capacity() + samples_.capacity()) * sizeof(unsigned long long);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Silent verifier
+        //! @return True if index is valid else return false
+        //-----------------------------------------------------------------------------
+        bool is_valid() const noexcept {
+            return this &&
+                    bits_ &&
+                    entries_.is_valid() &&
+                    upper_.is_valid() &&
+                    samples_.is_valid() &&
+                    entries_.size() == div_ceil(size_, BLOCK_BITS) &&
+                    upper_.size() == div_ceil(size_, UPPER_BITS) &&
+                    samples_.size() == div_ceil(count_, SELECT_STEP);
+        }
+
+    private:
+
+        static constexpr size_type BLOCK_WORDS      = BLOCK_BITS / BIT_BLOCK_SIZE;
+        static constexpr size_type SUB_WORDS        = SUB_BITS / BIT_BLOCK_SIZE;
+        static constexpr size_type BLOCKS_PER_UPPER = UPPER_BITS / BLOCK_BITS;
+        static constexpr unsigned  SUB_COUNT_BITS   = 10;
+
+        const container_type*              bits_;
+        size_type                          size_;    //!< Count of the indexed bits
+        size_type                          count_;   //!< Count of the indexed set bits
+        vector_t<unsigned long long>       entries_; //!< Interleaved counts, one per block
+        vector_t<unsigned long long>       upper_;   //!< Count of the set bits before every superblock
+        vector_t<unsigned long long>       samples_; //!< Block of every SELECT_STEP-th set bit
+
+        static size_type lower_count(const unsigned long long entry) noexcept {
+            return static_cast<size_type>(entry & 0xFFFFFFFFULL);
+        }
+
+        static size_type sub_count(const unsigned long long entry, const size_type sub) noexcept {
+            return static_cast<size_type>(entry >> (32 + SUB_COUNT_BITS * sub)) & ((1U << SUB_COUNT_BITS) - 1);
+        }
+
+        static size_type popcount_words(const bit_container_type* data, const size_type n) noexcept;
+
+        void build() {
+            update();
+
+            entries_.shrink_to_fit();
+            upper_.shrink_to_fit();
+            samples_.shrink_to_fit();
+        }
+
+        size_type find_block(const size_type upper, const size_type rest, size_type k) const;
+
+        void dump(const char* file,
+                  const char* function_name,
+                  int         line_number,
+                  const char* output_file = "__rank_select_dump.txt") const;
+    };
+
+}
+
+#include "implement/rank_select.hpp"
+
+#endif // ATOM_RANK_SELECT_H
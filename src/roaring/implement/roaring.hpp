@@ -0,0 +1,892 @@
+#ifndef ATOM_ROARING_HPP
+#define ATOM_ROARING_HPP 1
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <utility>
+#include "exceptions.h"
+#include "debug_tools.h"
+
+namespace atom {
+
+    inline roaring_bitmap_t::roaring_bitmap_t(const vector_t<bool>& bits) {
+        const size_type size = bits.size();
+        ATOM_OUT_OF_RANGE(size > (size_type(1) << 32));
+
+        const bit_container_type* data = bits.data();
+
+        for (size_type first = 0; first < size; first += CHUNK_BITS) {
+            const size_type           count_bits  = std::min(CHUNK_BITS, size - first);
+            const size_type           full_words  = count_bits / BIT_BLOCK_SIZE;
+            const size_type           remain_bits = count_bits % BIT_BLOCK_SIZE;
+            const bit_container_type* words       = data + first / BIT_BLOCK_SIZE;
+            const bit_container_type  tail        = remain_bits ? words[full_words] & ((ONE << remain_bits) - 1) : 0;
+
+            const size_type card = simd_popcount(words, full_words) + simd_popcount(&tail, 1);
+            if (!card) {
+                continue;
+            }
+
+            chunk_t chunk;
+            chunk.key  = static_cast<unsigned int>(first >> 16);
+            chunk.card = static_cast<unsigned int>(card);
+
+            if (card <= ARRAY_MAX) {
+                chunk.values.reserve(card);
+                for_each_set_bit(words, count_bits, [&](const size_type low) {
+                    chunk.values.push_back(static_cast<unsigned short>(low));
+                });
+            }
+            else {
+                chunk.kind = chunk_kind::bitmap;
+                chunk.bits = vector_t<bool>(CHUNK_BITS, false);
+
+                std::copy(words, words + full_words, chunk.bits.data());
+                if (remain_bits) {
+                    chunk.bits.data()[full_words] = tail;
+                }
+            }
+
+            chunks_.push_back(std::move(chunk));
+        }
+
+        ATOM_ASSERT_VALID(this);
+    }
+
+    inline roaring_bitmap_t::size_type roaring_bitmap_t::lower_chunk(const unsigned int key) const noexcept {
+        const chunk_t* data = chunks_.data();
+        size_type      lo   = 0;
+        size_type      hi   = chunks_.size();
+
+        while (lo < hi) {
+            const size_type mid = lo + (hi - lo) / 2;
+
+            if (data[mid].key < key) {
+                lo = mid + 1;
+            }
+            else {
+                hi = mid;
+            }
+        }
+
+        return lo;
+    }
+
+    template<typename Fn>
+    void roaring_bitmap_t::for_each_value(const chunk_t& chunk, Fn&& fn) {
+        const unsigned short* values = chunk.values.data();
+
+        switch (chunk.kind) {
+            case chunk_kind::array:
+                for (size_type i = 0; i < chunk.card; ++i) {
+                    fn(static_cast<size_type>(values[i]));
+                }
+                break;
+
+            case chunk_kind::bitmap:
+                for_each_set_bit(chunk.bits.data(), CHUNK_BITS, fn);
+                break;
+
+            case chunk_kind::run:
+                for (size_type i = 0; i < chunk.values.size(); i += 2) {
+                    const size_type start = values[i];
+
+                    for (size_type low = start; low <= start + values[i + 1]; ++low) {
+                        fn(low);
+                    }
+                }
+                break;
+        }
+    }
+
+    inline bool roaring_bitmap_t::contains(const chunk_t& chunk, const unsigned int low) noexcept {
+        const unsigned short* values = chunk.values.data();
+
+        switch (chunk.kind) {
+            case chunk_kind::array:
+                return std::binary_search(values, values + chunk.card, static_cast<unsigned short>(low));
+
+            case chunk_kind::bitmap:
+                return (chunk.bits.data()[low / BIT_BLOCK_SIZE] >> (low % BIT_BLOCK_SIZE)) & 1;
+
+            case chunk_kind::run: {
+                // The last run which starts not after low
+                size_type lo = 0;
+                size_type hi = chunk.values.size() / 2;
+
+                while (lo < hi) {
+                    const size_type mid = lo + (hi - lo) / 2;
+
+                    if (values[2 * mid] <= low) {
+                        lo = mid + 1;
+                    }
+                    else {
+                        hi = mid;
+                    }
+                }
+
+                return lo && low - values[2 * (lo - 1)] <= values[2 * (lo - 1) + 1];
+            }
+        }
+
+        return false;
+    }
+
+    inline void roaring_bitmap_t::fill_bitmap(const chunk_t& chunk, bit_container_type* words) noexcept {
+        const unsigned short* values = chunk.values.data();
+
+        switch (chunk.kind) {
+            case chunk_kind::array:
+                for (size_type i = 0; i < chunk.card; ++i) {
+                    words[values[i] / BIT_BLOCK_SIZE] |= ONE << (values[i] % BIT_BLOCK_SIZE);
+                }
+                break;
+
+            case chunk_kind::bitmap:
+                for (size_type i = 0; i < CHUNK_WORDS; ++i) {
+                    words[i] |= chunk.bits.data()[i];
+                }
+                break;
+
+            case chunk_kind::run:
+                for (size_type i = 0; i < chunk.values.size(); i += 2) {
+                    set_bit_range(words, values[i], static_cast<size_type>(values[i]) + values[i + 1] + 1);
+                }
+                break;
+        }
+    }
+
+    inline vector_t<bool> roaring_bitmap_t::bitmap_of(const chunk_t& chunk) {
+        if (chunk.kind == chunk_kind::bitmap) {
+            return chunk.bits;
+        }
+
+        vector_t<bool> result(CHUNK_BITS, false);
+        fill_bitmap(chunk, result.data());
+
+        return result;
+    }
+
+    inline roaring_bitmap_t::size_type roaring_bitmap_t::count_runs(const chunk_t& chunk) noexcept {
+        const unsigned short* values = chunk.values.data();
+        size_type             result = 0;
+
+        switch (chunk.kind) {
+            case chunk_kind::array:
+                for (size_type i = 0; i < chunk.card; ++i) {
+                    result += !i || values[i] != values[i - 1] + 1;
+                }
+                break;
+
+            case chunk_kind::bitmap: {
+                // A run starts at the set bit after the zero one
+                const bit_container_type* words = chunk.bits.data();
+                bit_container_type        carry = 0;
+
+                for (size_type i = 0; i < CHUNK_WORDS; ++i) {
+                    result += static_cast<size_type>(__builtin_popcountll(words[i] & ~(words[i] << 1 | carry)));
+                    carry   = words[i] >> (BIT_BLOCK_SIZE - 1);
+                }
+                break;
+            }
+
+            case chunk_kind::run:
+                result = chunk.values.size() / 2;
+                break;
+        }
+
+        return result;
+    }
+
+    inline void roaring_bitmap_t::to_array(chunk_t& chunk) {
+        vector_t<unsigned short> values;
+        values.reserve(chunk.card);
+
+        for_each_value(chunk, [&](const size_type low) {
+            values.push_back(static_cast<unsigned short>(low));
+        });
+
+        chunk.values = std::move(values);
+        chunk.bits.clear();
+        chunk.kind = chunk_kind::array;
+    }
+
+    inline void roaring_bitmap_t::to_bitmap(chunk_t& chunk) {
+        chunk.bits = bitmap_of(chunk);
+        chunk.values.clear();
+        chunk.kind = chunk_kind::bitmap;
+    }
+
+    inline void roaring_bitmap_t::to_run(chunk_t& chunk) {
+        vector_t<unsigned short> runs;
+        runs.reserve(2 * count_runs(chunk));
+
+        size_type start = CHUNK_BITS;
+        size_type prev  = CHUNK_BITS;
+
+        for_each_value(chunk, [&](const size_type low) {
+            if (start != CHUNK_BITS && low == prev + 1) {
+                prev = low;
+                return;
+            }
+            if (start != CHUNK_BITS) {
+                runs.push_back(static_cast<unsigned short>(start));
+                runs.push_back(static_cast<unsigned short>(prev - start));
+            }
+            start = prev = low;
+        });
+
+        runs.push_back(static_cast<unsigned short>(start));
+        runs.push_back(static_cast<unsigned short>(prev - start));
+
+        chunk.values = std::move(runs);
+        chunk.bits.clear();
+        chunk.kind = chunk_kind::run;
+    }
+
+    inline void roaring_bitmap_t::unpack(chunk_t& chunk) {
+        if (chunk.card <= ARRAY_MAX) {
+            to_array(chunk);
+        }
+        else {
+            to_bitmap(chunk);
+        }
+    }
+
+    inline bool roaring_bitmap_t::operator[](const value_type id) const {
+        ATOM_ASSERT_VALID(this);
+
+        const unsigned int key = id >> 16;
+        const size_type    i   = lower_chunk(key);
+
+        return i < chunks_.size() && chunks_[i].key == key && contains(chunks_[i], id & 0xFFFF);
+    }
+
+    inline void roaring_bitmap_t::set(const value_type id) {
+        ATOM_ASSERT_VALID(this);
+
+        const unsigned int   key = id >> 16;
+        const unsigned short low = static_cast<unsigned short>(id & 0xFFFF);
+        const size_type      i   = lower_chunk(key);
+
+        if (i == chunks_.size() || chunks_[i].key != key) {
+            chunk_t chunk;
+            chunk.key  = key;
+            chunk.card = 1;
+            chunk.values.push_back(low);
+
+            chunks_.insert(i, std::make_move_iterator(&chunk), std::make_move_iterator(&chunk + 1));
+            return;
+        }
+
+        chunk_t& chunk = chunks_[i];
+
+        if (chunk.kind == chunk_kind::run) {
+            if (contains(chunk, low)) {
+                return;
+            }
+            unpack(chunk);
+        }
+
+        if (chunk.kind == chunk_kind::array) {
+            unsigned short*       values = chunk.values.data();
+            const unsigned short* pos    = std::lower_bound(values, values + chunk.card, low);
+
+            if (pos != values + chunk.card && *pos == low) {
+                return;
+            }
+
+            if (chunk.card < ARRAY_MAX) {
+                chunk.values.insert(static_cast<size_type>(pos - values), &low, &low + 1);
+                ++chunk.card;
+                return;
+            }
+
+            to_bitmap(chunk);
+        }
+
+        bit_container_type& word = chunk.bits.data()[low / BIT_BLOCK_SIZE];
+        const bit_container_type mask = ONE << (low % BIT_BLOCK_SIZE);
+
+        if (!(word & mask)) {
+            word |= mask;
+            ++chunk.card;
+        }
+    }
+
+    inline void roaring_bitmap_t::reset(const value_type id) {
+        ATOM_ASSERT_VALID(this);
+
+        const unsigned int   key = id >> 16;
+        const unsigned short low = static_cast<unsigned short>(id & 0xFFFF);
+        const size_type      i   = lower_chunk(key);
+
+        if (i == chunks_.size() || chunks_[i].key != key || !contains(chunks_[i], low)) {
+            return;
+        }
+
+        chunk_t& chunk = chunks_[i];
+
+        if (chunk.kind == chunk_kind::run) {
+            unpack(chunk);
+        }
+
+        if (chunk.kind == chunk_kind::array) {
+            const unsigned short* values = chunk.values.data();
+
+            chunk.values.erase(static_cast<size_type>(std::lower_bound(values, values + chunk.card, low) - values));
+            --chunk.card;
+        }
+        else {
+            chunk.bits.data()[low / BIT_BLOCK_SIZE] &= ~(ONE << (low % BIT_BLOCK_SIZE));
+
+            if (--chunk.card <= ARRAY_MAX) {
+                to_array(chunk);
+            }
+        }
+
+        if (!chunk.card) {
+            chunks_.erase(i);
+        }
+    }
+
+    inline roaring_bitmap_t::value_type roaring_bitmap_t::last() const {
+        ATOM_ASSERT_VALID(this);
+        ATOM_OUT_OF_RANGE(chunks_.empty());
+
+        const chunk_t&        chunk  = chunks_[chunks_.size() - 1];
+        const unsigned short* values = chunk.values.data();
+        const value_type      base   = static_cast<value_type>(chunk.key) << 16;
+
+        switch (chunk.kind) {
+            case chunk_kind::array:
+                return base + values[chunk.card - 1];
+
+            case chunk_kind::bitmap:
+                return base + static_cast<value_type>(find_prev_bit(chunk.bits.data(), CHUNK_BITS, CHUNK_BITS));
+
+            case chunk_kind::run:
+                return base + values[chunk.values.size() - 2] + values[chunk.values.size() - 1];
+        }
+
+        return base;
+    }
+
+    inline vector_t<bool> roaring_bitmap_t::to_bits(const size_type size) const {
+        ATOM_ASSERT_VALID(this);
+        ATOM_OUT_OF_RANGE(!chunks_.empty() && last() >= size);
+
+        vector_t<bool>      result(size, false);
+        bit_container_type* words = result.data();
+
+        for (size_type i = 0; i < chunks_.size(); ++i) {
+            const chunk_t&  chunk = chunks_[i];
+            const size_type first = static_cast<size_type>(chunk.key) << 16;
+
+            if (chunk.kind == chunk_kind::bitmap) {
+                // Bits behind last() are zero, words behind the size are not touched
+                const size_type count_words = std::min(CHUNK_WORDS, div_ceil(size - first, BIT_BLOCK_SIZE));
+                const bit_container_type* bits = chunk.bits.data();
+
+                for (size_type w = 0; w < count_words; ++w) {
+                    words[first / BIT_BLOCK_SIZE + w] |= bits[w];
+                }
+            }
+            else {
+                for_each_value(chunk, [&](const size_type low) {
+                    words[(first + low) / BIT_BLOCK_SIZE] |= ONE << ((first + low) % BIT_BLOCK_SIZE);
+                });
+            }
+        }
+
+        return result;
+    }
+
+    inline bool roaring_bitmap_t::run_optimize() {
+        ATOM_ASSERT_VALID(this);
+
+        bool has_runs = false;
+
+        for (size_type i = 0; i < chunks_.size(); ++i) {
+            chunk_t&        chunk      = chunks_[i];
+            const size_type run_bytes  = 4 * count_runs(chunk);
+            const size_type flat_bytes = chunk.card <= ARRAY_MAX ? 2 * chunk.card : CHUNK_BITS / BIT_IN_BYTE;
+
+            if (run_bytes < flat_bytes) {
+                if (chunk.kind != chunk_kind::run) {
+                    to_run(chunk);
+                }
+                has_runs = true;
+            }
+            else if (chunk.kind == chunk_kind::run) {
+                unpack(chunk);
+            }
+        }
+
+        ATOM_ASSERT_VALID(this);
+
+        return has_runs;
+    }
+
+    inline roaring_bitmap_t::size_type roaring_bitmap_t::merge_and(const unsigned short* lhs, const size_type lhs_size,
+                                                                   const unsigned short* rhs, const size_type rhs_size,
+                                                                   unsigned short*       result) noexcept {
+        size_type i     = 0;
+        size_type j     = 0;
+        size_type count = 0;
+
+        // Without branches on the values, every step drops the smaller head
+        if (result) {
+            while (i < lhs_size && j < rhs_size) {
+                const unsigned short x = lhs[i];
+                const unsigned short y = rhs[j];
+
+                result[count] = x;
+                count        += x == y;
+                i            += x <= y;
+                j            += y <= x;
+            }
+        }
+        else {
+            while (i < lhs_size && j < rhs_size) {
+                const unsigned short x = lhs[i];
+                const unsigned short y = rhs[j];
+
+                count += x == y;
+                i     += x <= y;
+                j     += y <= x;
+            }
+        }
+
+        return count;
+    }
+
+    inline roaring_bitmap_t::size_type roaring_bitmap_t::merge_or(const unsigned short* lhs, const size_type lhs_size,
+                                                                  const unsigned short* rhs, const size_type rhs_size,
+                                                                  unsigned short*       result) noexcept {
+        size_type i     = 0;
+        size_type j     = 0;
+        size_type count = 0;
+
+        while (i < lhs_size && j < rhs_size) {
+            const unsigned short x = lhs[i];
+            const unsigned short y = rhs[j];
+
+            result[count++] = x < y ? x : y;
+            i              += x <= y;
+            j              += y <= x;
+        }
+
+        result = std::copy(lhs + i, lhs + lhs_size, result + count);
+        std::copy(rhs + j, rhs + rhs_size, result);
+
+        return count + (lhs_size - i) + (rhs_size - j);
+    }
+
+    inline bool roaring_bitmap_t::and_chunks(const chunk_t& lhs, const chunk_t& rhs, chunk_t& result) {
+        result.key = lhs.key;
+
+        if (lhs.kind == chunk_kind::array || rhs.kind == chunk_kind::array) {
+            const bool     lhs_small = lhs.kind == chunk_kind::array &&
+                                       (rhs.kind != chunk_kind::array || lhs.card <= rhs.card);
+            const chunk_t& small     = lhs_small ? lhs : rhs;
+            const chunk_t& other     = lhs_small ? rhs : lhs;
+
+            const unsigned short* values = small.values.data();
+
+            result.kind = chunk_kind::array;
+            result.values.resize(small.card);
+
+            unsigned short* out   = result.values.data();
+            size_type       count = 0;
+
+            if (other.kind == chunk_kind::array) {
+                count = merge_and(values, small.card, other.values.data(), other.card, out);
+            }
+            else {
+                for (size_type i = 0; i < small.card; ++i) {
+                    out[count] = values[i];
+                    count     += contains(other, values[i]);
+                }
+            }
+
+            result.values.erase(count, result.values.size());
+            result.card = static_cast<unsigned int>(result.values.size());
+        }
+        else if (lhs.kind == chunk_kind::run && rhs.kind == chunk_kind::run) {
+            const unsigned short* lhs_runs = lhs.values.data();
+            const unsigned short* rhs_runs = rhs.values.data();
+
+            result.kind = chunk_kind::run;
+            result.card = 0;
+
+            for (size_type i = 0, j = 0; i < lhs.values.size() && j < rhs.values.size();) {
+                const unsigned int lhs_last = lhs_runs[i] + lhs_runs[i + 1];
+                const unsigned int rhs_last = rhs_runs[j] + rhs_runs[j + 1];
+                const unsigned int start    = std::max(lhs_runs[i], rhs_runs[j]);
+                const unsigned int last     = std::min(lhs_last, rhs_last);
+
+                if (start <= last) {
+                    result.values.push_back(static_cast<unsigned short>(start));
+                    result.values.push_back(static_cast<unsigned short>(last - start));
+                    result.card += last - start + 1;
+                }
+
+                if (lhs_last < rhs_last) {
+                    i += 2;
+                }
+                else {
+                    j += 2;
+                }
+            }
+        }
+        else {
+            result.kind = chunk_kind::bitmap;
+            result.bits = bitmap_of(lhs);
+
+            if (rhs.kind == chunk_kind::bitmap) {
+                result.bits &= rhs.bits;
+            }
+            else {
+                result.bits &= bitmap_of(rhs);
+            }
+
+            result.card = static_cast<unsigned int>(result.bits.count());
+            if (result.card <= ARRAY_MAX) {
+                to_array(result);
+            }
+        }
+
+        return result.card != 0;
+    }
+
+    inline void roaring_bitmap_t::or_chunks(const chunk_t& lhs, const chunk_t& rhs, chunk_t& result) {
+        result.key = lhs.key;
+
+        if (lhs.kind == chunk_kind::array && rhs.kind == chunk_kind::array) {
+            const unsigned short* lhs_values = lhs.values.data();
+            const unsigned short* rhs_values = rhs.values.data();
+
+            result.kind = chunk_kind::array;
+            result.values.resize(lhs.card + rhs.card);
+
+            const size_type count = merge_or(lhs_values, lhs.card, rhs_values, rhs.card, result.values.data());
+            result.values.erase(count, result.values.size());
+
+            result.card = static_cast<unsigned int>(result.values.size());
+            if (result.card > ARRAY_MAX) {
+                to_bitmap(result);
+            }
+        }
+        else if (lhs.kind == chunk_kind::run && rhs.kind == chunk_kind::run) {
+            const unsigned short* lhs_runs = lhs.values.data();
+            const unsigned short* rhs_runs = rhs.values.data();
+
+            result.kind = chunk_kind::run;
+            result.card = 0;
+
+            size_type    i     = 0;
+            size_type    j     = 0;
+            unsigned int start = 0;
+            unsigned int last  = 0;
+            bool         open  = false;
+
+            // Runs of both chunks by start, touching runs are joined
+            while (i < lhs.values.size() || j < rhs.values.size()) {
+                const bool           from_lhs = j == rhs.values.size() ||
+                                                (i < lhs.values.size() && lhs_runs[i] <= rhs_runs[j]);
+                const unsigned short* run     = from_lhs ? lhs_runs + i : rhs_runs + j;
+                (from_lhs ? i : j) += 2;
+
+                if (open && run[0] <= last + 1) {
+                    last = std::max(last, static_cast<unsigned int>(run[0] + run[1]));
+                    continue;
+                }
+                if (open) {
+                    result.values.push_back(static_cast<unsigned short>(start));
+                    result.values.push_back(static_cast<unsigned short>(last - start));
+                    result.card += last - start + 1;
+                }
+                start = run[0];
+                last  = run[0] + run[1];
+                open  = true;
+            }
+
+            result.values.push_back(static_cast<unsigned short>(start));
+            result.values.push_back(static_cast<unsigned short>(last - start));
+            result.card += last - start + 1;
+        }
+        else {
+            const bool     lhs_base = lhs.kind == chunk_kind::bitmap || rhs.kind != chunk_kind::bitmap;
+            const chunk_t& base     = lhs_base ? lhs : rhs;
+            const chunk_t& other    = lhs_base ? rhs : lhs;
+
+            result.kind = chunk_kind::bitmap;
+            result.bits = bitmap_of(base);
+
+            if (other.kind == chunk_kind::bitmap) {
+                result.bits |= other.bits;
+            }
+            else {
+                fill_bitmap(other, result.bits.data());
+            }
+
+            result.card = static_cast<unsigned int>(result.bits.count());
+            if (result.card <= ARRAY_MAX) {
+                to_array(result);
+            }
+        }
+    }
+
+    inline roaring_bitmap_t::size_type roaring_bitmap_t::and_count_chunks(const chunk_t& lhs, const chunk_t& rhs) {
+        if (lhs.kind == chunk_kind::bitmap && rhs.kind == chunk_kind::bitmap) {
+            return and_count(lhs.bits, rhs.bits);
+        }
+
+        if (lhs.kind == chunk_kind::array || rhs.kind == chunk_kind::array) {
+            const chunk_t&        small  = lhs.kind == chunk_kind::array ? lhs : rhs;
+            const chunk_t&        other  = lhs.kind == chunk_kind::array ? rhs : lhs;
+            const unsigned short* values = small.values.data();
+
+            if (other.kind == chunk_kind::array) {
+                return merge_and(values, small.card, other.values.data(), other.card, nullptr);
+            }
+
+            size_type result = 0;
+            for (size_type i = 0; i < small.card; ++i) {
+                result += contains(other, values[i]);
+            }
+            return result;
+        }
+
+        // Runs are rare, they are counted through the temporary chunk
+        chunk_t result;
+        and_chunks(lhs, rhs, result);
+
+        return result.card;
+    }
+
+    inline roaring_bitmap_t& roaring_bitmap_t::operator&=(const roaring_bitmap_t& that) {
+        ATOM_ASSERT_VALID(this);
+        ATOM_ASSERT_VALID(&that);
+
+        if (this == &that) {
+            return *this;
+        }
+
+        size_type kept = 0;
+
+        for (size_type i = 0; i < chunks_.size(); ++i) {
+            chunk_t&        chunk = chunks_[i];
+            const size_type j     = that.lower_chunk(chunk.key);
+
+            if (j == that.chunks_.size() || that.chunks_[j].key != chunk.key) {
+                continue;
+            }
+
+            const chunk_t& other = that.chunks_[j];
+
+            if (chunk.kind == chunk_kind::bitmap && other.kind == chunk_kind::bitmap) {
+                chunk.bits &= other.bits;
+                chunk.card  = static_cast<unsigned int>(chunk.bits.count());
+
+                if (chunk.card && chunk.card <= ARRAY_MAX) {
+                    to_array(chunk);
+                }
+            }
+            else {
+                chunk_t result;
+                and_chunks(chunk, other, result);
+                chunk = std::move(result);
+            }
+
+            if (chunk.card) {
+                if (kept != i) {
+                    chunks_[kept] = std::move(chunk);
+                }
+                ++kept;
+            }
+        }
+
+        chunks_.erase(kept, chunks_.size());
+
+        ATOM_ASSERT_VALID(this);
+
+        return *this;
+    }
+
+    inline roaring_bitmap_t& roaring_bitmap_t::operator|=(const roaring_bitmap_t& that) {
+        ATOM_ASSERT_VALID(this);
+        ATOM_ASSERT_VALID(&that);
+
+        if (this == &that || that.chunks_.empty()) {
+            return *this;
+        }
+
+        vector_t<chunk_t> result;
+        result.reserve(chunks_.size() + that.chunks_.size());
+
+        size_type i = 0;
+        size_type j = 0;
+
+        while (i < chunks_.size() || j < that.chunks_.size()) {
+            if (j == that.chunks_.size() || (i < chunks_.size() && chunks_[i].key < that.chunks_[j].key)) {
+                result.push_back(std::move(chunks_[i++]));
+            }
+            else if (i == chunks_.size() || that.chunks_[j].key < chunks_[i].key) {
+                result.push_back(that.chunks_[j++]);
+            }
+            else {
+                chunk_t&       chunk = chunks_[i++];
+                const chunk_t& other = that.chunks_[j++];
+
+                if (chunk.kind == chunk_kind::bitmap && other.kind == chunk_kind::bitmap) {
+                    chunk.bits |= other.bits;
+                    chunk.card  = static_cast<unsigned int>(chunk.bits.count());
+                    result.push_back(std::move(chunk));
+                }
+                else {
+                    chunk_t merged;
+                    or_chunks(chunk, other, merged);
+                    result.push_back(std::move(merged));
+                }
+            }
+        }
+
+        chunks_.swap(result);
+
+        ATOM_ASSERT_VALID(this);
+
+        return *this;
+    }
+
+    inline roaring_bitmap_t roaring_bitmap_t::combined_and(const roaring_bitmap_t& lhs, const roaring_bitmap_t& rhs) {
+        ATOM_ASSERT_VALID(&lhs);
+        ATOM_ASSERT_VALID(&rhs);
+
+        roaring_bitmap_t result;
+
+        for (size_type i = 0, j = 0; i < lhs.chunks_.size() && j < rhs.chunks_.size();) {
+            if (lhs.chunks_[i].key < rhs.chunks_[j].key) {
+                ++i;
+            }
+            else if (rhs.chunks_[j].key < lhs.chunks_[i].key) {
+                ++j;
+            }
+            else {
+                chunk_t chunk;
+                if (and_chunks(lhs.chunks_[i], rhs.chunks_[j], chunk)) {
+                    result.chunks_.push_back(std::move(chunk));
+                }
+                ++i;
+                ++j;
+            }
+        }
+
+        return result;
+    }
+
+    inline roaring_bitmap_t::size_type roaring_bitmap_t::combined_and_count(const roaring_bitmap_t& lhs,
+                                                                            const roaring_bitmap_t& rhs) {
+        ATOM_ASSERT_VALID(&lhs);
+        ATOM_ASSERT_VALID(&rhs);
+
+        size_type result = 0;
+
+        for (size_type i = 0, j = 0; i < lhs.chunks_.size() && j < rhs.chunks_.size();) {
+            if (lhs.chunks_[i].key < rhs.chunks_[j].key) {
+                ++i;
+            }
+            else if (rhs.chunks_[j].key < lhs.chunks_[i].key) {
+                ++j;
+            }
+            else {
+                result += and_count_chunks(lhs.chunks_[i++], rhs.chunks_[j++]);
+            }
+        }
+
+        return result;
+    }
+
+    inline roaring_bitmap_t::size_type roaring_bitmap_t::memory_usage() const {
+        size_type result = chunks_.capacity() * sizeof(chunk_t);
+
+        for (size_type i = 0; i < chunks_.size(); ++i) {
+            result += chunks_[i].values.capacity() * sizeof(unsigned short) +
+                      div_ceil(chunks_[i].bits.capacity(), BIT_BLOCK_SIZE) * sizeof(bit_container_type);
+        }
+
+        return result;
+    }
+
+    inline bool roaring_bitmap_t::is_valid() const noexcept {
+        if (!this || !chunks_.is_valid()) {
+            return false;
+        }
+
+        const chunk_t* data = chunks_.data();
+
+        for (size_type i = 0; i < chunks_.size(); ++i) {
+            const chunk_t& chunk = data[i];
+
+            if (!chunk.card || chunk.key >> 16 || (i && data[i - 1].key >= chunk.key)) {
+                return false;
+            }
+
+            switch (chunk.kind) {
+                case chunk_kind::array:
+                    if (chunk.card > ARRAY_MAX || chunk.values.size() != chunk.card) {
+                        return false;
+                    }
+                    break;
+
+                case chunk_kind::bitmap:
+                    if (chunk.bits.size() != CHUNK_BITS) {
+                        return false;
+                    }
+                    break;
+
+                case chunk_kind::run:
+                    if (chunk.values.empty() || chunk.values.size() % 2) {
+                        return false;
+                    }
+                    break;
+            }
+        }
+
+        return true;
+    }
+
+    inline void roaring_bitmap_t::dump(const char* file,
+                                       const char* function_name,
+                                       int         line_number,
+                                       const char* output_file) const {
+
+        std::ofstream fout(output_file, std::ios_base::app);
+
+        ATOM_BAD_STREAM(!fout.is_open());
+
+        fout << "-------------------\n"
+                "Class roaring_bitmap_t:\n"
+                "time: "       << __TIME__        << "\n"
+                "file: "       << file            << "\n"
+                "function: "   << function_name   << "\n"
+                "line: "       << line_number     << "\n"
+                "status: "     << (is_valid() ? "ok\n{\n" : "FAIL\n{\n");
+        fout << "\tchunks: "   << chunks_.size()  << "\n";
+
+        const chunk_t* data = chunks_.data();
+        for (size_type i = 0; i < chunks_.size(); ++i) {
+            fout << "\t" << data[i] << "\n";
+        }
+
+        fout << "}\n"
+                "-------------------\n";
+
+        fout.close();
+    }
+
+}
+
+#endif // ATOM_ROARING_HPP
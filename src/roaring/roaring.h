@@ -0,0 +1,315 @@
+//-----------------------------------------------------------------------------
+//! @file roaring.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Compressed bitmap over 32-bit ids
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_ROARING_H
+#define ATOM_ROARING_H 1
+
+#include "bool/bool_space.h"
+#include "vector/vector.h"
+#include "simd/simd.h"
+#include "exceptions.h"
+#include "debug_tools.h"
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @namespace roaring_detail
+    //! @brief Chunks of roaring_bitmap_t
+    //-----------------------------------------------------------------------------
+    namespace roaring_detail {
+
+        enum class chunk_kind : unsigned char {
+            array,  //!< Sorted low halves
+            bitmap, //!< 2^16 bits
+            run     //!< Sorted pairs (start, length - 1)
+        };
+
+        struct chunk_t {
+            unsigned int             key  = 0;                 //!< High half of the ids
+            chunk_kind               kind = chunk_kind::array;
+            unsigned int             card = 0;                 //!< Count of the ids
+            vector_t<unsigned short> values;                   //!< Array or runs
+            vector_t<bool>           bits;                     //!< Bitmap
+
+            friend std::ostream& operator<<(std::ostream& out, const chunk_t& chunk) {
+                static const char* const names[] = {"array", "bitmap", "run"};
+
+                return out << "[" << chunk.key << "] " << names[static_cast<int>(chunk.kind)]
+                           << " card: " << chunk.card;
+            }
+        };
+
+    }
+
+    //! vector_t does not point into itself, so chunks are shifted by memmove() on insert and erase
+    template<>
+    struct is_trivially_relocatable<roaring_detail::chunk_t> : std::true_type {
+    };
+
+    //-----------------------------------------------------------------------------
+    //! @class roaring_bitmap_t
+    //! @brief Set of 32-bit ids which takes memory by the count of ids, not by their range
+    //! @details Ids are split in chunks of 2^16 by the high half, every chunk keeps the low halves as
+    //! @details a sorted array (up to 4096 ids), a bitmap of 2^16 bits (vector_t<bool>) or
+    //! @details sorted runs (start, length - 1) after run_optimize().
+    //! @details Dense chunks are combined by the block operations of vector_t<bool>,
+    //! @details sparse ones are merged, so and/or are proportional to the stored data
+    //-----------------------------------------------------------------------------
+    class roaring_bitmap_t {
+    public:
+
+        using size_type  = std::size_t;   //!< Size type
+        using value_type = std::uint32_t; //!< Type of id
+
+        static constexpr size_type CHUNK_BITS = size_type(1) << 16; //!< Ids per chunk
+        static constexpr size_type ARRAY_MAX  = 4096;               //!< The biggest array chunk
+
+        //-----------------------------------------------------------------------------
+        //! @brief Default constructor
+        //-----------------------------------------------------------------------------
+        roaring_bitmap_t() noexcept = default;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor from the dense bitmap
+        //! @details Id of every set bit is its position, chunks are chosen by the count of bits
+        //! @param bits Dense bitmap
+        //! @throw atom::outOfRange When size of bits is bigger than 2^32
+        //! @throws The same exceptions as vector_t::push_back()
+        //-----------------------------------------------------------------------------
+        explicit roaring_bitmap_t(const vector_t<bool>& bits);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Check the id
+        //! @param id Id
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitmap is not valid
+        //! @return True if id is in the bitmap, otherwise false
+        //-----------------------------------------------------------------------------
+        bool operator[](const value_type id) const;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Add the id
+        //! @details Run chunk is unpacked before the change
+        //! @param id Id
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitmap is not valid
+        //! @throws The same exceptions as vector_t::insert()
+        //-----------------------------------------------------------------------------
+        void set(const value_type id);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Remove the id
+        //! @details Bitmap chunk becomes an array when it has ARRAY_MAX ids
+        //! @param id Id
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitmap is not valid
+        //! @throws The same exceptions as vector_t::push_back()
+        //-----------------------------------------------------------------------------
+        void reset(const value_type id);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the ids
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitmap is not valid
+        //-----------------------------------------------------------------------------
+        size_type count() const {
+            ATOM_ASSERT_VALID(this);
+
+            size_type result = 0;
+            for (size_type i = 0; i < chunks_.size(); ++i) {
+                result += chunks_[i].card;
+            }
+            return result;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Checks the bitmap on the void
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitmap is not valid
+        //-----------------------------------------------------------------------------
+        bool empty() const {
+            ATOM_ASSERT_VALID(this);
+            return chunks_.empty();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief The biggest id
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitmap is not valid
+        //! @throw atom::outOfRange When bitmap is empty
+        //-----------------------------------------------------------------------------
+        value_type last() const;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Remove all ids and free the memory
+        //-----------------------------------------------------------------------------
+        void clear() noexcept {
+            chunks_.clear();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Call fn(id) for every id in ascending order
+        //! @tparam Fn Type of the callable object
+        //! @param fn Callable object, it must not change the bitmap
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitmap is not valid
+        //-----------------------------------------------------------------------------
+        template<typename Fn>
+        void for_each_set(Fn&& fn) const {
+            ATOM_ASSERT_VALID(this);
+
+            for (size_type i = 0; i < chunks_.size(); ++i) {
+                const value_type base = static_cast<value_type>(chunks_[i].key) << 16;
+
+                for_each_value(chunks_[i], [&](const size_type low) {
+                    fn(base + static_cast<value_type>(low));
+                });
+            }
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Dense bitmap of the ids
+        //! @details Bitmap chunks are copied by blocks
+        //! @param size Size of the result
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitmap is not valid
+        //! @throw atom::outOfRange When last() is not less than size
+        //! @throws The same exceptions as the constructor of vector_t<bool>
+        //! @return Vector where bit id is set for every id of the bitmap
+        //-----------------------------------------------------------------------------
+        vector_t<bool> to_bits(const size_type size) const;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Keep every chunk in the smallest form: array, bitmap or runs
+        //! @details Runs take 4 bytes per run, it pays off on long sequences of ids
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitmap is not valid
+        //! @throws The same exceptions as vector_t::push_back()
+        //! @return True if bitmap has run chunks
+        //-----------------------------------------------------------------------------
+        bool run_optimize();
+
+        //-----------------------------------------------------------------------------
+        //! @brief Keep the ids which are in that too
+        //! @details Bitmap chunks are combined in place
+        //! @param that The second operand
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitmap is not valid
+        //! @throws The same exceptions as vector_t::push_back()
+        //! @return Reference to the calling object
+        //-----------------------------------------------------------------------------
+        roaring_bitmap_t& operator&=(const roaring_bitmap_t& that);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Add the ids of that
+        //! @param that The second operand
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when bitmap is not valid
+        //! @throws The same exceptions as vector_t::push_back()
+        //! @return Reference to the calling object
+        //-----------------------------------------------------------------------------
+        roaring_bitmap_t& operator|=(const roaring_bitmap_t& that);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Ids which are in both bitmaps
+        //! @details Only chunks with the same key are visited, operands are not copied
+        //! @param lhs The first operand
+        //! @param rhs The second operand
+        //! @throws The same exceptions as vector_t::push_back()
+        //! @return New bitmap
+        //-----------------------------------------------------------------------------
+        friend roaring_bitmap_t operator&(const roaring_bitmap_t& lhs, const roaring_bitmap_t& rhs) {
+            return combined_and(lhs, rhs);
+        }
+
+        //! @brief Ids which are in any of bitmaps, see operator&()
+        friend roaring_bitmap_t operator|(const roaring_bitmap_t& lhs, const roaring_bitmap_t& rhs) {
+            roaring_bitmap_t result(lhs);
+            result |= rhs;
+
+            return result;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the ids of lhs & rhs
+        //! @details Bitmap chunks are counted by and_count() of vector_t<bool>, result is not stored
+        //! @param lhs The first operand
+        //! @param rhs The second operand
+        //! @return (lhs & rhs).count()
+        //-----------------------------------------------------------------------------
+        friend size_type and_count(const roaring_bitmap_t& lhs, const roaring_bitmap_t& rhs) {
+            return combined_and_count(lhs, rhs);
+        }
+
+        //! @brief (lhs | rhs).count() without the result, see and_count()
+        friend size_type or_count(const roaring_bitmap_t& lhs, const roaring_bitmap_t& rhs) {
+            return lhs.count() + rhs.count() - combined_and_count(lhs, rhs);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Memory of the chunks in bytes
+        //-----------------------------------------------------------------------------
+        size_type memory_usage() const;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Silent verifier
+        //! @return True if bitmap is valid else return false
+        //-----------------------------------------------------------------------------
+        bool is_valid() const noexcept;
+
+    private:
+
+        static constexpr size_type CHUNK_WORDS = CHUNK_BITS / BIT_BLOCK_SIZE;
+
+        using chunk_t    = roaring_detail::chunk_t;
+        using chunk_kind = roaring_detail::chunk_kind;
+
+        vector_t<chunk_t> chunks_; //!< Non-empty chunks sorted by key
+
+        size_type lower_chunk(const unsigned int key) const noexcept;
+
+        template<typename Fn>
+        static void for_each_value(const chunk_t& chunk, Fn&& fn);
+
+        static bool contains(const chunk_t& chunk, const unsigned int low) noexcept;
+        static void fill_bitmap(const chunk_t& chunk, bit_container_type* words) noexcept;
+        static vector_t<bool> bitmap_of(const chunk_t& chunk);
+        static size_type count_runs(const chunk_t& chunk) noexcept;
+
+        static void to_array(chunk_t& chunk);
+        static void to_bitmap(chunk_t& chunk);
+        static void to_run(chunk_t& chunk);
+        static void unpack(chunk_t& chunk);
+
+        static size_type merge_and(const unsigned short* lhs, const size_type lhs_size,
+                                   const unsigned short* rhs, const size_type rhs_size,
+                                   unsigned short*       result) noexcept;
+        static size_type merge_or(const unsigned short* lhs, const size_type lhs_size,
+                                  const unsigned short* rhs, const size_type rhs_size,
+                                  unsigned short*       result) noexcept;
+
+        static bool and_chunks(const chunk_t& lhs, const chunk_t& rhs, chunk_t& result);
+        static void or_chunks(const chunk_t& lhs, const chunk_t& rhs, chunk_t& result);
+        static size_type and_count_chunks(const chunk_t& lhs, const chunk_t& rhs);
+
+        static roaring_bitmap_t combined_and(const roaring_bitmap_t& lhs, const roaring_bitmap_t& rhs);
+        static size_type combined_and_count(const roaring_bitmap_t& lhs, const roaring_bitmap_t& rhs);
+
+        void dump(const char* file,
+                  const char* function_name,
+                  int         line_number,
+                  const char* output_file = "__roaring_dump.txt") const;
+    };
+
+}
+
+#include "implement/roaring.hpp"
+
+#endif // ATOM_ROARING_H
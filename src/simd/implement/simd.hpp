@@ -0,0 +1,1422 @@
+#ifndef ATOM_SIMD_HPP
+#define ATOM_SIMD_HPP 1
+
+#include <algorithm>
+#include "exceptions.h"
+
+#ifdef ATOM_SIMD_X86
+#include <immintrin.h>
+#endif
+
+
+namespace atom {
+
+    inline simd_level detected_simd_level() noexcept {
+#ifdef ATOM_SIMD_X86
+        static const simd_level level = []() noexcept {
+            __builtin_cpu_init();
+
+            if (__builtin_cpu_supports("avx512f")) {
+                return simd_level::avx512;
+            }
+            if (__builtin_cpu_supports("avx2")) {
+                return simd_level::avx2;
+            }
+            if (__builtin_cpu_supports("sse2")) {
+                return simd_level::sse2;
+            }
+            return simd_level::scalar;
+        }();
+
+        return level;
+#else
+        return simd_level::scalar;
+#endif
+    }
+
+    //-----------------------------------------------------------------------------
+    //! @namespace atom::simd_kernel
+    //! @brief Kernels for the fixed instruction set, they do not check cpuid
+    //-----------------------------------------------------------------------------
+    namespace simd_kernel {
+
+        //! Count kernels keep 32-bit counters in the lanes, longer data is split on chunks
+        constexpr std::size_t COUNT_CHUNK = std::size_t(1) << 30;
+
+        template<typename Tp>
+        std::size_t find_scalar(const Tp* data, const std::size_t n, const Tp& value) {
+            for (std::size_t i = 0; i < n; ++i) {
+                if (data[i] == value) {
+                    return i;
+                }
+            }
+            return n;
+        }
+
+        template<typename Tp>
+        std::size_t count_scalar(const Tp* data, const std::size_t n, const Tp& value) {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                count += data[i] == value;
+            }
+            return count;
+        }
+
+        template<bool is_min, typename Tp>
+        Tp minmax_scalar(const Tp* data, const std::size_t n, Tp best) {
+            for (std::size_t i = 0; i < n; ++i) {
+                if (is_min ? data[i] < best : best < data[i]) {
+                    best = data[i];
+                }
+            }
+            return best;
+        }
+
+        template<typename Tp>
+        simd_sum_t<Tp> sum_scalar(const Tp* data, const std::size_t n) {
+            simd_sum_t<Tp> sum = simd_sum_t<Tp>();
+            for (std::size_t i = 0; i < n; ++i) {
+                sum += data[i];
+            }
+            return sum;
+        }
+
+        inline std::size_t popcount_scalar(const unsigned long long* data, const std::size_t n) {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                count += static_cast<std::size_t>(__builtin_popcountll(data[i]));
+            }
+            return count;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Position of the set bit with number rank (from zero) in word
+        //! @details word must have more than rank set bits
+        //-----------------------------------------------------------------------------
+        inline unsigned int select_in_word_scalar(unsigned long long word, unsigned int rank) noexcept {
+            for (; rank; --rank) {
+                word &= word - 1;
+            }
+            return static_cast<unsigned int>(__builtin_ctzll(word));
+        }
+
+        template<simd_bit_op op>
+        unsigned long long bit_apply(const unsigned long long lhs, const unsigned long long rhs) noexcept {
+            if constexpr (op == simd_bit_op::and_) {
+                return lhs & rhs;
+            }
+            else if constexpr (op == simd_bit_op::or_) {
+                return lhs | rhs;
+            }
+            else if constexpr (op == simd_bit_op::xor_) {
+                return lhs ^ rhs;
+            }
+            else {
+                return lhs & ~rhs;
+            }
+        }
+
+        template<simd_bit_op op>
+        void combine_scalar(unsigned long long*       dst,
+                            const unsigned long long* lhs,
+                            const unsigned long long* rhs,
+                            const std::size_t         n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                dst[i] = bit_apply<op>(lhs[i], rhs[i]);
+            }
+        }
+
+        template<simd_bit_op op>
+        std::size_t combine_count_scalar(const unsigned long long* lhs,
+                                         const unsigned long long* rhs,
+                                         const std::size_t         n) {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                count += static_cast<std::size_t>(__builtin_popcountll(bit_apply<op>(lhs[i], rhs[i])));
+            }
+            return count;
+        }
+
+        // dst[i] = src[i] >> shift | src[i + 1] << (64 - shift), ascending, dst <= src
+        inline void shift_right_scalar(unsigned long long*       dst,
+                                       const unsigned long long* src,
+                                       const std::size_t         n,
+                                       const unsigned int        shift) {
+            for (std::size_t i = 0; i < n; ++i) {
+                dst[i] = src[i] >> shift | src[i + 1] << (64 - shift);
+            }
+        }
+
+        // dst[i] = src[i] << shift | src[i - 1] >> (64 - shift), descending, dst >= src
+        inline void shift_left_scalar(unsigned long long*       dst,
+                                      const unsigned long long* src,
+                                      const std::size_t         n,
+                                      const unsigned int        shift) {
+            for (std::size_t i = n; i-- > 0;) {
+                dst[i] = src[i] << shift | src[i - 1] >> (64 - shift);
+            }
+        }
+
+        // dst[i] = field first + i of width bits
+        inline void unpack_bits_scalar(std::uint32_t*            dst,
+                                       const unsigned long long* src,
+                                       const std::size_t         first,
+                                       const std::size_t         n,
+                                       const unsigned int        width) {
+            const unsigned long long mask = (1ULL << width) - 1;
+
+            for (std::size_t i = 0; i < n; ++i) {
+                const std::size_t  pos    = (first + i) * width;
+                const unsigned int offset = static_cast<unsigned int>(pos % 64);
+                unsigned long long word   = src[pos / 64] >> offset;
+
+                if (offset + width > 64) {
+                    word |= src[pos / 64 + 1] << (64 - offset);
+                }
+                dst[i] = static_cast<std::uint32_t>(word & mask);
+            }
+        }
+
+        // Byte after the last word of the fields [first, first + n), gathers must not read behind it
+        inline std::size_t unpack_end_byte(const std::size_t first, const std::size_t n, const unsigned int width) {
+            return ((first + n) * width + 63) / 64 * 8;
+        }
+
+#ifdef ATOM_SIMD_X86
+
+        //-----------------------------------------------------------------------------
+        //! @brief Processor has the instruction popcnt
+        //-----------------------------------------------------------------------------
+        inline bool has_popcnt() noexcept {
+            static const bool result = (__builtin_cpu_init(), __builtin_cpu_supports("popcnt"));
+            return result;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Processor has AVX512_VPOPCNTDQ
+        //-----------------------------------------------------------------------------
+        inline bool has_vpopcntdq() noexcept {
+            static const bool result = (__builtin_cpu_init(), __builtin_cpu_supports("avx512vpopcntdq"));
+            return result;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Processor has BMI2 (pdep)
+        //-----------------------------------------------------------------------------
+        inline bool has_bmi2() noexcept {
+            static const bool result = (__builtin_cpu_init(), __builtin_cpu_supports("bmi2"));
+            return result;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief select_in_word_scalar() in two instructions: pdep deposits 1 << rank on the set bits
+        //-----------------------------------------------------------------------------
+        ATOM_SIMD_TARGET("bmi,bmi2")
+        inline unsigned int select_in_word_bmi2(const unsigned long long word, const unsigned int rank) noexcept {
+            return static_cast<unsigned int>(_tzcnt_u64(_pdep_u64(1ULL << rank, word)));
+        }
+
+        ATOM_SIMD_TARGET("popcnt")
+        inline std::size_t popcount_popcnt(const unsigned long long* data, const std::size_t n) {
+            std::size_t count0 = 0;
+            std::size_t count1 = 0;
+            std::size_t i      = 0;
+
+            // Two counters break the dependency chain of popcnt
+            for (; i + 2 <= n; i += 2) {
+                count0 += static_cast<std::size_t>(__builtin_popcountll(data[i]));
+                count1 += static_cast<std::size_t>(__builtin_popcountll(data[i + 1]));
+            }
+            if (i < n) {
+                count0 += static_cast<std::size_t>(__builtin_popcountll(data[i]));
+            }
+
+            return count0 + count1;
+        }
+
+        template<simd_bit_op op>
+        ATOM_SIMD_TARGET("popcnt")
+        inline std::size_t combine_count_popcnt(const unsigned long long* lhs,
+                                                const unsigned long long* rhs,
+                                                const std::size_t         n) {
+            std::size_t count0 = 0;
+            std::size_t count1 = 0;
+            std::size_t i      = 0;
+
+            for (; i + 2 <= n; i += 2) {
+                count0 += static_cast<std::size_t>(__builtin_popcountll(bit_apply<op>(lhs[i], rhs[i])));
+                count1 += static_cast<std::size_t>(__builtin_popcountll(bit_apply<op>(lhs[i + 1], rhs[i + 1])));
+            }
+            if (i < n) {
+                count0 += static_cast<std::size_t>(__builtin_popcountll(bit_apply<op>(lhs[i], rhs[i])));
+            }
+
+            return count0 + count1;
+        }
+
+        //-----------------------------------------------------------------------------
+        // SSE2: 4 lanes
+        //-----------------------------------------------------------------------------
+
+        ATOM_SIMD_TARGET("sse2")
+        inline std::size_t find_i32_sse2(const std::int32_t* data, const std::size_t n, const std::int32_t value) {
+            const __m128i needle = _mm_set1_epi32(value);
+            std::size_t   i      = 0;
+
+            for (; i + 16 <= n; i += 16) {
+                const __m128i* p  = reinterpret_cast<const __m128i*>(data + i);
+                const __m128i  eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128(p),     needle),
+                                                              _mm_cmpeq_epi32(_mm_loadu_si128(p + 1), needle)),
+                                                 _mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128(p + 2), needle),
+                                                              _mm_cmpeq_epi32(_mm_loadu_si128(p + 3), needle)));
+                if (_mm_movemask_epi8(eq)) {
+                    break;
+                }
+            }
+
+            return i + find_scalar(data + i, n - i, value);
+        }
+
+        ATOM_SIMD_TARGET("sse2")
+        inline std::size_t count_i32_sse2(const std::int32_t* data, const std::size_t n, const std::int32_t value) {
+            const __m128i needle = _mm_set1_epi32(value);
+            __m128i       acc    = _mm_setzero_si128();
+            std::size_t   i      = 0;
+
+            for (; i + 4 <= n; i += 4) {
+                const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(x, needle));
+            }
+
+            alignas(16) std::uint32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+
+            return std::size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3] +
+                   count_scalar(data + i, n - i, value);
+        }
+
+        template<bool is_min>
+        ATOM_SIMD_TARGET("sse2")
+        inline std::int32_t minmax_i32_sse2(const std::int32_t* data, const std::size_t n) {
+            __m128i     best = _mm_set1_epi32(data[0]);
+            std::size_t i    = 0;
+
+            for (; i + 4 <= n; i += 4) {
+                const __m128i x    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                const __m128i take = is_min ? _mm_cmplt_epi32(x, best) : _mm_cmpgt_epi32(x, best);
+
+                best = _mm_or_si128(_mm_and_si128(take, x), _mm_andnot_si128(take, best));
+            }
+
+            alignas(16) std::int32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), best);
+
+            return minmax_scalar<is_min>(data + i, n - i, minmax_scalar<is_min>(lanes, 4, lanes[0]));
+        }
+
+        ATOM_SIMD_TARGET("sse2")
+        inline long long sum_i32_sse2(const std::int32_t* data, const std::size_t n) {
+            __m128i     acc = _mm_setzero_si128();
+            std::size_t i   = 0;
+
+            for (; i + 4 <= n; i += 4) {
+                const __m128i x    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                const __m128i sign = _mm_srai_epi32(x, 31);
+
+                acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(x, sign));
+                acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(x, sign));
+            }
+
+            alignas(16) long long lanes[2];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+
+            return lanes[0] + lanes[1] + sum_scalar(data + i, n - i);
+        }
+
+        ATOM_SIMD_TARGET("sse2")
+        inline std::size_t find_f32_sse2(const float* data, const std::size_t n, const float value) {
+            const __m128 needle = _mm_set1_ps(value);
+            std::size_t  i      = 0;
+
+            for (; i + 16 <= n; i += 16) {
+                const float* p  = data + i;
+                const __m128 eq = _mm_or_ps(_mm_or_ps(_mm_cmpeq_ps(_mm_loadu_ps(p),     needle),
+                                                      _mm_cmpeq_ps(_mm_loadu_ps(p + 4), needle)),
+                                            _mm_or_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + 8),  needle),
+                                                      _mm_cmpeq_ps(_mm_loadu_ps(p + 12), needle)));
+                if (_mm_movemask_ps(eq)) {
+                    break;
+                }
+            }
+
+            return i + find_scalar(data + i, n - i, value);
+        }
+
+        ATOM_SIMD_TARGET("sse2")
+        inline std::size_t count_f32_sse2(const float* data, const std::size_t n, const float value) {
+            const __m128 needle = _mm_set1_ps(value);
+            __m128i      acc    = _mm_setzero_si128();
+            std::size_t  i      = 0;
+
+            for (; i + 4 <= n; i += 4) {
+                acc = _mm_sub_epi32(acc, _mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(data + i), needle)));
+            }
+
+            alignas(16) std::uint32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+
+            return std::size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3] +
+                   count_scalar(data + i, n - i, value);
+        }
+
+        template<bool is_min>
+        ATOM_SIMD_TARGET("sse2")
+        inline float minmax_f32_sse2(const float* data, const std::size_t n) {
+            __m128      best = _mm_set1_ps(data[0]);
+            std::size_t i    = 0;
+
+            for (; i + 4 <= n; i += 4) {
+                const __m128 x = _mm_loadu_ps(data + i);
+                best = is_min ? _mm_min_ps(best, x) : _mm_max_ps(best, x);
+            }
+
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, best);
+
+            return minmax_scalar<is_min>(data + i, n - i, minmax_scalar<is_min>(lanes, 4, lanes[0]));
+        }
+
+        ATOM_SIMD_TARGET("sse2")
+        inline float sum_f32_sse2(const float* data, const std::size_t n) {
+            __m128      acc0 = _mm_setzero_ps();
+            __m128      acc1 = _mm_setzero_ps();
+            std::size_t i    = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                acc0 = _mm_add_ps(acc0, _mm_loadu_ps(data + i));
+                acc1 = _mm_add_ps(acc1, _mm_loadu_ps(data + i + 4));
+            }
+
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, _mm_add_ps(acc0, acc1));
+
+            return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + sum_scalar(data + i, n - i);
+        }
+
+        template<simd_bit_op op>
+        ATOM_SIMD_TARGET("sse2")
+        inline __m128i bit_apply_sse2(const __m128i lhs, const __m128i rhs) {
+            if constexpr (op == simd_bit_op::and_) {
+                return _mm_and_si128(lhs, rhs);
+            }
+            else if constexpr (op == simd_bit_op::or_) {
+                return _mm_or_si128(lhs, rhs);
+            }
+            else if constexpr (op == simd_bit_op::xor_) {
+                return _mm_xor_si128(lhs, rhs);
+            }
+            else {
+                return _mm_andnot_si128(rhs, lhs);
+            }
+        }
+
+        template<simd_bit_op op>
+        ATOM_SIMD_TARGET("sse2")
+        inline void combine_sse2(unsigned long long*       dst,
+                                 const unsigned long long* lhs,
+                                 const unsigned long long* rhs,
+                                 const std::size_t         n) {
+            std::size_t i = 0;
+
+            for (; i + 2 <= n; i += 2) {
+                const __m128i x = bit_apply_sse2<op>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i)),
+                                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), x);
+            }
+
+            combine_scalar<op>(dst + i, lhs + i, rhs + i, n - i);
+        }
+
+        // Every block of words is loaded before it is stored, so the overlap of dst and src is allowed
+        ATOM_SIMD_TARGET("sse2")
+        inline void shift_right_sse2(unsigned long long*       dst,
+                                     const unsigned long long* src,
+                                     const std::size_t         n,
+                                     const unsigned int        shift) {
+            const __m128i right = _mm_cvtsi32_si128(static_cast<int>(shift));
+            const __m128i left  = _mm_cvtsi32_si128(static_cast<int>(64 - shift));
+            std::size_t   i     = 0;
+
+            for (; i + 2 <= n; i += 2) {
+                const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 1));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_or_si128(_mm_srl_epi64(lo, right),
+                                                                                   _mm_sll_epi64(hi, left)));
+            }
+
+            shift_right_scalar(dst + i, src + i, n - i, shift);
+        }
+
+        ATOM_SIMD_TARGET("sse2")
+        inline void shift_left_sse2(unsigned long long*       dst,
+                                    const unsigned long long* src,
+                                    const std::size_t         n,
+                                    const unsigned int        shift) {
+            const __m128i left  = _mm_cvtsi32_si128(static_cast<int>(shift));
+            const __m128i right = _mm_cvtsi32_si128(static_cast<int>(64 - shift));
+            std::size_t   i     = n;
+
+            for (; i >= 2; i -= 2) {
+                const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i - 2));
+                const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i - 3));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i - 2), _mm_or_si128(_mm_sll_epi64(hi, left),
+                                                                                       _mm_srl_epi64(lo, right)));
+            }
+
+            shift_left_scalar(dst, src, i, shift);
+        }
+
+        //-----------------------------------------------------------------------------
+        // AVX2: 8 lanes
+        //-----------------------------------------------------------------------------
+
+        ATOM_SIMD_TARGET("avx2")
+        inline std::size_t find_i32_avx2(const std::int32_t* data, const std::size_t n, const std::int32_t value) {
+            const __m256i needle = _mm256_set1_epi32(value);
+            std::size_t   i      = 0;
+
+            for (; i + 32 <= n; i += 32) {
+                const __m256i* p  = reinterpret_cast<const __m256i*>(data + i);
+                const __m256i  eq = _mm256_or_si256(
+                                        _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_loadu_si256(p),     needle),
+                                                        _mm256_cmpeq_epi32(_mm256_loadu_si256(p + 1), needle)),
+                                        _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_loadu_si256(p + 2), needle),
+                                                        _mm256_cmpeq_epi32(_mm256_loadu_si256(p + 3), needle)));
+                if (!_mm256_testz_si256(eq, eq)) {
+                    break;
+                }
+            }
+
+            return i + find_scalar(data + i, n - i, value);
+        }
+
+        ATOM_SIMD_TARGET("avx2")
+        inline std::size_t count_i32_avx2(const std::int32_t* data, const std::size_t n, const std::int32_t value) {
+            const __m256i needle = _mm256_set1_epi32(value);
+            __m256i       acc    = _mm256_setzero_si256();
+            std::size_t   i      = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(x, needle));
+            }
+
+            alignas(32) std::uint32_t lanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+
+            std::size_t count = count_scalar(data + i, n - i, value);
+            for (const std::uint32_t lane : lanes) {
+                count += lane;
+            }
+            return count;
+        }
+
+        template<bool is_min>
+        ATOM_SIMD_TARGET("avx2")
+        inline std::int32_t minmax_i32_avx2(const std::int32_t* data, const std::size_t n) {
+            __m256i     best = _mm256_set1_epi32(data[0]);
+            std::size_t i    = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                best = is_min ? _mm256_min_epi32(best, x) : _mm256_max_epi32(best, x);
+            }
+
+            alignas(32) std::int32_t lanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), best);
+
+            return minmax_scalar<is_min>(data + i, n - i, minmax_scalar<is_min>(lanes, 8, lanes[0]));
+        }
+
+        ATOM_SIMD_TARGET("avx2")
+        inline long long sum_i32_avx2(const std::int32_t* data, const std::size_t n) {
+            __m256i     acc0 = _mm256_setzero_si256();
+            __m256i     acc1 = _mm256_setzero_si256();
+            std::size_t i    = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                const __m128i* p = reinterpret_cast<const __m128i*>(data + i);
+
+                acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm_loadu_si128(p)));
+                acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm_loadu_si128(p + 1)));
+            }
+
+            alignas(32) long long lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(acc0, acc1));
+
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_scalar(data + i, n - i);
+        }
+
+        ATOM_SIMD_TARGET("avx2")
+        inline std::size_t find_f32_avx2(const float* data, const std::size_t n, const float value) {
+            const __m256 needle = _mm256_set1_ps(value);
+            std::size_t  i      = 0;
+
+            for (; i + 32 <= n; i += 32) {
+                const float* p  = data + i;
+                const __m256 eq = _mm256_or_ps(
+                                      _mm256_or_ps(_mm256_cmp_ps(_mm256_loadu_ps(p),      needle, _CMP_EQ_OQ),
+                                                   _mm256_cmp_ps(_mm256_loadu_ps(p + 8),  needle, _CMP_EQ_OQ)),
+                                      _mm256_or_ps(_mm256_cmp_ps(_mm256_loadu_ps(p + 16), needle, _CMP_EQ_OQ),
+                                                   _mm256_cmp_ps(_mm256_loadu_ps(p + 24), needle, _CMP_EQ_OQ)));
+                if (_mm256_movemask_ps(eq)) {
+                    break;
+                }
+            }
+
+            return i + find_scalar(data + i, n - i, value);
+        }
+
+        ATOM_SIMD_TARGET("avx2")
+        inline std::size_t count_f32_avx2(const float* data, const std::size_t n, const float value) {
+            const __m256 needle = _mm256_set1_ps(value);
+            __m256i      acc    = _mm256_setzero_si256();
+            std::size_t  i      = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                const __m256 eq = _mm256_cmp_ps(_mm256_loadu_ps(data + i), needle, _CMP_EQ_OQ);
+                acc = _mm256_sub_epi32(acc, _mm256_castps_si256(eq));
+            }
+
+            alignas(32) std::uint32_t lanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+
+            std::size_t count = count_scalar(data + i, n - i, value);
+            for (const std::uint32_t lane : lanes) {
+                count += lane;
+            }
+            return count;
+        }
+
+        template<bool is_min>
+        ATOM_SIMD_TARGET("avx2")
+        inline float minmax_f32_avx2(const float* data, const std::size_t n) {
+            __m256      best = _mm256_set1_ps(data[0]);
+            std::size_t i    = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                const __m256 x = _mm256_loadu_ps(data + i);
+                best = is_min ? _mm256_min_ps(best, x) : _mm256_max_ps(best, x);
+            }
+
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, best);
+
+            return minmax_scalar<is_min>(data + i, n - i, minmax_scalar<is_min>(lanes, 8, lanes[0]));
+        }
+
+        ATOM_SIMD_TARGET("avx2")
+        inline float sum_f32_avx2(const float* data, const std::size_t n) {
+            __m256      acc0 = _mm256_setzero_ps();
+            __m256      acc1 = _mm256_setzero_ps();
+            std::size_t i    = 0;
+
+            for (; i + 16 <= n; i += 16) {
+                acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(data + i));
+                acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(data + i + 8));
+            }
+
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, _mm256_add_ps(acc0, acc1));
+
+            return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+                   ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7])) + sum_scalar(data + i, n - i);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the set bits in every byte by the nibble lookup with vpshufb
+        //-----------------------------------------------------------------------------
+        ATOM_SIMD_TARGET("avx2")
+        inline __m256i popcount_epi8_avx2(const __m256i x) {
+            const __m256i lookup   = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                      0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m256i low_mask = _mm256_set1_epi8(0x0f);
+            const __m256i lo       = _mm256_and_si256(x, low_mask);
+            const __m256i hi       = _mm256_and_si256(_mm256_srli_epi16(x, 4), low_mask);
+
+            return _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+        }
+
+        ATOM_SIMD_TARGET("avx2")
+        inline std::size_t sum_epi64_avx2(const __m256i acc) {
+            alignas(32) unsigned long long lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+
+            return static_cast<std::size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+        }
+
+        ATOM_SIMD_TARGET("avx2,popcnt")
+        inline std::size_t popcount_avx2(const unsigned long long* data, const std::size_t n) {
+            __m256i     acc = _mm256_setzero_si256();
+            std::size_t i   = 0;
+
+            while (i + 4 <= n) {
+                // Byte counters take at most 8 * 8 bits before they are summed by vpsadbw
+                __m256i bytes = _mm256_setzero_si256();
+
+                for (int step = 0; step < 8 && i + 4 <= n; ++step, i += 4) {
+                    const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                    bytes = _mm256_add_epi8(bytes, popcount_epi8_avx2(x));
+                }
+
+                acc = _mm256_add_epi64(acc, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+            }
+
+            return sum_epi64_avx2(acc) + popcount_popcnt(data + i, n - i);
+        }
+
+        template<simd_bit_op op>
+        ATOM_SIMD_TARGET("avx2")
+        inline __m256i bit_apply_avx2(const __m256i lhs, const __m256i rhs) {
+            if constexpr (op == simd_bit_op::and_) {
+                return _mm256_and_si256(lhs, rhs);
+            }
+            else if constexpr (op == simd_bit_op::or_) {
+                return _mm256_or_si256(lhs, rhs);
+            }
+            else if constexpr (op == simd_bit_op::xor_) {
+                return _mm256_xor_si256(lhs, rhs);
+            }
+            else {
+                return _mm256_andnot_si256(rhs, lhs);
+            }
+        }
+
+        template<simd_bit_op op>
+        ATOM_SIMD_TARGET("avx2")
+        inline void combine_avx2(unsigned long long*       dst,
+                                 const unsigned long long* lhs,
+                                 const unsigned long long* rhs,
+                                 const std::size_t         n) {
+            std::size_t i = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                const __m256i x0 = bit_apply_avx2<op>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i)),
+                                                      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i)));
+                const __m256i x1 = bit_apply_avx2<op>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i + 4)),
+                                                      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i + 4)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),     x0);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 4), x1);
+            }
+
+            combine_scalar<op>(dst + i, lhs + i, rhs + i, n - i);
+        }
+
+        template<simd_bit_op op>
+        ATOM_SIMD_TARGET("avx2,popcnt")
+        inline std::size_t combine_count_avx2(const unsigned long long* lhs,
+                                              const unsigned long long* rhs,
+                                              const std::size_t         n) {
+            __m256i     acc = _mm256_setzero_si256();
+            std::size_t i   = 0;
+
+            while (i + 4 <= n) {
+                __m256i bytes = _mm256_setzero_si256();
+
+                for (int step = 0; step < 8 && i + 4 <= n; ++step, i += 4) {
+                    const __m256i x = bit_apply_avx2<op>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i)),
+                                                         _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i)));
+                    bytes = _mm256_add_epi8(bytes, popcount_epi8_avx2(x));
+                }
+
+                acc = _mm256_add_epi64(acc, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+            }
+
+            return sum_epi64_avx2(acc) + combine_count_popcnt<op>(lhs + i, rhs + i, n - i);
+        }
+
+        ATOM_SIMD_TARGET("avx2")
+        inline void shift_right_avx2(unsigned long long*       dst,
+                                     const unsigned long long* src,
+                                     const std::size_t         n,
+                                     const unsigned int        shift) {
+            const __m128i right = _mm_cvtsi32_si128(static_cast<int>(shift));
+            const __m128i left  = _mm_cvtsi32_si128(static_cast<int>(64 - shift));
+            std::size_t   i     = 0;
+
+            for (; i + 4 <= n; i += 4) {
+                const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 1));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_or_si256(_mm256_srl_epi64(lo, right),
+                                                                                         _mm256_sll_epi64(hi, left)));
+            }
+
+            shift_right_scalar(dst + i, src + i, n - i, shift);
+        }
+
+        ATOM_SIMD_TARGET("avx2")
+        inline void shift_left_avx2(unsigned long long*       dst,
+                                    const unsigned long long* src,
+                                    const std::size_t         n,
+                                    const unsigned int        shift) {
+            const __m128i left  = _mm_cvtsi32_si128(static_cast<int>(shift));
+            const __m128i right = _mm_cvtsi32_si128(static_cast<int>(64 - shift));
+            std::size_t   i     = n;
+
+            for (; i >= 4; i -= 4) {
+                const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i - 4));
+                const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i - 5));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i - 4), _mm256_or_si256(_mm256_sll_epi64(hi, left),
+                                                                                             _mm256_srl_epi64(lo, right)));
+            }
+
+            shift_left_scalar(dst, src, i, shift);
+        }
+
+        // Every lane loads 4 bytes at the byte of its field and shifts by the rest, so width + 7 <= 32
+        ATOM_SIMD_TARGET("avx2")
+        inline void unpack_bits_avx2(std::uint32_t*            dst,
+                                     const unsigned long long* src,
+                                     const std::size_t         first,
+                                     const std::size_t         n,
+                                     const unsigned int        width) {
+            const char*       bytes    = reinterpret_cast<const char*>(src);
+            const std::size_t end_byte = unpack_end_byte(first, n, width);
+            const __m256i     lanes    = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                                            _mm256_set1_epi32(static_cast<int>(width)));
+            const __m256i     mask     = _mm256_set1_epi32(static_cast<int>((1U << width) - 1));
+            const __m256i     all      = _mm256_set1_epi32(-1);
+            std::size_t       i        = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                const std::size_t pos = (first + i) * width;
+
+                if ((pos + 7 * width) / 8 + 4 > end_byte) {
+                    break;
+                }
+
+                const __m256i bits  = _mm256_add_epi32(lanes, _mm256_set1_epi32(static_cast<int>(pos % 8)));
+                const __m256i words = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                                                                  reinterpret_cast<const int*>(bytes + pos / 8),
+                                                                  _mm256_srli_epi32(bits, 3), all, 1);
+                const __m256i value = _mm256_and_si256(_mm256_srlv_epi32(words, _mm256_and_si256(bits, _mm256_set1_epi32(7))),
+                                                       mask);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), value);
+            }
+
+            unpack_bits_scalar(dst + i, src, first + i, n - i, width);
+        }
+
+        //-----------------------------------------------------------------------------
+        // AVX-512F: 16 lanes
+        //-----------------------------------------------------------------------------
+
+        ATOM_SIMD_TARGET("avx512f")
+        inline std::size_t find_i32_avx512(const std::int32_t* data, const std::size_t n, const std::int32_t value) {
+            const __m512i needle = _mm512_set1_epi32(value);
+            std::size_t   i      = 0;
+
+            for (; i + 64 <= n; i += 64) {
+                const std::int32_t* p = data + i;
+                const unsigned      eq = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(p),      needle) |
+                                         _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(p + 16), needle) |
+                                         _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(p + 32), needle) |
+                                         _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(p + 48), needle);
+                if (eq) {
+                    break;
+                }
+            }
+
+            return i + find_scalar(data + i, n - i, value);
+        }
+
+        ATOM_SIMD_TARGET("avx512f")
+        inline std::size_t count_i32_avx512(const std::int32_t* data, const std::size_t n, const std::int32_t value) {
+            const __m512i needle = _mm512_set1_epi32(value);
+            const __m512i one    = _mm512_set1_epi32(1);
+            __m512i       acc    = _mm512_setzero_si512();
+            std::size_t   i      = 0;
+
+            for (; i + 16 <= n; i += 16) {
+                const __mmask16 eq = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i), needle);
+                acc = _mm512_mask_add_epi32(acc, eq, acc, one);
+            }
+
+            alignas(64) std::uint32_t lanes[16];
+            _mm512_store_si512(lanes, acc);
+
+            std::size_t count = count_scalar(data + i, n - i, value);
+            for (const std::uint32_t lane : lanes) {
+                count += lane;
+            }
+            return count;
+        }
+
+        template<bool is_min>
+        ATOM_SIMD_TARGET("avx512f")
+        inline std::int32_t minmax_i32_avx512(const std::int32_t* data, const std::size_t n) {
+            __m512i     best = _mm512_set1_epi32(data[0]);
+            std::size_t i    = 0;
+
+            for (; i + 16 <= n; i += 16) {
+                const __m512i x = _mm512_loadu_si512(data + i);
+                // Masked forms have an explicit source, unmasked ones merge with an undefined vector
+                best = is_min ? _mm512_mask_min_epi32(best, 0xFFFF, best, x) : _mm512_mask_max_epi32(best, 0xFFFF, best, x);
+            }
+
+            alignas(64) std::int32_t lanes[16];
+            _mm512_store_si512(lanes, best);
+
+            return minmax_scalar<is_min>(data + i, n - i, minmax_scalar<is_min>(lanes, 16, lanes[0]));
+        }
+
+        ATOM_SIMD_TARGET("avx512f")
+        inline long long sum_i32_avx512(const std::int32_t* data, const std::size_t n) {
+            __m512i     acc0 = _mm512_setzero_si512();
+            __m512i     acc1 = _mm512_setzero_si512();
+            std::size_t i    = 0;
+
+            for (; i + 16 <= n; i += 16) {
+                const __m256i* p = reinterpret_cast<const __m256i*>(data + i);
+
+                acc0 = _mm512_add_epi64(acc0, _mm512_maskz_cvtepi32_epi64(0xFF, _mm256_loadu_si256(p)));
+                acc1 = _mm512_add_epi64(acc1, _mm512_maskz_cvtepi32_epi64(0xFF, _mm256_loadu_si256(p + 1)));
+            }
+
+            alignas(64) long long lanes[8];
+            _mm512_store_si512(lanes, _mm512_add_epi64(acc0, acc1));
+
+            long long sum = sum_scalar(data + i, n - i);
+            for (const long long lane : lanes) {
+                sum += lane;
+            }
+            return sum;
+        }
+
+        ATOM_SIMD_TARGET("avx512f")
+        inline std::size_t find_f32_avx512(const float* data, const std::size_t n, const float value) {
+            const __m512 needle = _mm512_set1_ps(value);
+            std::size_t  i      = 0;
+
+            for (; i + 64 <= n; i += 64) {
+                const float*   p  = data + i;
+                const unsigned eq = _mm512_cmp_ps_mask(_mm512_loadu_ps(p),      needle, _CMP_EQ_OQ) |
+                                    _mm512_cmp_ps_mask(_mm512_loadu_ps(p + 16), needle, _CMP_EQ_OQ) |
+                                    _mm512_cmp_ps_mask(_mm512_loadu_ps(p + 32), needle, _CMP_EQ_OQ) |
+                                    _mm512_cmp_ps_mask(_mm512_loadu_ps(p + 48), needle, _CMP_EQ_OQ);
+                if (eq) {
+                    break;
+                }
+            }
+
+            return i + find_scalar(data + i, n - i, value);
+        }
+
+        ATOM_SIMD_TARGET("avx512f")
+        inline std::size_t count_f32_avx512(const float* data, const std::size_t n, const float value) {
+            const __m512  needle = _mm512_set1_ps(value);
+            const __m512i one    = _mm512_set1_epi32(1);
+            __m512i       acc    = _mm512_setzero_si512();
+            std::size_t   i      = 0;
+
+            for (; i + 16 <= n; i += 16) {
+                const __mmask16 eq = _mm512_cmp_ps_mask(_mm512_loadu_ps(data + i), needle, _CMP_EQ_OQ);
+                acc = _mm512_mask_add_epi32(acc, eq, acc, one);
+            }
+
+            alignas(64) std::uint32_t lanes[16];
+            _mm512_store_si512(lanes, acc);
+
+            std::size_t count = count_scalar(data + i, n - i, value);
+            for (const std::uint32_t lane : lanes) {
+                count += lane;
+            }
+            return count;
+        }
+
+        template<bool is_min>
+        ATOM_SIMD_TARGET("avx512f")
+        inline float minmax_f32_avx512(const float* data, const std::size_t n) {
+            __m512      best = _mm512_set1_ps(data[0]);
+            std::size_t i    = 0;
+
+            for (; i + 16 <= n; i += 16) {
+                const __m512 x = _mm512_loadu_ps(data + i);
+                best = is_min ? _mm512_mask_min_ps(best, 0xFFFF, best, x) : _mm512_mask_max_ps(best, 0xFFFF, best, x);
+            }
+
+            alignas(64) float lanes[16];
+            _mm512_store_ps(lanes, best);
+
+            return minmax_scalar<is_min>(data + i, n - i, minmax_scalar<is_min>(lanes, 16, lanes[0]));
+        }
+
+        ATOM_SIMD_TARGET("avx512f")
+        inline float sum_f32_avx512(const float* data, const std::size_t n) {
+            __m512      acc0 = _mm512_setzero_ps();
+            __m512      acc1 = _mm512_setzero_ps();
+            std::size_t i    = 0;
+
+            for (; i + 32 <= n; i += 32) {
+                acc0 = _mm512_add_ps(acc0, _mm512_loadu_ps(data + i));
+                acc1 = _mm512_add_ps(acc1, _mm512_loadu_ps(data + i + 16));
+            }
+
+            alignas(64) float lanes[16];
+            _mm512_store_ps(lanes, _mm512_add_ps(acc0, acc1));
+
+            float sum = 0;
+            for (std::size_t lane = 0; lane < 16; lane += 2) {
+                sum += lanes[lane] + lanes[lane + 1];
+            }
+            return sum + sum_scalar(data + i, n - i);
+        }
+
+        ATOM_SIMD_TARGET("avx512f,avx512vpopcntdq,popcnt")
+        inline std::size_t popcount_avx512(const unsigned long long* data, const std::size_t n) {
+            __m512i     acc0 = _mm512_setzero_si512();
+            __m512i     acc1 = _mm512_setzero_si512();
+            std::size_t i    = 0;
+
+            for (; i + 16 <= n; i += 16) {
+                acc0 = _mm512_add_epi64(acc0, _mm512_popcnt_epi64(_mm512_loadu_si512(data + i)));
+                acc1 = _mm512_add_epi64(acc1, _mm512_popcnt_epi64(_mm512_loadu_si512(data + i + 8)));
+            }
+
+            alignas(64) unsigned long long lanes[8];
+            _mm512_store_si512(lanes, _mm512_add_epi64(acc0, acc1));
+
+            std::size_t count = popcount_popcnt(data + i, n - i);
+            for (const unsigned long long lane : lanes) {
+                count += static_cast<std::size_t>(lane);
+            }
+            return count;
+        }
+
+        template<simd_bit_op op>
+        ATOM_SIMD_TARGET("avx512f")
+        inline __m512i bit_apply_avx512(const __m512i lhs, const __m512i rhs) {
+            if constexpr (op == simd_bit_op::and_) {
+                return _mm512_and_si512(lhs, rhs);
+            }
+            else if constexpr (op == simd_bit_op::or_) {
+                return _mm512_or_si512(lhs, rhs);
+            }
+            else if constexpr (op == simd_bit_op::xor_) {
+                return _mm512_xor_si512(lhs, rhs);
+            }
+            else {
+                return _mm512_maskz_andnot_epi64(0xFF, rhs, lhs);
+            }
+        }
+
+        template<simd_bit_op op>
+        ATOM_SIMD_TARGET("avx512f")
+        inline void combine_avx512(unsigned long long*       dst,
+                                   const unsigned long long* lhs,
+                                   const unsigned long long* rhs,
+                                   const std::size_t         n) {
+            std::size_t i = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                _mm512_storeu_si512(dst + i, bit_apply_avx512<op>(_mm512_loadu_si512(lhs + i),
+                                                                  _mm512_loadu_si512(rhs + i)));
+            }
+
+            combine_scalar<op>(dst + i, lhs + i, rhs + i, n - i);
+        }
+
+        template<simd_bit_op op>
+        ATOM_SIMD_TARGET("avx512f,avx512vpopcntdq,popcnt")
+        inline std::size_t combine_count_avx512(const unsigned long long* lhs,
+                                                const unsigned long long* rhs,
+                                                const std::size_t         n) {
+            __m512i     acc0 = _mm512_setzero_si512();
+            __m512i     acc1 = _mm512_setzero_si512();
+            std::size_t i    = 0;
+
+            for (; i + 16 <= n; i += 16) {
+                const __m512i x0 = bit_apply_avx512<op>(_mm512_loadu_si512(lhs + i),     _mm512_loadu_si512(rhs + i));
+                const __m512i x1 = bit_apply_avx512<op>(_mm512_loadu_si512(lhs + i + 8), _mm512_loadu_si512(rhs + i + 8));
+                acc0 = _mm512_add_epi64(acc0, _mm512_popcnt_epi64(x0));
+                acc1 = _mm512_add_epi64(acc1, _mm512_popcnt_epi64(x1));
+            }
+
+            alignas(64) unsigned long long lanes[8];
+            _mm512_store_si512(lanes, _mm512_add_epi64(acc0, acc1));
+
+            std::size_t count = combine_count_popcnt<op>(lhs + i, rhs + i, n - i);
+            for (const unsigned long long lane : lanes) {
+                count += static_cast<std::size_t>(lane);
+            }
+            return count;
+        }
+
+        ATOM_SIMD_TARGET("avx512f")
+        inline void shift_right_avx512(unsigned long long*       dst,
+                                       const unsigned long long* src,
+                                       const std::size_t         n,
+                                       const unsigned int        shift) {
+            const __m128i right = _mm_cvtsi32_si128(static_cast<int>(shift));
+            const __m128i left  = _mm_cvtsi32_si128(static_cast<int>(64 - shift));
+            std::size_t   i     = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                const __m512i lo = _mm512_loadu_si512(src + i);
+                const __m512i hi = _mm512_loadu_si512(src + i + 1);
+                _mm512_storeu_si512(dst + i, _mm512_or_si512(_mm512_maskz_srl_epi64(0xFF, lo, right),
+                                                             _mm512_maskz_sll_epi64(0xFF, hi, left)));
+            }
+
+            shift_right_scalar(dst + i, src + i, n - i, shift);
+        }
+
+        ATOM_SIMD_TARGET("avx512f")
+        inline void shift_left_avx512(unsigned long long*       dst,
+                                      const unsigned long long* src,
+                                      const std::size_t         n,
+                                      const unsigned int        shift) {
+            const __m128i left  = _mm_cvtsi32_si128(static_cast<int>(shift));
+            const __m128i right = _mm_cvtsi32_si128(static_cast<int>(64 - shift));
+            std::size_t   i     = n;
+
+            for (; i >= 8; i -= 8) {
+                const __m512i hi = _mm512_loadu_si512(src + i - 8);
+                const __m512i lo = _mm512_loadu_si512(src + i - 9);
+                _mm512_storeu_si512(dst + i - 8, _mm512_or_si512(_mm512_maskz_sll_epi64(0xFF, hi, left),
+                                                                 _mm512_maskz_srl_epi64(0xFF, lo, right)));
+            }
+
+            shift_left_scalar(dst, src, i, shift);
+        }
+
+        ATOM_SIMD_TARGET("avx512f")
+        inline void unpack_bits_avx512(std::uint32_t*            dst,
+                                       const unsigned long long* src,
+                                       const std::size_t         first,
+                                       const std::size_t         n,
+                                       const unsigned int        width) {
+            const char*       bytes    = reinterpret_cast<const char*>(src);
+            const std::size_t end_byte = unpack_end_byte(first, n, width);
+            const __m512i     lanes    = _mm512_maskz_mullo_epi32(0xFFFF,
+                                                                  _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
+                                                                                    8, 9, 10, 11, 12, 13, 14, 15),
+                                                                  _mm512_set1_epi32(static_cast<int>(width)));
+            const __m512i     mask     = _mm512_set1_epi32(static_cast<int>((1U << width) - 1));
+            const __m512i     seven    = _mm512_set1_epi32(7);
+            std::size_t       i        = 0;
+
+            for (; i + 16 <= n; i += 16) {
+                const std::size_t pos = (first + i) * width;
+
+                if ((pos + 15 * width) / 8 + 4 > end_byte) {
+                    break;
+                }
+
+                const __m512i bits  = _mm512_maskz_add_epi32(0xFFFF, lanes, _mm512_set1_epi32(static_cast<int>(pos % 8)));
+                const __m512i words = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF,
+                                                                  _mm512_maskz_srli_epi32(0xFFFF, bits, 3),
+                                                                  bytes + pos / 8, 1);
+                const __m512i shift = _mm512_maskz_and_epi32(0xFFFF, bits, seven);
+                const __m512i value = _mm512_maskz_and_epi32(0xFFFF, _mm512_maskz_srlv_epi32(0xFFFF, words, shift), mask);
+                _mm512_storeu_si512(dst + i, value);
+            }
+
+            unpack_bits_scalar(dst + i, src, first + i, n - i, width);
+        }
+
+#endif // ATOM_SIMD_X86
+
+        template<typename Tp>
+        std::size_t count_chunk(const Tp* data, const std::size_t n, const Tp& value, const simd_level level) {
+#ifdef ATOM_SIMD_X86
+            if constexpr (std::is_same<Tp, std::int32_t>::value) {
+                switch (level) {
+                    case simd_level::avx512: return count_i32_avx512(data, n, value);
+                    case simd_level::avx2:   return count_i32_avx2(data, n, value);
+                    case simd_level::sse2:   return count_i32_sse2(data, n, value);
+                    case simd_level::scalar: break;
+                }
+            }
+            else if constexpr (std::is_same<Tp, float>::value) {
+                switch (level) {
+                    case simd_level::avx512: return count_f32_avx512(data, n, value);
+                    case simd_level::avx2:   return count_f32_avx2(data, n, value);
+                    case simd_level::sse2:   return count_f32_sse2(data, n, value);
+                    case simd_level::scalar: break;
+                }
+            }
+#endif
+            (void)level;
+            return count_scalar(data, n, value);
+        }
+
+        template<bool is_min, typename Tp>
+        Tp minmax(const Tp* data, const std::size_t n, const simd_level level) {
+            ATOM_OUT_OF_RANGE(!n);
+
+#ifdef ATOM_SIMD_X86
+            if constexpr (std::is_same<Tp, std::int32_t>::value) {
+                switch (level) {
+                    case simd_level::avx512: return minmax_i32_avx512<is_min>(data, n);
+                    case simd_level::avx2:   return minmax_i32_avx2<is_min>(data, n);
+                    case simd_level::sse2:   return minmax_i32_sse2<is_min>(data, n);
+                    case simd_level::scalar: break;
+                }
+            }
+            else if constexpr (std::is_same<Tp, float>::value) {
+                switch (level) {
+                    case simd_level::avx512: return minmax_f32_avx512<is_min>(data, n);
+                    case simd_level::avx2:   return minmax_f32_avx2<is_min>(data, n);
+                    case simd_level::sse2:   return minmax_f32_sse2<is_min>(data, n);
+                    case simd_level::scalar: break;
+                }
+            }
+#endif
+            (void)level;
+            return minmax_scalar<is_min>(data + 1, n - 1, data[0]);
+        }
+
+        template<simd_bit_op op>
+        void combine(unsigned long long*       dst,
+                     const unsigned long long* lhs,
+                     const unsigned long long* rhs,
+                     const std::size_t         n,
+                     const simd_level          level) {
+#ifdef ATOM_SIMD_X86
+            switch (level) {
+                case simd_level::avx512: return combine_avx512<op>(dst, lhs, rhs, n);
+                case simd_level::avx2:   return combine_avx2<op>(dst, lhs, rhs, n);
+                case simd_level::sse2:   return combine_sse2<op>(dst, lhs, rhs, n);
+                case simd_level::scalar: break;
+            }
+#endif
+            (void)level;
+            combine_scalar<op>(dst, lhs, rhs, n);
+        }
+
+        template<simd_bit_op op>
+        std::size_t combine_count(const unsigned long long* lhs,
+                                  const unsigned long long* rhs,
+                                  const std::size_t         n,
+                                  const simd_level          level) {
+#ifdef ATOM_SIMD_X86
+            if (level == simd_level::avx512 && has_vpopcntdq()) {
+                return combine_count_avx512<op>(lhs, rhs, n);
+            }
+            if (level >= simd_level::avx2) {
+                return combine_count_avx2<op>(lhs, rhs, n);
+            }
+            if (level == simd_level::sse2 && has_popcnt()) {
+                return combine_count_popcnt<op>(lhs, rhs, n);
+            }
+#endif
+            (void)level;
+            return combine_count_scalar<op>(lhs, rhs, n);
+        }
+
+    }
+
+    template<typename Tp>
+    std::size_t simd_find(const Tp*         data,
+                          const std::size_t n,
+                          const Tp&         value,
+                          simd_level        level) {
+        level = std::min(level, detected_simd_level());
+
+#ifdef ATOM_SIMD_X86
+        if constexpr (std::is_same<Tp, std::int32_t>::value) {
+            switch (level) {
+                case simd_level::avx512: return simd_kernel::find_i32_avx512(data, n, value);
+                case simd_level::avx2:   return simd_kernel::find_i32_avx2(data, n, value);
+                case simd_level::sse2:   return simd_kernel::find_i32_sse2(data, n, value);
+                case simd_level::scalar: break;
+            }
+        }
+        else if constexpr (std::is_same<Tp, float>::value) {
+            switch (level) {
+                case simd_level::avx512: return simd_kernel::find_f32_avx512(data, n, value);
+                case simd_level::avx2:   return simd_kernel::find_f32_avx2(data, n, value);
+                case simd_level::sse2:   return simd_kernel::find_f32_sse2(data, n, value);
+                case simd_level::scalar: break;
+            }
+        }
+#endif
+
+        return simd_kernel::find_scalar(data, n, value);
+    }
+
+    template<typename Tp>
+    std::size_t simd_count(const Tp*         data,
+                           const std::size_t n,
+                           const Tp&         value,
+                           simd_level        level) {
+        level = std::min(level, detected_simd_level());
+
+        std::size_t count = 0;
+
+        for (std::size_t offset = 0; offset < n; offset += simd_kernel::COUNT_CHUNK) {
+            const std::size_t chunk = std::min(n - offset, simd_kernel::COUNT_CHUNK);
+            count += simd_kernel::count_chunk(data + offset, chunk, value, level);
+        }
+
+        return count;
+    }
+
+    template<typename Tp>
+    Tp simd_min(const Tp*         data,
+                const std::size_t n,
+                simd_level        level) {
+        return simd_kernel::minmax<true>(data, n, std::min(level, detected_simd_level()));
+    }
+
+    template<typename Tp>
+    Tp simd_max(const Tp*         data,
+                const std::size_t n,
+                simd_level        level) {
+        return simd_kernel::minmax<false>(data, n, std::min(level, detected_simd_level()));
+    }
+
+    inline std::size_t simd_popcount(const unsigned long long* data,
+                                     const std::size_t         n,
+                                     simd_level                level) {
+        level = std::min(level, detected_simd_level());
+
+#ifdef ATOM_SIMD_X86
+        if (level == simd_level::avx512 && simd_kernel::has_vpopcntdq()) {
+            return simd_kernel::popcount_avx512(data, n);
+        }
+        if (level >= simd_level::avx2) {
+            return simd_kernel::popcount_avx2(data, n);
+        }
+        if (level == simd_level::sse2 && simd_kernel::has_popcnt()) {
+            return simd_kernel::popcount_popcnt(data, n);
+        }
+#endif
+
+        return simd_kernel::popcount_scalar(data, n);
+    }
+
+    inline void simd_bit_combine(unsigned long long*       dst,
+                                 const unsigned long long* lhs,
+                                 const unsigned long long* rhs,
+                                 const std::size_t         n,
+                                 const simd_bit_op         op,
+                                 simd_level                level) {
+        level = std::min(level, detected_simd_level());
+
+        switch (op) {
+            case simd_bit_op::and_:    return simd_kernel::combine<simd_bit_op::and_>(dst, lhs, rhs, n, level);
+            case simd_bit_op::or_:     return simd_kernel::combine<simd_bit_op::or_>(dst, lhs, rhs, n, level);
+            case simd_bit_op::xor_:    return simd_kernel::combine<simd_bit_op::xor_>(dst, lhs, rhs, n, level);
+            case simd_bit_op::and_not: return simd_kernel::combine<simd_bit_op::and_not>(dst, lhs, rhs, n, level);
+        }
+    }
+
+    inline std::size_t simd_bit_combine_count(const unsigned long long* lhs,
+                                              const unsigned long long* rhs,
+                                              const std::size_t         n,
+                                              const simd_bit_op         op,
+                                              simd_level                level) {
+        level = std::min(level, detected_simd_level());
+
+        switch (op) {
+            case simd_bit_op::and_:    return simd_kernel::combine_count<simd_bit_op::and_>(lhs, rhs, n, level);
+            case simd_bit_op::or_:     return simd_kernel::combine_count<simd_bit_op::or_>(lhs, rhs, n, level);
+            case simd_bit_op::xor_:    return simd_kernel::combine_count<simd_bit_op::xor_>(lhs, rhs, n, level);
+            case simd_bit_op::and_not: return simd_kernel::combine_count<simd_bit_op::and_not>(lhs, rhs, n, level);
+        }
+        return 0;
+    }
+
+    inline void simd_shift_right_words(unsigned long long*       dst,
+                                       const unsigned long long* src,
+                                       const std::size_t         n,
+                                       const unsigned int        shift,
+                                       simd_level                level) {
+        level = std::min(level, detected_simd_level());
+
+#ifdef ATOM_SIMD_X86
+        switch (level) {
+            case simd_level::avx512: return simd_kernel::shift_right_avx512(dst, src, n, shift);
+            case simd_level::avx2:   return simd_kernel::shift_right_avx2(dst, src, n, shift);
+            case simd_level::sse2:   return simd_kernel::shift_right_sse2(dst, src, n, shift);
+            case simd_level::scalar: break;
+        }
+#endif
+
+        simd_kernel::shift_right_scalar(dst, src, n, shift);
+    }
+
+    inline void simd_shift_left_words(unsigned long long*       dst,
+                                      const unsigned long long* src,
+                                      const std::size_t         n,
+                                      const unsigned int        shift,
+                                      simd_level                level) {
+        level = std::min(level, detected_simd_level());
+
+#ifdef ATOM_SIMD_X86
+        switch (level) {
+            case simd_level::avx512: return simd_kernel::shift_left_avx512(dst, src, n, shift);
+            case simd_level::avx2:   return simd_kernel::shift_left_avx2(dst, src, n, shift);
+            case simd_level::sse2:   return simd_kernel::shift_left_sse2(dst, src, n, shift);
+            case simd_level::scalar: break;
+        }
+#endif
+
+        simd_kernel::shift_left_scalar(dst, src, n, shift);
+    }
+
+    inline void simd_unpack_bits(std::uint32_t*            dst,
+                                 const unsigned long long* src,
+                                 const std::size_t         first,
+                                 const std::size_t         n,
+                                 const unsigned int        width,
+                                 simd_level                level) {
+        level = std::min(level, detected_simd_level());
+
+#ifdef ATOM_SIMD_X86
+        if (width <= 25) {
+            switch (level) {
+                case simd_level::avx512: return simd_kernel::unpack_bits_avx512(dst, src, first, n, width);
+                case simd_level::avx2:   return simd_kernel::unpack_bits_avx2(dst, src, first, n, width);
+                case simd_level::sse2:
+                case simd_level::scalar: break;
+            }
+        }
+#endif
+
+        simd_kernel::unpack_bits_scalar(dst, src, first, n, width);
+    }
+
+    template<typename Tp>
+    simd_sum_t<Tp> simd_sum(const Tp*         data,
+                            const std::size_t n,
+                            simd_level        level) {
+        level = std::min(level, detected_simd_level());
+
+#ifdef ATOM_SIMD_X86
+        if constexpr (std::is_same<Tp, std::int32_t>::value) {
+            switch (level) {
+                case simd_level::avx512: return simd_kernel::sum_i32_avx512(data, n);
+                case simd_level::avx2:   return simd_kernel::sum_i32_avx2(data, n);
+                case simd_level::sse2:   return simd_kernel::sum_i32_sse2(data, n);
+                case simd_level::scalar: break;
+            }
+        }
+        else if constexpr (std::is_same<Tp, float>::value) {
+            switch (level) {
+                case simd_level::avx512: return simd_kernel::sum_f32_avx512(data, n);
+                case simd_level::avx2:   return simd_kernel::sum_f32_avx2(data, n);
+                case simd_level::sse2:   return simd_kernel::sum_f32_sse2(data, n);
+                case simd_level::scalar: break;
+            }
+        }
+#endif
+
+        return simd_kernel::sum_scalar(data, n);
+    }
+
+}
+
+#endif // ATOM_SIMD_HPP
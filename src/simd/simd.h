@@ -0,0 +1,261 @@
+//-----------------------------------------------------------------------------
+//! @file simd.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Search and reduction kernels over contiguous arithmetic data
+//! with runtime dispatch to SSE2, AVX2 or AVX-512
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_SIMD_H
+#define ATOM_SIMD_H 1
+
+#include "exceptions.h"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    //! Kernels for x86 are compiled with target attributes and selected by cpuid
+    #define ATOM_SIMD_X86 1
+
+    //! Function is compiled for the instruction set isa, it must be called only after the check of cpuid
+    #define ATOM_SIMD_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @enum simd_level
+    //! @brief Instruction set of the kernels, bigger level includes smaller ones
+    //-----------------------------------------------------------------------------
+    enum class simd_level : unsigned char {
+        scalar = 0, //!< Plain loops
+        sse2   = 1, //!< 128-bit kernels
+        avx2   = 2, //!< 256-bit kernels
+        avx512 = 3  //!< 512-bit kernels (AVX-512F)
+    };
+
+    //-----------------------------------------------------------------------------
+    //! @brief The best level which is supported by the processor and the OS
+    //! @details cpuid is asked once, next calls return cached value
+    //! @return Detected level, simd_level::scalar on other architectures
+    //-----------------------------------------------------------------------------
+    inline simd_level detected_simd_level() noexcept;
+
+    //-----------------------------------------------------------------------------
+    //! @brief Type of the result of simd_sum()
+    //! @details Integers are summed in 64 bits, floating point types in their own type
+    //! @tparam Tp The type of the elements
+    //-----------------------------------------------------------------------------
+    template<typename Tp>
+    using simd_sum_t = typename std::conditional<std::is_integral<Tp>::value,
+                                                 typename std::conditional<std::is_signed<Tp>::value,
+                                                                           long long,
+                                                                           unsigned long long>::type,
+                                                 Tp>::type;
+
+    //-----------------------------------------------------------------------------
+    //! @brief Search of the value
+    //! @details std::int32_t and float use vector kernels, other types use operator==
+    //! @details level is clamped by detected_simd_level(), it is used to compare the kernels
+    //! @param data Pointer on the first element
+    //! @param n Count of elements
+    //! @param value Searched value
+    //! @param level The biggest level of the kernel
+    //! @return Number of the first element which is equal to value, n when there is no such element
+    //-----------------------------------------------------------------------------
+    template<typename Tp>
+    std::size_t simd_find(const Tp*         data,
+                          const std::size_t n,
+                          const Tp&         value,
+                          simd_level        level = detected_simd_level());
+
+    //-----------------------------------------------------------------------------
+    //! @brief Count of the value
+    //! @details std::int32_t and float use vector kernels, other types use operator==
+    //! @param data Pointer on the first element
+    //! @param n Count of elements
+    //! @param value Counted value
+    //! @param level The biggest level of the kernel
+    //! @return Count of elements which are equal to value
+    //-----------------------------------------------------------------------------
+    template<typename Tp>
+    std::size_t simd_count(const Tp*         data,
+                           const std::size_t n,
+                           const Tp&         value,
+                           simd_level        level = detected_simd_level());
+
+    //-----------------------------------------------------------------------------
+    //! @brief Minimal element
+    //! @details std::int32_t and float use vector kernels, other types use operator<
+    //! @details Result is unspecified when float data contains NaN
+    //! @param data Pointer on the first element
+    //! @param n Count of elements
+    //! @param level The biggest level of the kernel
+    //! @throw atom::outOfRange When n is zero
+    //! @return Copy of the minimal element
+    //-----------------------------------------------------------------------------
+    template<typename Tp>
+    Tp simd_min(const Tp*         data,
+                const std::size_t n,
+                simd_level        level = detected_simd_level());
+
+    //-----------------------------------------------------------------------------
+    //! @brief Maximal element
+    //! @details std::int32_t and float use vector kernels, other types use operator<
+    //! @details Result is unspecified when float data contains NaN
+    //! @param data Pointer on the first element
+    //! @param n Count of elements
+    //! @param level The biggest level of the kernel
+    //! @throw atom::outOfRange When n is zero
+    //! @return Copy of the maximal element
+    //-----------------------------------------------------------------------------
+    template<typename Tp>
+    Tp simd_max(const Tp*         data,
+                const std::size_t n,
+                simd_level        level = detected_simd_level());
+
+    //-----------------------------------------------------------------------------
+    //! @brief Sum of elements
+    //! @details std::int32_t and float use vector kernels, other types use operator+
+    //! @details Vector kernels keep partial sums in lanes, so float result
+    //! @details can differ from sequential summation in the last bits
+    //! @param data Pointer on the first element
+    //! @param n Count of elements
+    //! @param level The biggest level of the kernel
+    //! @return Sum of elements, zero when n is zero
+    //-----------------------------------------------------------------------------
+    template<typename Tp>
+    simd_sum_t<Tp> simd_sum(const Tp*         data,
+                            const std::size_t n,
+                            simd_level        level = detected_simd_level());
+
+
+    //-----------------------------------------------------------------------------
+    //! @brief Count of the set bits in n words
+    //! @details sse2 level uses the popcnt instruction when processor has it,
+    //! @details avx2 level uses the nibble lookup by vpshufb,
+    //! @details avx512 level uses vpopcntq when processor has AVX512_VPOPCNTDQ, otherwise avx2 kernel
+    //! @param data Pointer on the first word
+    //! @param n Count of words
+    //! @param level The biggest level of the kernel
+    //! @return Count of the set bits
+    //-----------------------------------------------------------------------------
+    inline std::size_t simd_popcount(const unsigned long long* data,
+                                     const std::size_t         n,
+                                     simd_level                level = detected_simd_level());
+
+    //-----------------------------------------------------------------------------
+    //! @enum simd_bit_op
+    //! @brief Bitwise operation of simd_bit_combine() and simd_bit_combine_count()
+    //-----------------------------------------------------------------------------
+    enum class simd_bit_op : unsigned char {
+        and_    = 0, //!< lhs & rhs
+        or_     = 1, //!< lhs | rhs
+        xor_    = 2, //!< lhs ^ rhs
+        and_not = 3  //!< lhs & ~rhs
+    };
+
+    //-----------------------------------------------------------------------------
+    //! @brief Bitwise operation over n words
+    //! @details dst[i] = lhs[i] op rhs[i], dst can be equal to lhs or rhs
+    //! @param dst Pointer on the first word of the result
+    //! @param lhs Pointer on the first word of the left operand
+    //! @param rhs Pointer on the first word of the right operand
+    //! @param n Count of words
+    //! @param op Operation
+    //! @param level The biggest level of the kernel
+    //-----------------------------------------------------------------------------
+    inline void simd_bit_combine(unsigned long long*       dst,
+                                 const unsigned long long* lhs,
+                                 const unsigned long long* rhs,
+                                 const std::size_t         n,
+                                 const simd_bit_op         op,
+                                 simd_level                level = detected_simd_level());
+
+    //-----------------------------------------------------------------------------
+    //! @brief Count of the set bits in the result of the bitwise operation
+    //! @details The result is not stored, words are combined and counted in registers
+    //! @details Kernels are chosen the same way as in simd_popcount()
+    //! @param lhs Pointer on the first word of the left operand
+    //! @param rhs Pointer on the first word of the right operand
+    //! @param n Count of words
+    //! @param op Operation
+    //! @param level The biggest level of the kernel
+    //! @return Count of the set bits of lhs op rhs
+    //-----------------------------------------------------------------------------
+    inline std::size_t simd_bit_combine_count(const unsigned long long* lhs,
+                                              const unsigned long long* rhs,
+                                              const std::size_t         n,
+                                              const simd_bit_op         op,
+                                              simd_level                level = detected_simd_level());
+
+    //-----------------------------------------------------------------------------
+    //! @brief Funnel shift of n words to the lower bits
+    //! @details dst[i] = src[i] >> shift | src[i + 1] << (64 - shift), n + 1 words of src are read.
+    //! @details Words are written in ascending order after they are read, so dst may overlap src when dst <= src
+    //! @param dst Pointer on the first word of the result
+    //! @param src Pointer on the first word of the source
+    //! @param n Count of the result words
+    //! @param shift Shift in [1, 63]
+    //! @param level The biggest level of the kernel
+    //-----------------------------------------------------------------------------
+    inline void simd_shift_right_words(unsigned long long*       dst,
+                                       const unsigned long long* src,
+                                       const std::size_t         n,
+                                       const unsigned int        shift,
+                                       simd_level                level = detected_simd_level());
+
+    //-----------------------------------------------------------------------------
+    //! @brief Funnel shift of n words to the higher bits
+    //! @details dst[i] = src[i] << shift | src[i - 1] >> (64 - shift), src[-1] is read.
+    //! @details Words are written in descending order, so dst may overlap src when dst >= src
+    //! @param dst Pointer on the first word of the result
+    //! @param src Pointer on the first word of the source
+    //! @param n Count of the result words
+    //! @param shift Shift in [1, 63]
+    //! @param level The biggest level of the kernel
+    //-----------------------------------------------------------------------------
+    inline void simd_shift_left_words(unsigned long long*       dst,
+                                      const unsigned long long* src,
+                                      const std::size_t         n,
+                                      const unsigned int        shift,
+                                      simd_level                level = detected_simd_level());
+
+
+    //-----------------------------------------------------------------------------
+    //! @brief Unpack of n fields of width bits
+    //! @details dst[i] = bits [(first + i) * width, (first + i + 1) * width) of src, bit pos is
+    //! @details (src[pos / 64] >> pos % 64) & 1. Only the words which hold the fields are read.
+    //! @details Widths up to 25 are gathered by AVX2 and AVX-512, other widths use the scalar kernel
+    //! @param dst Pointer on the first field of the result
+    //! @param src Pointer on the first word of the packed fields
+    //! @param first Number of the first unpacked field
+    //! @param n Count of the fields
+    //! @param width Width of the field in [1, 32]
+    //! @param level The biggest level of the kernel
+    //-----------------------------------------------------------------------------
+    inline void simd_unpack_bits(std::uint32_t*            dst,
+                                 const unsigned long long* src,
+                                 const std::size_t         first,
+                                 const std::size_t         n,
+                                 const unsigned int        width,
+                                 simd_level                level = detected_simd_level());
+
+}
+
+//! @brief Implementation of the kernels
+#include "implement/simd.hpp"
+
+#endif // ATOM_SIMD_H
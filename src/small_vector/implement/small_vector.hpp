@@ -0,0 +1,421 @@
+#ifndef ATOM_SMALL_VECTOR_HPP
+#define ATOM_SMALL_VECTOR_HPP 1
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <memory.h>
+#include "exceptions.h"
+#include "debug_tools.h"
+
+
+namespace atom {
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    const small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>&
+    small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::operator=(const small_vector_t& that) {
+        if (this == &that) {
+            return *this;
+        }
+
+        const bool propagate = alloc_traits::propagate_on_container_copy_assignment::value;
+
+        small_vector_t tmp_vector(propagate ? that.allocator() : allocator());
+        tmp_vector.assign_copy(that.data_, that.size_);
+
+        clear();
+        if (propagate) {
+            allocator() = that.allocator();
+        }
+        take(tmp_vector);
+
+        return *this;
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>&
+    small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::operator=(small_vector_t&& that) {
+        if (this == &that) {
+            return *this;
+        }
+
+        if (alloc_traits::propagate_on_container_move_assignment::value) {
+            clear();
+            allocator() = std::move(that.allocator());
+            take(that);
+        }
+        else if (that.is_inline() || allocator() == that.allocator()) {
+            clear();
+            take(that);
+        }
+        else {
+            clear();
+            reserve(that.size_);
+
+            relocate(that.data_, that.size_, data_);
+            size_      = that.size_;
+            that.size_ = 0;
+
+            that.clear();
+        }
+
+        ATOM_ASSERT_VALID(this);
+        return *this;
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    template<typename... Args>
+    typename small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::reference
+    small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::emplace_back(Args&&... args) {
+        ATOM_ASSERT_VALID(this);
+
+        if (size_ < capacity_) {
+            alloc_traits::construct(allocator(), data_ + size_, std::forward<Args>(args)...);
+            ++size_;
+
+            ATOM_ASSERT_VALID(this);
+            return data_[size_ - 1];
+        }
+
+        const size_type new_capacity = next_capacity(size_ + 1);
+
+        if constexpr (is_reallocatable_) {
+            if (!is_inline()) {
+                // Arguments may refer to the old memory which is invalidated by reallocate()
+                value_type item(std::forward<Args>(args)...);
+
+                grow(new_capacity);
+
+                alloc_traits::construct(allocator(), data_ + size_, std::move(item));
+                ++size_;
+
+                ATOM_ASSERT_VALID(this);
+                return data_[size_ - 1];
+            }
+        }
+
+        value_type* tmp_buffer = allocate(new_capacity);
+
+        try {
+            alloc_traits::construct(allocator(), tmp_buffer + size_, std::forward<Args>(args)...);
+        }
+        catch (...) {
+            deallocate(tmp_buffer, new_capacity);
+            throw;
+        }
+
+        try {
+            relocate(data_, size_, tmp_buffer);
+        }
+        catch (...) {
+            alloc_traits::destroy(allocator(), tmp_buffer + size_);
+            deallocate(tmp_buffer, new_capacity);
+            throw;
+        }
+
+        if (!is_inline()) {
+            deallocate(data_, capacity_);
+        }
+
+        data_     = tmp_buffer;
+        capacity_ = new_capacity;
+        ++size_;
+
+        poison_tail();
+
+        ATOM_ASSERT_VALID(this);
+        return data_[size_ - 1];
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    bool small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::erase(const size_type position) {
+        ATOM_ASSERT_VALID(this);
+
+        if (position >= size_) {
+            return false;
+        }
+
+        --size_;
+
+        for (size_type i = position; i < size_; ++i) {
+            data_[i] = std::move(data_[i + 1]);
+        }
+
+        alloc_traits::destroy(allocator(), data_ + size_);
+
+#ifndef ATOM_NDEBUG
+        if constexpr (std::is_arithmetic<value_type>::value) {
+            data_[size_] = POISON<value_type>::value;
+        }
+#endif
+
+        ATOM_ASSERT_VALID(this);
+        return true;
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    void small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::clear() noexcept {
+        destroy_range(data_, size_);
+
+        if (!is_inline()) {
+            deallocate(data_, capacity_);
+        }
+
+        data_     = inline_data();
+        capacity_ = inline_size_;
+        size_     = 0;
+
+        poison_tail();
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    void small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::resize(const size_type n, const_reference value) {
+        ATOM_ASSERT_VALID(this);
+
+        if (n > capacity_) {
+            grow(n);
+        }
+
+        if (n > size_) {
+            size_type i = size_;
+
+            try {
+                for (; i < n; ++i) {
+                    alloc_traits::construct(allocator(), data_ + i, value);
+                }
+            }
+            catch (...) {
+                destroy_range(data_ + size_, i - size_);
+                throw;
+            }
+        }
+        else {
+            destroy_range(data_ + n, size_ - n);
+        }
+
+        size_ = n;
+
+        poison_tail();
+
+        ATOM_ASSERT_VALID(this);
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    void small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::swap(small_vector_t& rhs)
+            noexcept(std::is_nothrow_move_constructible<Tp>::value) {
+
+        if (this == &rhs) {
+            return;
+        }
+
+        if (alloc_traits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(allocator(), rhs.allocator());
+        }
+        else {
+            assert(allocator() == rhs.allocator());
+        }
+
+        if (!is_inline() && !rhs.is_inline()) {
+            std::swap(data_, rhs.data_);
+            std::swap(size_, rhs.size_);
+            std::swap(capacity_, rhs.capacity_);
+            return;
+        }
+
+        small_vector_t tmp_vector(allocator());
+        tmp_vector.take(rhs);
+        rhs.take(*this);
+        take(tmp_vector);
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    void small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::grow(const size_type n) {
+        if constexpr (is_reallocatable_) {
+            if (!is_inline()) {
+                data_     = allocator().reallocate(data_, capacity_, n);
+                capacity_ = n;
+
+                poison_tail();
+                return;
+            }
+        }
+
+        value_type* tmp_buffer = allocate(n);
+
+        try {
+            relocate(data_, size_, tmp_buffer);
+        }
+        catch (...) {
+            deallocate(tmp_buffer, n);
+            throw;
+        }
+
+        if (!is_inline()) {
+            deallocate(data_, capacity_);
+        }
+
+        data_     = tmp_buffer;
+        capacity_ = n;
+
+        poison_tail();
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    typename small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::size_type
+    small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::next_capacity(const size_type n) const noexcept {
+        return GrowthPolicy::next_capacity(capacity_, n);
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    void small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::assign_copy(const value_type* src, const size_type n) {
+        if (n > capacity_) {
+            grow(n);
+        }
+
+        if constexpr (std::is_arithmetic<value_type>::value) {
+            if (n) {
+                memcpy(data_, src, n * sizeof(value_type));
+            }
+        }
+        else {
+            size_type i = 0;
+
+            try {
+                for (; i < n; ++i) {
+                    alloc_traits::construct(allocator(), data_ + i, src[i]);
+                }
+            }
+            catch (...) {
+                destroy_range(data_, i);
+                throw;
+            }
+        }
+
+        size_ = n;
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    void small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::take(small_vector_t& that)
+            noexcept(std::is_nothrow_move_constructible<Tp>::value) {
+
+        if (!that.is_inline()) {
+            data_     = that.data_;
+            size_     = that.size_;
+            capacity_ = that.capacity_;
+
+            that.data_     = that.inline_data();
+            that.capacity_ = inline_size_;
+        }
+        else {
+            // Inline vector never holds more than inline_size_ elements
+            const size_type n = std::min(that.size_, inline_size_);
+
+            relocate(that.data_, n, data_);
+            size_ = n;
+        }
+
+        that.size_ = 0;
+        that.poison_tail();
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    void small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::relocate(value_type* src, const size_type n, value_type* dst) {
+        if constexpr (is_trivially_relocatable<value_type>::value) {
+            if (n) {
+                memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+            }
+        }
+        else {
+            size_type i = 0;
+
+            try {
+                for (; i < n; ++i) {
+                    if constexpr (std::is_nothrow_move_constructible<value_type>::value ||
+                                  !std::is_copy_constructible<value_type>::value) {
+                        alloc_traits::construct(allocator(), dst + i, std::move(src[i]));
+                    }
+                    else {
+                        alloc_traits::construct(allocator(), dst + i, src[i]);
+                    }
+                }
+            }
+            catch (...) {
+                destroy_range(dst, i);
+                throw;
+            }
+
+            destroy_range(src, n);
+        }
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    typename small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::value_type*
+    small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::allocate(const size_type n) {
+        ATOM_BAD_ALLOC(n > alloc_traits::max_size(allocator()));
+
+        try {
+            return alloc_traits::allocate(allocator(), n);
+        }
+        catch (const std::bad_alloc&) {
+            throw atom::badAlloc(FULL_COORDINATES_FFL);
+        }
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    void small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::deallocate(value_type* ptr, const size_type n) noexcept {
+        alloc_traits::deallocate(allocator(), ptr, n);
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    void small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::destroy_range(value_type* first, const size_type n) noexcept {
+        for (size_type i = 0; i < n; ++i) {
+            alloc_traits::destroy(allocator(), first + i);
+        }
+    }
+
+    template<typename Tp, const std::size_t inline_size_, typename Allocator, typename GrowthPolicy>
+    void small_vector_t<Tp, inline_size_, Allocator, GrowthPolicy>::dump(const char* file,
+                                                           const char* function_name,
+                                                           int         line_number,
+                                                           const char* output_file) const {
+
+        std::ofstream fout(output_file, std::ios_base::app);
+
+        ATOM_BAD_STREAM(!fout.is_open());
+
+        fout << "-------------------\n"
+                "Class small_vector_t:\n"
+                "time: "           << __TIME__      << "\n"
+                "file: "           << file          << "\n"
+                "function: "       << function_name << "\n"
+                "line: "           << line_number   << "\n"
+                "status: "         << (is_valid() ? "ok\n{\n" : "FAIL\n{\n");
+        fout << "\tsize: "         << size_         << "\n"
+                "\tcapacity: "     << capacity_     << "\n"
+                "\tinline: "       << (is_inline() ? "yes\n" : "no\n");
+#ifndef ATOM_NDEBUG
+        fout << "\tfield_status: " << (status_valid_ ? "ok\n\n" : "fail\n\n");
+#endif
+
+#ifndef ATOM_NWRITE
+        for (size_type i = 0; i < size_ && i < capacity_; ++i) {
+            fout << "\t* [" << i << "] =  " << data_[i] << "\n";
+        }
+        if constexpr (std::is_arithmetic<value_type>::value) {
+            for (size_type i = size_; i < capacity_; ++i) {
+                fout << "\t  [" << i << "] =  " << data_[i]
+                     << (data_[i] != POISON<value_type>::value ? "\t//ERROR!\n" : "\n");
+            }
+        }
+#endif
+        fout << "}\n"
+                "-------------------\n";
+
+        fout.close();
+    }
+
+}
+
+#endif // ATOM_SMALL_VECTOR_HPP
@@ -0,0 +1,549 @@
+//-----------------------------------------------------------------------------
+//! @file small_vector.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Implements a vector class with inline buffer
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_SMALL_VECTOR_H
+#define ATOM_SMALL_VECTOR_H 1
+
+#include "exceptions.h"
+#include "debug_tools.h"
+#include "va_iterator.h"
+#include "allocator/realloc_allocator.h"
+#include "growth_policy.h"
+#include <initializer_list>
+#include <type_traits>
+#include <memory>
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @class small_vector_t
+    //! @tparam Tp The type of the value in the vector
+    //! @tparam inline_size_ The number of elements which are stored inside the object
+    //! @tparam Allocator The type of the allocator which owns the memory after spill
+    //! @tparam GrowthPolicy The policy of the capacity growth (see growth_policy.h)
+    //! @details First inline_size_ elements live in the inline buffer as in array_t,
+    //! @details when it is full all elements are moved to the heap and grow as in vector_t.
+    //! @details Memory behind position size_ is raw. Capacity is never less than inline_size_.
+    //-----------------------------------------------------------------------------
+    template<typename Tp,
+             const std::size_t inline_size_,
+             typename Allocator    = default_allocator_t<Tp>,
+             typename GrowthPolicy = doubling_growth_policy>
+    class small_vector_t : private Allocator {
+    public:
+
+        friend class va_iterator<Tp>;
+
+        using value_type       = Tp;                    //!< Element type
+        using const_value_type = const Tp;              //!< Constant element type
+        using reference        = Tp&;                   //!< Reference type
+        using const_reference  = const Tp&;             //!< Constant reference type
+        using iterator         = va_iterator<Tp>;       //!< Iterator type
+        using const_iterator   = va_iterator<const Tp>; //!< Const iterator type
+        using size_type        = std::size_t;           //!< Size type
+        using allocator_type   = Allocator;             //!< Allocator type
+
+        static_assert(inline_size_ > 0, "small_vector_t needs inline buffer, use vector_t instead");
+        static_assert(std::is_same<typename std::allocator_traits<Allocator>::value_type, Tp>::value,
+                      "Allocator::value_type must be the same as Tp");
+        static_assert(std::is_same<typename std::allocator_traits<Allocator>::pointer, Tp*>::value,
+                      "Allocator must use raw pointers");
+        static_assert(is_growth_policy<GrowthPolicy>::value,
+                      "GrowthPolicy must have static function next_capacity(current, required)");
+
+        //-----------------------------------------------------------------------------
+        //! @brief Default constructor
+        //-----------------------------------------------------------------------------
+        small_vector_t() noexcept(noexcept(Allocator())) :
+            allocator_type(),
+            size_         (0),
+            capacity_     (inline_size_),
+            data_         (inline_data()) {
+
+            poison_tail();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @details Empty vector which will take memory from alloc after spill
+        //! @param alloc Allocator of the vector
+        //-----------------------------------------------------------------------------
+        explicit small_vector_t(const allocator_type& alloc) noexcept :
+            allocator_type(alloc),
+            size_         (0),
+            capacity_     (inline_size_),
+            data_         (inline_data()) {
+
+            poison_tail();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @details Constructor which resize memory to n elements and initialize them
+        //! @param n The number of elements
+        //! @param value initializer for n elements
+        //! @param alloc Allocator of the vector
+        //! @throws The same exceptions as the function resize()
+        //-----------------------------------------------------------------------------
+        small_vector_t(const size_type       n,
+                       const_reference       value,
+                       const allocator_type& alloc = allocator_type()) :
+            small_vector_t(alloc) {
+
+#ifndef ATOM_NDEBUG
+            try {
+#endif
+                resize(n, value);
+#ifndef ATOM_NDEBUG
+            }
+            catch (...) {
+                status_valid_ = 0;
+                throw;
+            }
+#endif
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @details Constructor which resize memory to n elements and initialize them
+        //! @param n The number of elements
+        //! @param value rvalue reference (default value_type()) initializer for n elements
+        //! @param alloc Allocator of the vector
+        //! @throws The same exceptions as the function resize()
+        //-----------------------------------------------------------------------------
+        small_vector_t(const size_type       n,
+                       const_value_type&&    value = value_type(),
+                       const allocator_type& alloc = allocator_type()) :
+            small_vector_t(n, static_cast<const_reference>(value), alloc) {
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor at std::initializer_list
+        //! @details Constructor which copy from std::initializer_list
+        //! @param init List of elements
+        //! @param alloc Allocator of the vector
+        //! @throws The same exceptions as the function reserve()
+        //-----------------------------------------------------------------------------
+        small_vector_t(const std::initializer_list<value_type>& init,
+                       const allocator_type&                    alloc = allocator_type()) :
+            small_vector_t(alloc) {
+
+            assign_copy(init.begin(), init.size());
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief The copy constructor
+        //! @details Deep copy, allocator is taken from select_on_container_copy_construction()
+        //! @param that The copy source
+        //! @throws The same exceptions as the function reserve()
+        //-----------------------------------------------------------------------------
+        small_vector_t(const small_vector_t& that) :
+            small_vector_t(alloc_traits::select_on_container_copy_construction(that.get_allocator())) {
+
+            assign_copy(that.data_, that.size_);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief The move constructor
+        //! @details Heap memory of that is taken, inline elements are moved one by one
+        //! @param that The move source
+        //-----------------------------------------------------------------------------
+        small_vector_t(small_vector_t&& that) noexcept(std::is_nothrow_move_constructible<Tp>::value) :
+            small_vector_t(std::move(that.allocator())) {
+
+            take(that);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Destructor
+        //! @details Macro ATOM_NDEBUG for debug mode
+        //-----------------------------------------------------------------------------
+        ~small_vector_t() {
+            clear();
+
+#ifndef ATOM_NDEBUG
+            status_valid_ = 0;
+            size_     = POISON<size_type>::value;
+            capacity_ = POISON<size_type>::value;
+#endif
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief The assignment operator
+        //! @details Allocator of that is copied when propagate_on_container_copy_assignment is true
+        //! @param that The source of the assignment
+        //! @throws The same exceptions as the small_vector_t(const small_vector_t&)
+        //! @return Constant reference to the calling object
+        //-----------------------------------------------------------------------------
+        const small_vector_t& operator=(const small_vector_t& that);
+
+        //-----------------------------------------------------------------------------
+        //! @brief The move assignment operator
+        //! @details Heap memory of that is taken when propagate_on_container_move_assignment is true
+        //! @details or allocators are equal, otherwise elements are moved one by one
+        //! @param that The move source
+        //! @throws The same exceptions as the function reserve() when elements are moved
+        //! @return Reference to the calling object
+        //-----------------------------------------------------------------------------
+        small_vector_t& operator=(small_vector_t&& that);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Iterator
+        //! @return Iterator on the begin of the vector
+        //-----------------------------------------------------------------------------
+        iterator begin() {
+            return iterator(data_);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Iterator
+        //! @return Iterator on the end of the vector
+        //-----------------------------------------------------------------------------
+        iterator end() {
+            return iterator(data_ + size_);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constant iterator
+        //! @return Iterator on the begin of the vector
+        //-----------------------------------------------------------------------------
+        const_iterator cbegin() const {
+            return const_iterator(data_);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constant iterator
+        //! @return Iterator on the end of the vector
+        //-----------------------------------------------------------------------------
+        const_iterator cend() const {
+            return const_iterator(data_ + size_);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief First element
+        //! @throws The same exceptions as the operator[]
+        //-----------------------------------------------------------------------------
+        const_reference front() const {
+            return operator[](0);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Last element
+        //! @throws The same exceptions as the operator[]
+        //-----------------------------------------------------------------------------
+        const_reference back() const {
+            return operator[](size_ - 1);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Operator addressing
+        //! @details Checks n for occurrence in the interval of bounds of the vector
+        //! @param n Number of the element
+        //! @throws The same exceptions as the operator[] returns const reference
+        //! @return Reference on the nth item of the vector
+        //-----------------------------------------------------------------------------
+        reference operator[](const size_type n) {
+            return const_cast<reference>(static_cast<const small_vector_t*>(this)->operator[](n));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Operator addressing
+        //! @details Checks n for occurrence in the interval of bounds of the vector
+        //! @param n Number of the element
+        //! @throw atom::outOfRange When n is bigger or equal than size of the vector
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return Const reference on the nth item of the vector
+        //-----------------------------------------------------------------------------
+        const_reference operator[](const size_type n) const {
+            ATOM_ASSERT_VALID(this);
+
+            ATOM_OUT_OF_RANGE(n >= size_);
+            return data_[n];
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Push new item in back of the vector
+        //! @details Can move the elements to the heap
+        //! @param x new element which will be added in vector
+        //! @throws The same exceptions as the function emplace_back()
+        //-----------------------------------------------------------------------------
+        void push_back(const_reference x) {
+            emplace_back(x);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Push new rvalue reference item in back of the vector
+        //! @details Can move the elements to the heap, x is moved into the vector
+        //! @param x new element which will be added in vector
+        //! @throws The same exceptions as the function emplace_back()
+        //-----------------------------------------------------------------------------
+        void push_back(value_type&& x) {
+            emplace_back(std::move(x));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Construct new item in back of the vector
+        //! @details Can move the elements to the heap
+        //! @details Arguments may refer to elements of the vector
+        //! @tparam Args Types of the arguments
+        //! @param args Arguments which are forwarded to the constructor of value_type
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throws The same exceptions as the function reserve() and the constructor of value_type
+        //! @return Reference on the new item
+        //-----------------------------------------------------------------------------
+        template<typename... Args>
+        reference emplace_back(Args&&... args);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Remove nth element
+        //! @details Do not change the capacity, the last element is destroyed
+        //! @details Macro ATOM_NDEBUG for debug mode
+        //! @param position number of the item in the vector
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return True if element was delete, otherwise false
+        //-----------------------------------------------------------------------------
+        bool erase(const size_type position);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Clear the vector
+        //! @details Destroy all elements, free the heap memory and return to the inline buffer
+        //-----------------------------------------------------------------------------
+        void clear() noexcept;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Reserve new memory
+        //! @details Do not shrink the capacity, capacity bigger than inline_size_ moves elements to the heap
+        //! @param n new capacity
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throws The same exceptions as the function allocate() and the move constructor of value_type
+        //-----------------------------------------------------------------------------
+        void reserve(const size_type n) {
+            ATOM_ASSERT_VALID(this);
+
+            if (n > capacity_) {
+                grow(n);
+            }
+
+            ATOM_ASSERT_VALID(this);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Change the size
+        //! @details New elements are copies of value, capacity is not shrunk
+        //! @param n New size of the vector
+        //! @param value initializer for the new elements
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throws The same exceptions as the function reserve()
+        //-----------------------------------------------------------------------------
+        void resize(const size_type n,
+                    const_reference value);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Change the size
+        //! @details New elements are copies of value, capacity is not shrunk
+        //! @param n New size of the vector
+        //! @param value temporary (default value_type()) initializer for the new elements
+        //! @throws The same exceptions as the function reserve()
+        //-----------------------------------------------------------------------------
+        void resize(const size_type n,
+                    const_value_type&& value = value_type()) {
+            resize(n, static_cast<const_reference>(value));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Checks the vector on the void
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return True if vector is empty, otherwise false
+        //-----------------------------------------------------------------------------
+        bool empty() const {
+            ATOM_ASSERT_VALID(this);
+            return !size_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Capacity
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return capacity of the vector
+        //-----------------------------------------------------------------------------
+        size_type capacity() const {
+            ATOM_ASSERT_VALID(this);
+            return capacity_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Size
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return size of the vector
+        //-----------------------------------------------------------------------------
+        size_type size() const {
+            ATOM_ASSERT_VALID(this);
+            return size_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Checks where the elements are
+        //! @return True if elements are in the inline buffer, otherwise false
+        //-----------------------------------------------------------------------------
+        bool is_inline() const noexcept {
+            return data_ == inline_data();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Swap two vector
+        //! @details Heap buffers are exchanged, inline elements are moved
+        //! @details Allocators are swapped when propagate_on_container_swap is true,
+        //! @details otherwise they must be equal
+        //! @param rhs other vector to which you want to exchange
+        //-----------------------------------------------------------------------------
+        void swap(small_vector_t& rhs) noexcept(std::is_nothrow_move_constructible<Tp>::value);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Allocator
+        //! @return Copy of the allocator of the vector
+        //-----------------------------------------------------------------------------
+        allocator_type get_allocator() const noexcept {
+            return allocator();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Silent verifier
+        //! @return True if vector is valid else return false
+        //-----------------------------------------------------------------------------
+        bool is_valid() const noexcept {
+            return this &&
+#ifndef ATOM_NDEBUG
+                    status_valid_ &&
+#endif
+                    data_ != nullptr &&
+                    size_ <= capacity_ &&
+                    (is_inline() ? capacity_ == inline_size_ : capacity_ > inline_size_);
+        }
+
+    private:
+
+        using alloc_traits = std::allocator_traits<allocator_type>; //!< Access to the allocator
+
+        size_type  size_;     //!< Size of the vector
+        size_type  capacity_; //!< Capacity of the vector
+        value_type *data_;    //!< Inline buffer or heap memory
+
+#ifndef ATOM_NDEBUG
+        unsigned char status_valid_ = 1; //!< Status of the vector, only in debug mode
+#endif
+
+        alignas(value_type) unsigned char buffer_[inline_size_ * sizeof(value_type)]; //!< Inline buffer
+
+        //! Heap memory is resized by Allocator::reallocate() without element-wise relocation
+        static constexpr bool is_reallocatable_ = is_trivially_relocatable<value_type>::value &&
+                                                  has_reallocate<allocator_type>::value;
+
+        value_type* inline_data() noexcept {
+            return reinterpret_cast<value_type*>(buffer_);
+        }
+
+        const value_type* inline_data() const noexcept {
+            return reinterpret_cast<const value_type*>(buffer_);
+        }
+
+        allocator_type& allocator() noexcept {
+            return *this;
+        }
+
+        const allocator_type& allocator() const noexcept {
+            return *this;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Move the elements to the heap memory for n elements
+        //! @param n New capacity, must be bigger than capacity_
+        //! @throws The same exceptions as the function allocate() and the move constructor of value_type
+        //-----------------------------------------------------------------------------
+        void grow(const size_type n);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Capacity after growth
+        //! @param n Required capacity
+        //! @return Capacity which is not less than n
+        //-----------------------------------------------------------------------------
+        size_type next_capacity(const size_type n) const noexcept;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Copy elements to the empty vector
+        //! @param src Source elements
+        //! @param n Count of elements
+        //! @throws The same exceptions as the function reserve() and the copy constructor of value_type
+        //-----------------------------------------------------------------------------
+        void assign_copy(const value_type* src, const size_type n);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Take the elements of that
+        //! @details Calling vector must be empty and use the inline buffer, that becomes empty
+        //! @details Heap memory is taken, inline elements are moved one by one
+        //! @param that The source of the elements
+        //-----------------------------------------------------------------------------
+        void take(small_vector_t& that) noexcept(std::is_nothrow_move_constructible<Tp>::value);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Move elements to the raw memory and destroy the source
+        //! @details Trivially relocatable types use memcpy(), other types are move-constructed
+        //! @details when the move constructor is noexcept (or there is no copy constructor), otherwise copied.
+        //! @details Source elements are destroyed only if no exception was thrown
+        //! @param src Source elements
+        //! @param n Count of elements
+        //! @param dst Raw memory for n elements
+        //! @throws The same exceptions as the copy constructor of value_type
+        //-----------------------------------------------------------------------------
+        void relocate(value_type* src, const size_type n, value_type* dst);
+
+        value_type* allocate(const size_type n);
+
+        void deallocate(value_type* ptr, const size_type n) noexcept;
+
+        void destroy_range(value_type* first, const size_type n) noexcept;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Fill the raw memory behind size_ of the POISON
+        //! @details Only for arithmetic types when macro ATOM_NDEBUG is not defined
+        //-----------------------------------------------------------------------------
+        void poison_tail() noexcept {
+#ifndef ATOM_NDEBUG
+            if constexpr (std::is_arithmetic<value_type>::value) {
+                std::fill(data_ + size_, data_ + capacity_, POISON<value_type>::value);
+            }
+#endif
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Dumper
+        //! @details Create file "__small_vector_dump.txt" where is information about vector's status
+        //! @details Macro ATOM_NWRITE prohibit function dump() print elements (for example when value_type has not operator<<)
+        //! @param function_name Name of function which call this method
+        //! @param line_number Number of line which call this method
+        //-----------------------------------------------------------------------------
+        void dump(const char* file,
+                  const char* function_name,
+                  int         line_number,
+                  const char* output_file = "__small_vector_dump.txt") const;
+    };
+
+}
+
+//! @brief Implementation methods of the class small_vector_t
+#include "implement/small_vector.hpp"
+
+#endif // ATOM_SMALL_VECTOR_H
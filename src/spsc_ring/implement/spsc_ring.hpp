@@ -0,0 +1,167 @@
+#ifndef ATOM_SPSC_RING_HPP
+#define ATOM_SPSC_RING_HPP 1
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include "exceptions.h"
+#include "debug_tools.h"
+
+namespace atom {
+
+    template<typename Tp, std::size_t capacity_>
+    spsc_ring_t<Tp, capacity_>::~spsc_ring_t() {
+        const size_type tail = producer_.tail.load(std::memory_order_acquire);
+
+        for (size_type head = consumer_.head.load(std::memory_order_relaxed); head != tail; ++head) {
+            std::destroy_at(slot(head));
+        }
+    }
+
+    template<typename Tp, std::size_t capacity_>
+    typename spsc_ring_t<Tp, capacity_>::size_type
+    spsc_ring_t<Tp, capacity_>::free_slots(const size_type tail, const size_type n) noexcept {
+        size_type result = capacity_ - (tail - producer_.cached_head);
+
+        if (result < n) {
+            // Acquire: the consumer has finished with the slots before head
+            producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+            result                = capacity_ - (tail - producer_.cached_head);
+        }
+        return result;
+    }
+
+    template<typename Tp, std::size_t capacity_>
+    typename spsc_ring_t<Tp, capacity_>::size_type
+    spsc_ring_t<Tp, capacity_>::ready_slots(const size_type head, const size_type n) noexcept {
+        size_type result = consumer_.cached_tail - head;
+
+        if (result < n) {
+            // Acquire: the elements before tail are constructed
+            consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+            result                = consumer_.cached_tail - head;
+        }
+        return result;
+    }
+
+    template<typename Tp, std::size_t capacity_>
+    template<typename Arg>
+    bool spsc_ring_t<Tp, capacity_>::emplace(Arg&& x) {
+        ATOM_ASSERT_VALID(this);
+
+        const size_type tail = producer_.tail.load(std::memory_order_relaxed);
+
+        if (!free_slots(tail, 1)) {
+            return false;
+        }
+
+        ::new (static_cast<void*>(slot(tail))) value_type(std::forward<Arg>(x));
+        producer_.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename Tp, std::size_t capacity_>
+    bool spsc_ring_t<Tp, capacity_>::try_pop(value_type& out) {
+        ATOM_ASSERT_VALID(this);
+
+        const size_type head = consumer_.head.load(std::memory_order_relaxed);
+
+        if (!ready_slots(head, 1)) {
+            return false;
+        }
+
+        value_type* element = slot(head);
+
+        out = std::move(*element);
+        std::destroy_at(element);
+        consumer_.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename Tp, std::size_t capacity_>
+    typename spsc_ring_t<Tp, capacity_>::size_type
+    spsc_ring_t<Tp, capacity_>::push_n(const value_type* src, const size_type n) {
+        ATOM_ASSERT_VALID(this);
+
+        const size_type tail  = producer_.tail.load(std::memory_order_relaxed);
+        const size_type count = std::min(n, free_slots(tail, n));
+
+        // [tail, end of the buffer) and then [0, the rest)
+        const size_type first = std::min(count, capacity_ - (tail & MASK));
+
+        if constexpr (std::is_trivially_copyable<value_type>::value) {
+            if (count) {
+                memcpy(static_cast<void*>(slot(tail)), static_cast<const void*>(src), first * sizeof(value_type));
+                memcpy(static_cast<void*>(slot(0)), static_cast<const void*>(src + first), (count - first) * sizeof(value_type));
+            }
+        }
+        else {
+            std::uninitialized_copy_n(src, first, slot(tail));
+            try {
+                std::uninitialized_copy_n(src + first, count - first, slot(0));
+            }
+            catch (...) {
+                std::destroy_n(slot(tail), first);
+                throw;
+            }
+        }
+
+        producer_.tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    template<typename Tp, std::size_t capacity_>
+    typename spsc_ring_t<Tp, capacity_>::size_type
+    spsc_ring_t<Tp, capacity_>::pop_n(value_type* dst, const size_type n) {
+        ATOM_ASSERT_VALID(this);
+
+        const size_type head  = consumer_.head.load(std::memory_order_relaxed);
+        const size_type count = std::min(n, ready_slots(head, n));
+        const size_type first = std::min(count, capacity_ - (head & MASK));
+
+        if constexpr (std::is_trivially_copyable<value_type>::value) {
+            if (count) {
+                memcpy(static_cast<void*>(dst), static_cast<const void*>(slot(head)), first * sizeof(value_type));
+                memcpy(static_cast<void*>(dst + first), static_cast<const void*>(slot(0)), (count - first) * sizeof(value_type));
+            }
+        }
+        else {
+            std::move(slot(head), slot(head) + first, dst);
+            std::move(slot(0), slot(0) + (count - first), dst + first);
+            std::destroy_n(slot(head), first);
+            std::destroy_n(slot(0), count - first);
+        }
+
+        consumer_.head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    template<typename Tp, std::size_t capacity_>
+    void spsc_ring_t<Tp, capacity_>::dump(const char* file,
+                                          const char* function_name,
+                                          int         line_number,
+                                          const char* output_file) const {
+
+        std::ofstream fout(output_file, std::ios_base::app);
+
+        ATOM_BAD_STREAM(!fout.is_open());
+
+        fout << "-------------------\n"
+                "Class spsc_ring_t:\n"
+                "time: "       << __TIME__      << "\n"
+                "file: "       << file          << "\n"
+                "function: "   << function_name << "\n"
+                "line: "       << line_number   << "\n"
+                "status: "     << (is_valid() ? "ok\n{\n" : "FAIL\n{\n");
+        fout << "\thead: "     << consumer_.head.load(std::memory_order_relaxed) << "\n"
+                "\ttail: "     << producer_.tail.load(std::memory_order_relaxed) << "\n"
+                "\tcapacity: " << capacity_     << "\n"
+                "}\n"
+                "-------------------\n";
+
+        fout.close();
+    }
+
+}
+
+#endif // ATOM_SPSC_RING_HPP
@@ -0,0 +1,205 @@
+//-----------------------------------------------------------------------------
+//! @file spsc_ring.h
+//-----------------------------------------------------------------------------
+//! @mainpage
+//!
+//! Bounded lock-free ring of one producer and one consumer
+//!
+//!
+//! @version 1.0
+//!
+//! @author ShJ
+//! @date   16.10.2026
+//-----------------------------------------------------------------------------
+#ifndef ATOM_SPSC_RING_H
+#define ATOM_SPSC_RING_H 1
+
+#include "cache_line.h"
+#include "exceptions.h"
+#include "debug_tools.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+//-----------------------------------------------------------------------------
+//! @namespace atom
+//! @brief Common namespace
+//-----------------------------------------------------------------------------
+namespace atom {
+
+    //-----------------------------------------------------------------------------
+    //! @class spsc_ring_t
+    //! @brief Bounded ring buffer of one producer thread and one consumer thread
+    //! @details Elements are kept in the inline raw buffer as in array_t, only the elements
+    //! @details between head and tail are constructed. head and tail grow without bound and
+    //! @details the slot is index & (capacity_ - 1). Each side owns one cache line: its index
+    //! @details and the cached copy of the index of the other side, so the line of the other
+    //! @details side is read only when the ring looks full (producer) or empty (consumer).
+    //! @details The producer publishes elements by the release store of tail, the consumer
+    //! @details frees slots by the release store of head.
+    //! @details try_push() and push_n() are called only by the producer, try_pop() and pop_n()
+    //! @details only by the consumer
+    //! @tparam Tp The type of the elements
+    //! @tparam capacity_ Count of the slots, the power of two
+    //-----------------------------------------------------------------------------
+    template<typename Tp, const std::size_t capacity_>
+    class spsc_ring_t {
+    public:
+
+        static_assert(capacity_ && !(capacity_ & (capacity_ - 1)), "Capacity of spsc_ring_t must be a power of two");
+
+        using value_type = Tp;          //!< Element type
+        using size_type  = std::size_t; //!< Size type
+
+        //-----------------------------------------------------------------------------
+        //! @brief Default constructor
+        //! @details No element is constructed
+        //-----------------------------------------------------------------------------
+        spsc_ring_t() noexcept :
+            producer_(),
+            consumer_() {
+        }
+
+        spsc_ring_t(const spsc_ring_t&)            = delete;
+        spsc_ring_t& operator=(const spsc_ring_t&) = delete;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Destructor
+        //! @details Elements which were not popped are destroyed, both threads must be finished
+        //-----------------------------------------------------------------------------
+        ~spsc_ring_t();
+
+        //-----------------------------------------------------------------------------
+        //! @brief Push the copy of x, producer only
+        //! @param x New element
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when ring is not valid
+        //! @throws The same exceptions as the copy constructor of value_type, the ring is not changed then
+        //! @return True if x was pushed, false when the ring is full
+        //-----------------------------------------------------------------------------
+        bool try_push(const value_type& x) {
+            return emplace(x);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Push x by move, producer only
+        //! @param x New element, it is not moved from when the ring is full
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when ring is not valid
+        //! @throws The same exceptions as the move constructor of value_type, the ring is not changed then
+        //! @return True if x was pushed, false when the ring is full
+        //-----------------------------------------------------------------------------
+        bool try_push(value_type&& x) {
+            return emplace(std::move(x));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Pop the oldest element, consumer only
+        //! @param out Receives the element by move assignment
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when ring is not valid
+        //! @throws The same exceptions as the move assignment of value_type, the element stays in the ring then
+        //! @return True if an element was popped, false when the ring is empty
+        //-----------------------------------------------------------------------------
+        bool try_pop(value_type& out);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Push the copies of up to n elements, producer only
+        //! @details Free slots are at most two contiguous spans, each of them is filled by one
+        //! @details copy (memcpy() for trivially copyable types), tail is published once
+        //! @param src Pointer on the first element
+        //! @param n Count of the elements
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when ring is not valid
+        //! @throws The same exceptions as the copy constructor of value_type, the ring is not changed then
+        //! @return Count of the pushed elements, the first ones of src
+        //-----------------------------------------------------------------------------
+        size_type push_n(const value_type* src, size_type n);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Pop up to n oldest elements, consumer only
+        //! @details Elements are at most two contiguous spans, each of them is moved by one
+        //! @details call (memcpy() for trivially copyable types), head is published once
+        //! @param dst Pointer on the first of n constructed elements, they receive the elements by move assignment
+        //! @param n Count of the elements
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when ring is not valid
+        //! @throws The same exceptions as the move assignment of value_type, all elements stay in the ring then
+        //! @return Count of the popped elements
+        //-----------------------------------------------------------------------------
+        size_type pop_n(value_type* dst, size_type n);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the elements
+        //! @details Exact in the producer and the consumer thread up to the changes of the other side
+        //-----------------------------------------------------------------------------
+        size_type size() const noexcept {
+            const size_type head = consumer_.head.load(std::memory_order_acquire);
+            const size_type tail = producer_.tail.load(std::memory_order_acquire);
+            return tail - head;
+        }
+
+        //! @brief The same as size() == 0
+        bool empty() const noexcept {
+            return !size();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the slots
+        //-----------------------------------------------------------------------------
+        static constexpr size_type capacity() noexcept {
+            return capacity_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Silent verifier
+        //! @return True if ring is valid else return false
+        //-----------------------------------------------------------------------------
+        bool is_valid() const noexcept {
+            return this && size() <= capacity_;
+        }
+
+    private:
+
+        static constexpr size_type MASK = capacity_ - 1;
+
+        //! @brief Written by the producer: tail and the last seen head
+        struct alignas(CACHE_LINE_SIZE) producer_t {
+            std::atomic<size_type> tail{0};
+            size_type              cached_head = 0;
+        };
+
+        //! @brief Written by the consumer: head and the last seen tail
+        struct alignas(CACHE_LINE_SIZE) consumer_t {
+            std::atomic<size_type> head{0};
+            size_type              cached_tail = 0;
+        };
+
+        producer_t producer_;
+        consumer_t consumer_;
+
+        alignas(CACHE_LINE_SIZE) alignas(Tp) unsigned char bytes_[capacity_ * sizeof(Tp)]; //!< Raw buffer of the slots
+
+        value_type* slot(const size_type index) noexcept {
+            return std::launder(reinterpret_cast<value_type*>(bytes_)) + (index & MASK);
+        }
+
+        template<typename Arg>
+        bool emplace(Arg&& x);
+
+        //! @brief Count of the free slots, head is reloaded when less than n are known
+        size_type free_slots(size_type tail, size_type n) noexcept;
+
+        //! @brief Count of the elements, tail is reloaded when less than n are known
+        size_type ready_slots(size_type head, size_type n) noexcept;
+
+        void dump(const char* file,
+                  const char* function_name,
+                  int         line_number,
+                  const char* output_file = "__spsc_ring_dump.txt") const;
+    };
+
+}
+
+#include "implement/spsc_ring.hpp"
+
+#endif // ATOM_SPSC_RING_H
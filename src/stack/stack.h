@@ -14,6 +14,8 @@
 #ifndef ATOM_STACK_H
 #define ATOM_STACK_H 1
 
+#include <memory>
+#include <type_traits>
 #include "vector/vector.h"
 #include "exceptions.h"
 #include "debug_tools.h"
@@ -30,6 +32,7 @@ namespace atom {
     //! @tparam Tp The type of the value in the stack
     //! @tparam Container the type of container which houses the stack (default is atom::vector_t)
     //! @details Container must have function: push_back(), erase(), back(), size(), swap() and capacity()
+    //! @details Allocator is passed through the container: stack_t<Tp, atom::vector_t<Tp, Allocator> >
     //-----------------------------------------------------------------------------
     template<typename Tp, typename Container = atom::vector_t<Tp> >
     class stack_t {
@@ -45,6 +48,33 @@ namespace atom {
         //-----------------------------------------------------------------------------
         stack_t() = default;
 
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @details Empty stack whose container takes memory from alloc
+        //! @param alloc Allocator of the container
+        //-----------------------------------------------------------------------------
+        template<typename Alloc,
+                 typename = std::enable_if_t<std::uses_allocator<container_type, Alloc>::value> >
+        explicit stack_t(const Alloc& alloc) :
+            data_(alloc) {
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @param cont The container which is copied into the stack
+        //-----------------------------------------------------------------------------
+        explicit stack_t(const container_type& cont) :
+            data_(cont) {
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @param cont The container which is moved into the stack
+        //-----------------------------------------------------------------------------
+        explicit stack_t(container_type&& cont) noexcept :
+            data_(std::move(cont)) {
+        }
+
         //-----------------------------------------------------------------------------
         //! @brief The copy constructor
         //! @param that The copy source
@@ -70,8 +100,8 @@ namespace atom {
         //! @brief The move constructor
         //! @param that The move source
         //-----------------------------------------------------------------------------
-        stack_t(stack_t&& that) noexcept {
-            swap(that);
+        stack_t(stack_t&& that) noexcept :
+            data_(std::move(that.data_)) {
         }
 
         //-----------------------------------------------------------------------------
@@ -81,7 +111,7 @@ namespace atom {
         //-----------------------------------------------------------------------------
         stack_t& operator=(stack_t&& that) {
             if (this != &that) {
-                swap(that);
+                data_ = std::move(that.data_);
             }
             return *this;
         }
@@ -158,7 +188,7 @@ namespace atom {
         //-----------------------------------------------------------------------------
         //! @brief Clear the stack
         //-----------------------------------------------------------------------------
-        void clear() const noexcept {
+        void clear() noexcept {
             data_.clear();
         }
 
@@ -3,6 +3,10 @@
 
 #include <algorithm>
 #include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
 #include <memory.h>
 #include "exceptions.h"
 #include "debug_tools.h"
@@ -10,46 +14,56 @@
 
 namespace atom {
 
-    template<typename Tp>
-    void vector_t<Tp>::shrink_alloc(const size_type n) {
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    void vector_t<Tp, Allocator, GrowthPolicy>::shrink_alloc(const size_type n) {
         const size_type new_capacity = n;
         const size_type new_size     = std::min(n, size_);
 
-        value_type* tmp_buffer = nullptr;
-
-        try {
-            tmp_buffer = new value_type[new_capacity];
-        }
-        catch (std::bad_alloc) {
-            throw atom::badAlloc(FULL_COORDINATES_FFL);
+        if (!new_capacity) {
+            clear();
+            return;
         }
 
-        if (is_arithmetic_type_) {
-            memcpy(tmp_buffer, data_, new_size * sizeof(value_type));
+        if constexpr (is_reallocatable_) {
+            destroy_range(data_ + new_size, size_ - new_size);
+            size_ = new_size;
+
+            data_     = allocator().reallocate(data_, capacity_, new_capacity);
+            capacity_ = new_capacity;
         }
         else {
-            std::copy_n(data_, new_size, tmp_buffer);
-        }
+            value_type* tmp_buffer = allocate(new_capacity);
 
-        clear();
+            try {
+                relocate(data_, new_size, tmp_buffer);
+            }
+            catch (...) {
+                deallocate(tmp_buffer, new_capacity);
+                throw;
+            }
 
-        std::swap(data_, tmp_buffer);
-        capacity_ = new_capacity;
-        size_     = new_size;
+            release_relocated(new_size);
+
+            data_     = tmp_buffer;
+            capacity_ = new_capacity;
+            size_     = new_size;
+        }
 
 #ifndef ATOM_NDEBUG
-        std::fill(data_ + size_, data_ + capacity_, POISON<value_type>::value);
+        if constexpr (std::is_arithmetic<value_type>::value) {
+            std::fill(data_ + size_, data_ + capacity_, POISON<value_type>::value);
+        }
 #endif
 
         ATOM_ASSERT_VALID(this);
     }
 
-    template<typename Tp>
-    vector_t<Tp>::vector_t(const vector_t& that) :
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    vector_t<Tp, Allocator, GrowthPolicy>::vector_t(const vector_t& that, const allocator_type& alloc) :
+        allocator_type(alloc),
         size_         (0),
         capacity_     (0),
-        data_         (nullptr),
-        status_valid_ (1) {
+        data_         (nullptr) {
 
 #ifndef ATOM_NDEBUG
         try {
@@ -63,65 +77,495 @@ namespace atom {
         }
 #endif
 
-        if (is_arithmetic_type_) {
-            memcpy(data_, that.data_, that.size_ * sizeof(value_type));
+        if constexpr (std::is_arithmetic<value_type>::value) {
+            if (that.size_) {
+                memcpy(data_, that.data_, that.size_ * sizeof(value_type));
+            }
         }
         else {
-            std::copy_n(that.data_, that.size_, data_);
+            try {
+                construct_range(that.data_, that.size_, data_);
+            }
+            catch (...) {
+                clear();
+#ifndef ATOM_NDEBUG
+                status_valid_ = 0;
+#endif
+                throw;
+            }
         }
 
         size_ = that.size_;
     }
 
-    template<typename Tp>
-    void vector_t<Tp>::resize(const size_type n, const_reference value) {
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    const vector_t<Tp, Allocator, GrowthPolicy>&
+    vector_t<Tp, Allocator, GrowthPolicy>::operator=(const vector_t& that) {
+        if (this == &that) {
+            return *this;
+        }
+
+        const bool propagate = alloc_traits::propagate_on_container_copy_assignment::value;
+
+        vector_t tmp_vector(that, propagate ? that.allocator() : allocator());
+
+        clear();
+        if (propagate) {
+            allocator() = tmp_vector.allocator();
+        }
+        steal(tmp_vector);
+
+        return *this;
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    vector_t<Tp, Allocator, GrowthPolicy>&
+    vector_t<Tp, Allocator, GrowthPolicy>::operator=(vector_t&& that) {
+        if (this == &that) {
+            return *this;
+        }
+
+        if (alloc_traits::propagate_on_container_move_assignment::value) {
+            clear();
+            allocator() = std::move(that.allocator());
+            steal(that);
+        }
+        else if (allocator() == that.allocator()) {
+            clear();
+            steal(that);
+        }
+        else {
+            vector_t tmp_vector(allocator());
+            tmp_vector.shrink_alloc(that.size_);
+            tmp_vector.relocate(that.data_, that.size_, tmp_vector.data_);
+            tmp_vector.size_ = that.size_;
+
+            that.release_relocated(that.size_);
+            clear();
+            steal(tmp_vector);
+        }
+
+        return *this;
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    void vector_t<Tp, Allocator, GrowthPolicy>::resize(const size_type n, const_reference value) {
         ATOM_ASSERT_VALID(this);
 
         const size_type new_size = n;
 
         shrink_alloc(new_size);
 
-        std::fill(data_ + size_, data_ + new_size, value);
+        construct_fill(data_ + size_, new_size - size_, value);
         size_ = new_size;
 
         ATOM_ASSERT_VALID(this);
     }
 
-    template<typename Tp>
-    void vector_t<Tp>::resize(const size_type n, const_value_type&& value) {
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    void vector_t<Tp, Allocator, GrowthPolicy>::resize(const size_type n, const_value_type&& value) {
         ATOM_ASSERT_VALID(this);
 
         const size_type new_size = n;
 
         shrink_alloc(new_size);
 
-        std::fill(data_ + size_, data_ + new_size, value);
+        construct_fill(data_ + size_, new_size - size_, value);
         size_ = new_size;
 
         ATOM_ASSERT_VALID(this);
     }
 
-    template<typename Tp>
-    void vector_t<Tp>::alloc(const size_type n) {
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    template<typename... Args>
+    typename vector_t<Tp, Allocator, GrowthPolicy>::reference
+    vector_t<Tp, Allocator, GrowthPolicy>::emplace_back(Args&&... args) {
         ATOM_ASSERT_VALID(this);
 
-        if (n <= capacity_) {
+        if (size_ < capacity_) {
+            alloc_traits::construct(allocator(), data_ + size_, std::forward<Args>(args)...);
+            ++size_;
+
+            ATOM_ASSERT_VALID(this);
+            return data_[size_ - 1];
+        }
+
+        const size_type new_capacity = next_capacity(size_ + 1);
+        const size_type new_size     = size_ + 1;
+
+        if constexpr (is_reallocatable_) {
+            // Arguments may refer to the old memory which is invalidated by reallocate()
+            value_type item(std::forward<Args>(args)...);
+
+            shrink_alloc(new_capacity);
+
+            alloc_traits::construct(allocator(), data_ + size_, std::move(item));
+            ++size_;
+
+            ATOM_ASSERT_VALID(this);
+            return data_[size_ - 1];
+        }
+
+        value_type* tmp_buffer = allocate(new_capacity);
+
+        try {
+            alloc_traits::construct(allocator(), tmp_buffer + size_, std::forward<Args>(args)...);
+        }
+        catch (...) {
+            deallocate(tmp_buffer, new_capacity);
+            throw;
+        }
+
+        try {
+            relocate(data_, size_, tmp_buffer);
+        }
+        catch (...) {
+            alloc_traits::destroy(allocator(), tmp_buffer + size_);
+            deallocate(tmp_buffer, new_capacity);
+            throw;
+        }
+
+        release_relocated(size_);
+
+        data_     = tmp_buffer;
+        capacity_ = new_capacity;
+        size_     = new_size;
+
+#ifndef ATOM_NDEBUG
+        if constexpr (std::is_arithmetic<value_type>::value) {
+            std::fill(data_ + size_, data_ + capacity_, POISON<value_type>::value);
+        }
+#endif
+
+        ATOM_ASSERT_VALID(this);
+        return data_[size_ - 1];
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    bool vector_t<Tp, Allocator, GrowthPolicy>::erase(const size_type first, size_type last) {
+        ATOM_ASSERT_VALID(this);
+
+        last = std::min(last, size_);
+
+        if (first >= last) {
+            return false;
+        }
+
+        const size_type count = last - first;
+
+        if constexpr (is_memmovable_) {
+            destroy_range(data_ + first, count);
+            memmove(static_cast<void*>(data_ + first), static_cast<const void*>(data_ + last),
+                    (size_ - last) * sizeof(value_type));
+        }
+        else {
+            std::move(data_ + last, data_ + size_, data_ + first);
+            destroy_range(data_ + size_ - count, count);
+        }
+
+        size_ -= count;
+
+#ifndef ATOM_NDEBUG
+        if constexpr (std::is_arithmetic<value_type>::value) {
+            std::fill(data_ + size_, data_ + size_ + count, POISON<value_type>::value);
+        }
+#endif
+
+        ATOM_ASSERT_VALID(this);
+
+        return true;
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    template<typename Pred>
+    typename vector_t<Tp, Allocator, GrowthPolicy>::size_type
+    vector_t<Tp, Allocator, GrowthPolicy>::erase_if(Pred pred) {
+        ATOM_ASSERT_VALID(this);
+
+        const size_type kept  = compact_if(data_, size_, pred);
+        const size_type count = size_ - kept;
+
+        destroy_range(data_ + kept, count);
+        size_ = kept;
+
+#ifndef ATOM_NDEBUG
+        if constexpr (std::is_arithmetic<value_type>::value) {
+            std::fill(data_ + size_, data_ + size_ + count, POISON<value_type>::value);
+        }
+#endif
+
+        ATOM_ASSERT_VALID(this);
+
+        return count;
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    template<typename InputIt>
+    void vector_t<Tp, Allocator, GrowthPolicy>::insert(const size_type position, InputIt first, InputIt last) {
+        ATOM_ASSERT_VALID(this);
+
+        ATOM_OUT_OF_RANGE(position > size_);
+
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+
+        if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+            const size_type n = static_cast<size_type>(std::distance(first, last));
+
+            if (!n) {
+                return;
+            }
+
+            alloc(size_ + n);
+
+            value_type*     gap  = data_ + position;
+            const size_type tail = size_ - position;
+
+            if constexpr (is_memmovable_) {
+                memmove(static_cast<void*>(gap + n), static_cast<const void*>(gap), tail * sizeof(value_type));
+
+                try {
+                    construct_range(first, n, gap);
+                }
+                catch (...) {
+                    memmove(static_cast<void*>(gap), static_cast<const void*>(gap + n), tail * sizeof(value_type));
+                    throw;
+                }
+
+                size_ += n;
+            }
+            else {
+                construct_range(first, n, data_ + size_);
+                size_ += n;
+
+                std::rotate(gap, data_ + size_ - n, data_ + size_);
+            }
+        }
+        else {
+            const size_type old_size = size_;
+
+            try {
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+            }
+            catch (...) {
+                erase(old_size, size_);
+                throw;
+            }
+
+            std::rotate(data_ + position, data_ + old_size, data_ + size_);
+        }
+
+        ATOM_ASSERT_VALID(this);
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    void vector_t<Tp, Allocator, GrowthPolicy>::append(const value_type* ptr, const size_type n) {
+        ATOM_ASSERT_VALID(this);
+
+        if (!n) {
             return;
         }
 
-        size_type new_capacity = std::max(capacity_, static_cast<size_type>(1));
+        if (size_ + n > capacity_) {
+            const std::less<const value_type*> less;
 
-        while (new_capacity < n) {
-            new_capacity *= MEMORY_MULTIPLIER_;
+            if (!less(ptr, data_) && less(ptr, data_ + size_)) {
+                // Source is the vector itself, it is moved by alloc()
+                const size_type offset = static_cast<size_type>(ptr - data_);
+
+                alloc(size_ + n);
+                ptr = data_ + offset;
+            }
+            else {
+                alloc(size_ + n);
+            }
+        }
+
+        construct_range(ptr, n, data_ + size_);
+        size_ += n;
+
+        ATOM_ASSERT_VALID(this);
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    template<typename InputIt>
+    void vector_t<Tp, Allocator, GrowthPolicy>::assign(InputIt first, InputIt last) {
+        ATOM_ASSERT_VALID(this);
+
+#ifndef ATOM_NDEBUG
+        const size_type old_size = size_;
+#endif
+
+        destroy_range(data_, size_);
+        size_ = 0;
+
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+
+        if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+            const size_type n = static_cast<size_type>(std::distance(first, last));
+
+            if (n > capacity_) {
+                shrink_alloc(n);
+            }
+
+            construct_range(first, n, data_);
+            size_ = n;
+        }
+        else {
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        }
+
+#ifndef ATOM_NDEBUG
+        if constexpr (std::is_arithmetic<value_type>::value) {
+            if (old_size > size_) {
+                std::fill(data_ + size_, data_ + old_size, POISON<value_type>::value);
+            }
+        }
+#endif
+
+        ATOM_ASSERT_VALID(this);
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    void vector_t<Tp, Allocator, GrowthPolicy>::alloc(const size_type n) {
+        ATOM_ASSERT_VALID(this);
+
+        if (n <= capacity_) {
+            return;
         }
 
-        shrink_alloc(new_capacity);
+        shrink_alloc(next_capacity(n));
 
         ATOM_ASSERT_VALID(this);
     }
 
-    template<typename Tp>
-    void vector_t<Tp>::dump(const char* file,
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    typename vector_t<Tp, Allocator, GrowthPolicy>::size_type
+    vector_t<Tp, Allocator, GrowthPolicy>::next_capacity(const size_type n) const noexcept {
+        return GrowthPolicy::next_capacity(capacity_, n);
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    void vector_t<Tp, Allocator, GrowthPolicy>::relocate(value_type* src, const size_type n, value_type* dst) {
+        if constexpr (is_trivially_relocatable<value_type>::value) {
+            if (n) {
+                memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+            }
+        }
+        else if constexpr (std::is_nothrow_move_constructible<value_type>::value ||
+                           !std::is_copy_constructible<value_type>::value) {
+            construct_range(std::make_move_iterator(src), n, dst);
+        }
+        else {
+            construct_range(src, n, dst);
+        }
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    template<typename InputIt>
+    void vector_t<Tp, Allocator, GrowthPolicy>::construct_range(InputIt first, const size_type n, value_type* dst) {
+        using source_type = typename std::remove_cv<typename std::remove_pointer<InputIt>::type>::type;
+
+        if constexpr (std::is_pointer<InputIt>::value &&
+                      std::is_same<source_type, value_type>::value &&
+                      std::is_trivially_copyable<value_type>::value) {
+            if (n) {
+                memcpy(static_cast<void*>(dst), static_cast<const void*>(first), n * sizeof(value_type));
+            }
+        }
+        else {
+            size_type i = 0;
+
+            try {
+                for (; i < n; ++i, ++first) {
+                    alloc_traits::construct(allocator(), dst + i, *first);
+                }
+            }
+            catch (...) {
+                destroy_range(dst, i);
+                throw;
+            }
+        }
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    void vector_t<Tp, Allocator, GrowthPolicy>::construct_fill(value_type* dst, const size_type n, const_reference value) {
+        size_type i = 0;
+
+        try {
+            for (; i < n; ++i) {
+                alloc_traits::construct(allocator(), dst + i, value);
+            }
+        }
+        catch (...) {
+            destroy_range(dst, i);
+            throw;
+        }
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    void vector_t<Tp, Allocator, GrowthPolicy>::destroy_range(value_type* first, const size_type n) noexcept {
+        for (size_type i = 0; i < n; ++i) {
+            alloc_traits::destroy(allocator(), first + i);
+        }
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    void vector_t<Tp, Allocator, GrowthPolicy>::release_relocated(const size_type n) noexcept {
+        if constexpr (is_trivially_relocatable<value_type>::value) {
+            destroy_range(data_ + n, size_ - n);
+        }
+        else {
+            destroy_range(data_, size_);
+        }
+
+        deallocate(data_, capacity_);
+
+        data_     = nullptr;
+        size_     = 0;
+        capacity_ = 0;
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    void vector_t<Tp, Allocator, GrowthPolicy>::steal(vector_t& that) noexcept {
+        data_     = that.data_;
+        size_     = that.size_;
+        capacity_ = that.capacity_;
+
+        that.data_     = nullptr;
+        that.size_     = 0;
+        that.capacity_ = 0;
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    typename vector_t<Tp, Allocator, GrowthPolicy>::value_type*
+    vector_t<Tp, Allocator, GrowthPolicy>::allocate(const size_type n) {
+        if (!n) {
+            return nullptr;
+        }
+
+        ATOM_BAD_ALLOC(n > alloc_traits::max_size(allocator()));
+
+        try {
+            return alloc_traits::allocate(allocator(), n);
+        }
+        catch (const std::bad_alloc&) {
+            throw atom::badAlloc(FULL_COORDINATES_FFL);
+        }
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    void vector_t<Tp, Allocator, GrowthPolicy>::deallocate(value_type* ptr, const size_type n) noexcept {
+        if (ptr) {
+            alloc_traits::deallocate(allocator(), ptr, n);
+        }
+    }
+
+    template<typename Tp, typename Allocator, typename GrowthPolicy>
+    void vector_t<Tp, Allocator, GrowthPolicy>::dump(const char* file,
                             const char* function_name,
                             int         line_number,
                             const char* output_file) const {
@@ -138,16 +582,20 @@ namespace atom {
                 "line: "           << line_number   << "\n"
                 "status: "         << (is_valid() ? "ok\n{\n" : "FAIL\n{\n");
         fout << "\tsize: "         << size_         << "\n"
-                "\tcapacity: "     << capacity_     << "\n"
-                "\tfield_status: " << (status_valid_ ? "ok\n\n" : "fail\n\n");
+                "\tcapacity: "     << capacity_     << "\n";
+#ifndef ATOM_NDEBUG
+        fout << "\tfield_status: " << (status_valid_ ? "ok\n\n" : "fail\n\n");
+#endif
 
 #ifndef ATOM_NWRITE
         for (size_type i = 0; i < size_; ++i) {
             fout << "\t* [" << i << "] =  " << data_[i] << "\n";
         }
-        for (size_type i = size_; i < capacity_; ++i) {
-            fout << "\t  [" << i << "] =  " << data_[i]
-                 << (data_[i] != POISON<value_type>::value ? "\t//ERROR!\n" : "\n");
+        if constexpr (std::is_arithmetic<value_type>::value) {
+            for (size_type i = size_; i < capacity_; ++i) {
+                fout << "\t  [" << i << "] =  " << data_[i]
+                     << (data_[i] != POISON<value_type>::value ? "\t//ERROR!\n" : "\n");
+            }
         }
 #endif
         fout << "}\n"
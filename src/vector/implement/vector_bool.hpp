@@ -10,20 +10,31 @@
 
 namespace atom {
 
-    void vector_t<bool>::shrink_alloc(const size_type n_bit) {
+    template<typename Allocator, typename GrowthPolicy>
+    void vector_t<bool, Allocator, GrowthPolicy>::shrink_alloc(const size_type n_bit) {
         const size_type new_capacity = bit_to_block(n_bit);
         const size_type new_size     = std::min(n_bit, size_);
 
-        bit_container_type* tmp_buffer = nullptr;
+        if constexpr (has_reallocate<allocator_type>::value) {
+            if (new_capacity) {
+                data_     = allocator().reallocate(data_, bit_to_block(capacity_), new_capacity);
+                capacity_ = block_to_bit(new_capacity);
+                size_     = new_size;
 
-        try {
-            tmp_buffer = new bit_container_type[new_capacity];
-        }
-        catch (std::bad_alloc) {
-            throw atom::badAlloc(FULL_COORDINATES_FFL);
+#ifndef ATOM_NDEBUG
+                fill_n_bit(size_, capacity_ - size_, POISON<bool>::value);
+#endif
+
+                ATOM_ASSERT_VALID(this);
+                return;
+            }
         }
 
-        copy_bits(tmp_buffer, data_, new_size, BIT_BLOCK_SIZE);
+        bit_container_type* tmp_buffer = allocate(new_capacity);
+
+        if (tmp_buffer) {
+            copy_bits(tmp_buffer, data_, new_size, BIT_BLOCK_SIZE);
+        }
 
         clear();
 
@@ -38,11 +49,12 @@ namespace atom {
         ATOM_ASSERT_VALID(this);
     }
 
-    vector_t<bool>::vector_t(const vector_t& that) :
+    template<typename Allocator, typename GrowthPolicy>
+    vector_t<bool, Allocator, GrowthPolicy>::vector_t(const vector_t& that, const allocator_type& alloc) :
+        allocator_type(alloc),
         size_         (0),
         capacity_     (0),
-        data_         (nullptr),
-        status_valid_ (1) {
+        data_         (nullptr) {
 
 #ifndef ATOM_NDEBUG
         try {
@@ -63,7 +75,89 @@ namespace atom {
         ATOM_ASSERT_VALID(this);
     }
 
-    void vector_t<bool>::resize(const size_type n, const bool value) {
+    template<typename Allocator, typename GrowthPolicy>
+    const vector_t<bool, Allocator, GrowthPolicy>&
+    vector_t<bool, Allocator, GrowthPolicy>::operator=(const vector_t& that) {
+        if (this == &that) {
+            return *this;
+        }
+
+        const bool propagate = alloc_traits::propagate_on_container_copy_assignment::value;
+
+        vector_t tmp_vector(that, propagate ? that.allocator() : allocator());
+
+        clear();
+        if (propagate) {
+            allocator() = tmp_vector.allocator();
+        }
+        steal(tmp_vector);
+
+        return *this;
+    }
+
+    template<typename Allocator, typename GrowthPolicy>
+    vector_t<bool, Allocator, GrowthPolicy>&
+    vector_t<bool, Allocator, GrowthPolicy>::operator=(vector_t&& that) {
+        if (this == &that) {
+            return *this;
+        }
+
+        if (alloc_traits::propagate_on_container_move_assignment::value) {
+            clear();
+            allocator() = std::move(that.allocator());
+            steal(that);
+        }
+        else if (allocator() == that.allocator()) {
+            clear();
+            steal(that);
+        }
+        else {
+            vector_t tmp_vector(that, allocator());
+
+            that.clear();
+            clear();
+            steal(tmp_vector);
+        }
+
+        return *this;
+    }
+
+    template<typename Allocator, typename GrowthPolicy>
+    bit_container_type* vector_t<bool, Allocator, GrowthPolicy>::allocate(const size_type n_block) {
+        if (!n_block) {
+            return nullptr;
+        }
+
+        ATOM_BAD_ALLOC(n_block > alloc_traits::max_size(allocator()));
+
+        try {
+            return alloc_traits::allocate(allocator(), n_block);
+        }
+        catch (const std::bad_alloc&) {
+            throw atom::badAlloc(FULL_COORDINATES_FFL);
+        }
+    }
+
+    template<typename Allocator, typename GrowthPolicy>
+    void vector_t<bool, Allocator, GrowthPolicy>::deallocate(bit_container_type* ptr, const size_type n_block) noexcept {
+        if (ptr) {
+            alloc_traits::deallocate(allocator(), ptr, n_block);
+        }
+    }
+
+    template<typename Allocator, typename GrowthPolicy>
+    void vector_t<bool, Allocator, GrowthPolicy>::steal(vector_t& that) noexcept {
+        data_     = that.data_;
+        size_     = that.size_;
+        capacity_ = that.capacity_;
+
+        that.data_     = nullptr;
+        that.size_     = 0;
+        that.capacity_ = 0;
+    }
+
+    template<typename Allocator, typename GrowthPolicy>
+    void vector_t<bool, Allocator, GrowthPolicy>::resize(const size_type n, const bool value) {
         ATOM_ASSERT_VALID(this);
 
         const size_type new_size = n;
@@ -79,26 +173,23 @@ namespace atom {
         ATOM_ASSERT_VALID(this);
     }
 
-    void vector_t<bool>::alloc(const size_type n) {
+    template<typename Allocator, typename GrowthPolicy>
+    void vector_t<bool, Allocator, GrowthPolicy>::alloc(const size_type n) {
         ATOM_ASSERT_VALID(this);
 
         if (n <= capacity_) {
             return;
         }
 
-        size_type new_capacity = std::max(bit_to_block(capacity_), static_cast<size_type>(1));
-
-        size_type need_capacity = bit_to_block(n);
-        while (new_capacity < need_capacity) {
-            new_capacity *= MEMORY_MULTIPLIER_;
-        }
+        const size_type new_capacity = GrowthPolicy::next_capacity(bit_to_block(capacity_), bit_to_block(n));
 
         shrink_alloc(block_to_bit(new_capacity));
 
         ATOM_ASSERT_VALID(this);
     }
 
-    void vector_t<bool>::fill_n_bit(const size_type begin,
+    template<typename Allocator, typename GrowthPolicy>
+    void vector_t<bool, Allocator, GrowthPolicy>::fill_n_bit(const size_type begin,
                                     const size_type n,
                                     const bool      value) {
 
@@ -124,62 +215,101 @@ namespace atom {
         ATOM_ASSERT_VALID(this);
     }
 
-    bool vector_t<bool>::erase(const size_type pos) {
+    template<typename Allocator, typename GrowthPolicy>
+    bool vector_t<bool, Allocator, GrowthPolicy>::erase(const size_type first, size_type last) {
         ATOM_ASSERT_VALID(this);
 
-        if (pos >= size_) {
+        last = std::min(last, size_);
+        if (first >= last) {
             return false;
         }
 
-        size_type it = pos;
-        --size_;
-
-        while (it % BIT_BLOCK_SIZE && it != size_) {
-            set_bit(it, get_bit(it + 1));
-            ++it;
-        }
-        while (it + BIT_BLOCK_SIZE <= size_) {
-            data_[n_block(it)] >>= 1;
-            it += BIT_BLOCK_SIZE;
-        }
-        for (; it < size_; ++it) {
-            set_bit(it, get_bit(it + 1));
-        }
+        move_bits(data_, first, last, size_ - last);
+        size_ -= last - first;
 
 #ifndef ATOM_NDEBUG
-        set_bit(size_, POISON<bool>::value);
+        fill_n_bit(size_, last - first, POISON<bool>::value);
 #endif
         ATOM_ASSERT_VALID(this);
         return true;
     }
 
+    template<typename Allocator, typename GrowthPolicy>
+    void vector_t<bool, Allocator, GrowthPolicy>::insert(const size_type pos, const size_type count, const bool value) {
+        ATOM_ASSERT_VALID(this);
+        ATOM_OUT_OF_RANGE(pos > size_);
+
+        if (!count) {
+            return;
+        }
+
+        alloc(size_ + count);
+
+        move_bits(data_, pos + count, pos, size_ - pos);
+        fill_n_bit(pos, count, value);
+        size_ += count;
 
-    vector_t<bool>::size_type
-    vector_t<bool>::count() const {
         ATOM_ASSERT_VALID(this);
+    }
 
-        size_type result       = 0;
-        size_type count_blocks = size_ / BIT_BLOCK_SIZE;
+    template<typename Allocator, typename GrowthPolicy>
+    void vector_t<bool, Allocator, GrowthPolicy>::append(const vector_t& that) {
+        ATOM_ASSERT_VALID(this);
+        ATOM_ASSERT_VALID(&that);
 
-        for (size_type i = 0; i < count_blocks; ++i) {
-            bit_container_type copy_block = data_[i];
-            while (copy_block) {
-                result += last_bit(copy_block);
-                copy_block >>= 1;
-            }
+        const size_type count = that.size_;
+
+        if (!count) {
+            return;
         }
-        if (data_) {
-            bit_container_type copy_block = data_[count_blocks];
-            for (size_type i = block_to_bit(count_blocks); i < size_; ++i) {
-                result += last_bit(copy_block);
-                copy_block >>= 1;
-            }
+
+        // that.data_ is read after alloc(), that can be the calling object
+        alloc(size_ + count);
+
+        copy_bit_range(data_, size_, that.data_, 0, count);
+        size_ += count;
+
+        ATOM_ASSERT_VALID(this);
+    }
+
+    template<typename Allocator, typename GrowthPolicy>
+    vector_t<bool, Allocator, GrowthPolicy>
+    vector_t<bool, Allocator, GrowthPolicy>::subvector(const size_type from, const size_type len) const {
+        ATOM_ASSERT_VALID(this);
+        ATOM_OUT_OF_RANGE(from > size_ || len > size_ - from);
+
+        vector_t result(alloc_traits::select_on_container_copy_construction(allocator()));
+
+        result.shrink_alloc(len);
+        copy_bit_range(result.data_, 0, data_, from, len);
+        result.size_ = len;
+
+        ATOM_ASSERT_VALID(&result);
+        return result;
+    }
+
+
+    template<typename Allocator, typename GrowthPolicy>
+    typename vector_t<bool, Allocator, GrowthPolicy>::size_type
+    vector_t<bool, Allocator, GrowthPolicy>::count() const {
+        ATOM_ASSERT_VALID(this);
+
+        const size_type count_blocks = size_ / BIT_BLOCK_SIZE;
+        const size_type remain_bits  = size_ % BIT_BLOCK_SIZE;
+
+        size_type result = simd_popcount(data_, count_blocks);
+
+        if (remain_bits) {
+            // Bits behind size_ are not part of the container
+            result += static_cast<size_type>(
+                __builtin_popcountll(data_[count_blocks] & ((ONE << remain_bits) - 1)));
         }
 
         return result;
     }
 
-    void vector_t<bool>::invert() {
+    template<typename Allocator, typename GrowthPolicy>
+    void vector_t<bool, Allocator, GrowthPolicy>::invert() {
         ATOM_ASSERT_VALID(this);
 
         const size_type count_blocks = size_ / BIT_BLOCK_SIZE;
@@ -198,7 +328,80 @@ namespace atom {
         ATOM_ASSERT_VALID(this);
     }
 
-    void vector_t<bool>::dump(const char* file,
+    template<typename Allocator, typename GrowthPolicy>
+    void vector_t<bool, Allocator, GrowthPolicy>::combine_blocks(bit_container_type*       dst,
+                                                                 const bit_container_type* lhs,
+                                                                 const bit_container_type* rhs,
+                                                                 const size_type           n_bit,
+                                                                 const simd_bit_op         op) {
+
+        const size_type count_blocks = n_bit / BIT_BLOCK_SIZE;
+        const size_type remain_bits  = n_bit % BIT_BLOCK_SIZE;
+
+        simd_bit_combine(dst, lhs, rhs, count_blocks, op);
+
+        if (remain_bits) {
+            // Bits behind the size keep their values, they are poisoned in debug mode
+            const bit_container_type mask = (ONE << remain_bits) - 1;
+            bit_container_type       last = 0;
+
+            simd_bit_combine(&last, lhs + count_blocks, rhs + count_blocks, 1, op, simd_level::scalar);
+            dst[count_blocks] = (dst[count_blocks] & ~mask) | (last & mask);
+        }
+    }
+
+    template<typename Allocator, typename GrowthPolicy>
+    void vector_t<bool, Allocator, GrowthPolicy>::combine(const vector_t& that, const simd_bit_op op) {
+        ATOM_ASSERT_VALID(this);
+        ATOM_ASSERT_VALID(&that);
+        ATOM_INVALID_ARGUMENT(size_ != that.size_);
+
+        combine_blocks(data_, data_, that.data_, size_, op);
+
+        ATOM_ASSERT_VALID(this);
+    }
+
+    template<typename Allocator, typename GrowthPolicy>
+    vector_t<bool, Allocator, GrowthPolicy>
+    vector_t<bool, Allocator, GrowthPolicy>::combined(const vector_t& lhs, const vector_t& rhs, const simd_bit_op op) {
+        ATOM_ASSERT_VALID(&lhs);
+        ATOM_ASSERT_VALID(&rhs);
+        ATOM_INVALID_ARGUMENT(lhs.size_ != rhs.size_);
+
+        vector_t result(alloc_traits::select_on_container_copy_construction(lhs.allocator()));
+
+        result.shrink_alloc(lhs.size_);
+        combine_blocks(result.data_, lhs.data_, rhs.data_, lhs.size_, op);
+        result.size_ = lhs.size_;
+
+        ATOM_ASSERT_VALID(&result);
+        return result;
+    }
+
+    template<typename Allocator, typename GrowthPolicy>
+    typename vector_t<bool, Allocator, GrowthPolicy>::size_type
+    vector_t<bool, Allocator, GrowthPolicy>::combined_count(const vector_t& lhs, const vector_t& rhs, const simd_bit_op op) {
+        ATOM_ASSERT_VALID(&lhs);
+        ATOM_ASSERT_VALID(&rhs);
+        ATOM_INVALID_ARGUMENT(lhs.size_ != rhs.size_);
+
+        const size_type count_blocks = lhs.size_ / BIT_BLOCK_SIZE;
+        const size_type remain_bits  = lhs.size_ % BIT_BLOCK_SIZE;
+
+        size_type result = simd_bit_combine_count(lhs.data_, rhs.data_, count_blocks, op);
+
+        if (remain_bits) {
+            bit_container_type last = 0;
+
+            simd_bit_combine(&last, lhs.data_ + count_blocks, rhs.data_ + count_blocks, 1, op, simd_level::scalar);
+            result += static_cast<size_type>(__builtin_popcountll(last & ((ONE << remain_bits) - 1)));
+        }
+
+        return result;
+    }
+
+    template<typename Allocator, typename GrowthPolicy>
+    void vector_t<bool, Allocator, GrowthPolicy>::dump(const char* file,
                               const char* function_name,
                               int         line_number,
                               const char* output_file) const {
@@ -215,8 +418,10 @@ namespace atom {
                 "line: "           << line_number   << "\n"
                 "status: "         << (is_valid() ? "ok\n{\n" : "FAIL\n{\n");
         fout << "\tsize: "         << size_         << "\n"
-                "\tcapacity: "     << capacity_     << "\n"
-                "\tfield_status: " << (status_valid_ ? "ok\n\n" : "fail\n\n");
+                "\tcapacity: "     << capacity_     << "\n";
+#ifndef ATOM_NDEBUG
+        fout << "\tfield_status: " << (status_valid_ ? "ok\n\n" : "fail\n\n");
+#endif
 
 #ifndef ATOM_NWRITE
         try {
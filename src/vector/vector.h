@@ -17,8 +17,13 @@
 #include "exceptions.h"
 #include "debug_tools.h"
 #include "va_iterator.h"
+#include "allocator/realloc_allocator.h"
+#include "growth_policy.h"
+#include "compact.h"
+#include "simd/simd.h"
 #include <initializer_list>
 #include <type_traits>
+#include <memory>
 
 
 //-----------------------------------------------------------------------------
@@ -30,9 +35,17 @@ namespace atom {
     //-----------------------------------------------------------------------------
     //! @class vector_t
     //! @tparam Tp The type of the value in the vector
+    //! @tparam Allocator The type of the allocator which owns the memory of the vector
+    //! @tparam GrowthPolicy The policy of the capacity growth (see growth_policy.h)
+    //! @details Memory behind position size_ is raw: elements are constructed
+    //! @details only when they become part of the vector and destroyed when they leave it
+    //! @details Allocator is stored as private base, so stateless allocator does not take memory
+    //! @details Trivially relocatable types grow by Allocator::reallocate() when allocator has it
     //-----------------------------------------------------------------------------
-    template<typename Tp>
-    class vector_t {
+    template<typename Tp,
+             typename Allocator    = default_allocator_t<Tp>,
+             typename GrowthPolicy = doubling_growth_policy>
+    class vector_t : private Allocator {
     public:       
 
         friend class va_iterator<Tp>;
@@ -44,15 +57,35 @@ namespace atom {
         using iterator         = va_iterator<Tp>;       //!< Iterator type
         using const_iterator   = va_iterator<const Tp>; //!< Const iterator type
         using size_type        = std::size_t;           //!< Size type
+        using allocator_type   = Allocator;             //!< Allocator type
+
+        static_assert(std::is_same<typename std::allocator_traits<Allocator>::value_type, Tp>::value,
+                      "Allocator::value_type must be the same as Tp");
+        static_assert(std::is_same<typename std::allocator_traits<Allocator>::pointer, Tp*>::value,
+                      "Allocator must use raw pointers");
+        static_assert(is_growth_policy<GrowthPolicy>::value,
+                      "GrowthPolicy must have static function next_capacity(current, required)");
 
         //-----------------------------------------------------------------------------
         //! @brief Default constructor
         //-----------------------------------------------------------------------------
-        vector_t() noexcept :
-            size_        (0),
-            capacity_    (0),
-            data_        (nullptr),
-            status_valid_(1) {
+        vector_t() noexcept(noexcept(Allocator())) :
+            allocator_type(),
+            size_         (0),
+            capacity_     (0),
+            data_         (nullptr) {
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @details Empty vector which will take memory from alloc
+        //! @param alloc Allocator of the vector
+        //-----------------------------------------------------------------------------
+        explicit vector_t(const allocator_type& alloc) noexcept :
+            allocator_type(alloc),
+            size_         (0),
+            capacity_     (0),
+            data_         (nullptr) {
         }
 
         //-----------------------------------------------------------------------------
@@ -60,14 +93,16 @@ namespace atom {
         //! @details Constructor which resize memory to n elements and initialize them
         //! @param n The number of elements for which memory is allocated
         //! @param value initializer for n elements
+        //! @param alloc Allocator of the vector
         //! @throws The same exceptions as the function resize()
         //-----------------------------------------------------------------------------
-        vector_t(const size_type n,
-                 const_reference value) :
+        vector_t(const size_type       n,
+                 const_reference       value,
+                 const allocator_type& alloc = allocator_type()) :
+            allocator_type(alloc),
             size_        (0),
             capacity_    (0),
-            data_        (nullptr),
-            status_valid_(1) {
+            data_        (nullptr) {
 
 #ifndef ATOM_NDEBUG
             try {
@@ -87,14 +122,16 @@ namespace atom {
         //! @details Constructor which resize memory to n elements and initialize them
         //! @param n The number of elements for which memory is allocated
         //! @param value rvalue reference (default value_type()) initializer for n elements
+        //! @param alloc Allocator of the vector
         //! @throws The same exceptions as the function resize()
         //-----------------------------------------------------------------------------
-        vector_t(const size_type n,
-                 const_value_type&& value = value_type()) :
+        vector_t(const size_type       n,
+                 const_value_type&&    value = value_type(),
+                 const allocator_type& alloc = allocator_type()) :
+            allocator_type(alloc),
             size_        (0),
             capacity_    (0),
-            data_        (nullptr),
-            status_valid_(1) {
+            data_        (nullptr) {
 
 #ifndef ATOM_NDEBUG
             try {
@@ -113,18 +150,20 @@ namespace atom {
         //! @brief Constructor at std::initializer_list
         //! @details Constructor which copy from std::initializer_list
         //! @param init List of elements
+        //! @param alloc Allocator of the vector
         //! @throws The same exceptions as the function resize()
         //-----------------------------------------------------------------------------
-        vector_t(const std::initializer_list<value_type>& init) :
+        vector_t(const std::initializer_list<value_type>& init,
+                 const allocator_type&                    alloc = allocator_type()) :
+            allocator_type(alloc),
             size_        (0),
             capacity_    (0),
-            data_        (nullptr),
-            status_valid_(1) {
+            data_        (nullptr) {
 
 #ifndef ATOM_NDEBUG
             try {
 #endif
-                resize(init.size());
+                shrink_alloc(init.size());
 #ifndef ATOM_NDEBUG
             }
             catch (...) {
@@ -133,30 +172,43 @@ namespace atom {
             }
 #endif
 
-            std::copy(init.begin(), init.end(), data_);
+            construct_range(init.begin(), init.size(), data_);
+            size_ = init.size();
         }
 
         //-----------------------------------------------------------------------------
         //! @brief The copy constructor
-        //! @details Deep copy
+        //! @details Deep copy, allocator is taken from select_on_container_copy_construction()
         //! @details Specialized types: short, int, long long, char (also with unsigned), float, double
         //! @details These types use memcpy() and memset()
         //! @param that The copy source
         //! @throws The same exceptions as the function shrink_alloc()
         //-----------------------------------------------------------------------------
-        vector_t(const vector_t& that);
+        vector_t(const vector_t& that) :
+            vector_t(that, alloc_traits::select_on_container_copy_construction(that.get_allocator())) {
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief The copy constructor with allocator
+        //! @details Deep copy
+        //! @param that The copy source
+        //! @param alloc Allocator of the new vector
+        //! @throws The same exceptions as the function shrink_alloc()
+        //-----------------------------------------------------------------------------
+        vector_t(const vector_t& that, const allocator_type& alloc);
 
         //-----------------------------------------------------------------------------
         //! @brief The move constructor
+        //! @details Takes the memory and the allocator of that
         //! @param that The move source
         //-----------------------------------------------------------------------------
         vector_t(vector_t&& that) noexcept :
-            size_        (0),
-            capacity_    (0),
-            data_        (nullptr),
-            status_valid_(1)  {
+            allocator_type(std::move(that.allocator())),
+            size_         (0),
+            capacity_     (0),
+            data_         (nullptr) {
 
-            swap(that);
+            steal(that);
         }
 
         //-----------------------------------------------------------------------------
@@ -164,11 +216,10 @@ namespace atom {
         //! @details Macro ATOM_NDEBUG for debug mode
         //-----------------------------------------------------------------------------
         ~vector_t() {
-            delete[] data_;
-            data_ = nullptr;
-            status_valid_ = 0;
+            clear();
 
 #ifndef ATOM_NDEBUG
+            status_valid_ = 0;
             size_     = POISON<size_type>::value;
             capacity_ = POISON<size_type>::value;
 #endif
@@ -177,27 +228,22 @@ namespace atom {
         //-----------------------------------------------------------------------------
         //! @brief The assignment operator
         //! @details Use copy and move idiom
+        //! @details Allocator of that is copied when propagate_on_container_copy_assignment is true
         //! @param that The source of the assignment
         //! @throws The same exceptions as the vector_t(const vector_t&)
         //! @return Constant reference to the calling object
         //-----------------------------------------------------------------------------
-        const vector_t& operator=(const vector_t& that) {
-            vector_t tmp_vector(that);
-            swap(tmp_vector);
-            return *this;
-        }
+        const vector_t& operator=(const vector_t& that);
 
         //-----------------------------------------------------------------------------
         //! @brief The move assignment operator
+        //! @details Takes the memory of that when propagate_on_container_move_assignment is true
+        //! @details or allocators are equal, otherwise moves elements one by one
         //! @param that The move source
+        //! @throws The same exceptions as the function shrink_alloc() when allocators are not equal
         //! @return Reference to the calling object
         //-----------------------------------------------------------------------------
-        vector_t& operator=(vector_t&& that) {
-            if (this != &that) {
-                swap(that);
-            }
-            return *this;
-        }
+        vector_t& operator=(vector_t&& that);
 
         //-----------------------------------------------------------------------------
         //! @brief Iterator
@@ -281,45 +327,67 @@ namespace atom {
         //! @brief Push new item in back of the vector
         //! @details Can increase the capacity
         //! @param x new element which will be added in vector
-        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
-        //! @throws The same exceptions as the function alloc()
+        //! @throws The same exceptions as the function emplace_back()
         //-----------------------------------------------------------------------------
         void push_back(const_reference x) {
-            ATOM_ASSERT_VALID(this);
-
-            alloc(size_ + 1);
-
-            data_[size_++] = x;
-
-            ATOM_ASSERT_VALID(this);
+            emplace_back(x);
         }
 
         //-----------------------------------------------------------------------------
         //! @brief Push new rvalue reference item in back of the vector
-        //! @details Can increase the capacity
+        //! @details Can increase the capacity, x is moved into the vector
         //! @param x new element which will be added in vector
-        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
-        //! @throws The same exceptions as the function alloc()
+        //! @throws The same exceptions as the function emplace_back()
         //-----------------------------------------------------------------------------
-        void push_back(const_value_type&& x) {
-            ATOM_ASSERT_VALID(this);
-
-            alloc(size_ + 1);
-
-            data_[size_++] = x;
-
-            ATOM_ASSERT_VALID(this);
+        void push_back(value_type&& x) {
+            emplace_back(std::move(x));
         }
 
+        //-----------------------------------------------------------------------------
+        //! @brief Construct new item in back of the vector
+        //! @details Can increase the capacity
+        //! @details Arguments may refer to elements of the vector: new item is constructed before old items are relocated
+        //! @tparam Args Types of the arguments
+        //! @param args Arguments which are forwarded to the constructor of value_type
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throws The same exceptions as the function allocate() and the constructor of value_type
+        //! @return Reference on the new item
+        //-----------------------------------------------------------------------------
+        template<typename... Args>
+        reference emplace_back(Args&&... args);
+
         //-----------------------------------------------------------------------------
         //! @brief Remove nth element
-        //! @details Do not change the capacity
+        //! @details Do not change the capacity, the last element is destroyed
         //! @details Macro ATOM_NDEBUG for debug mode
         //! @param position number of the item in the vector
-        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throws The same exceptions as the function erase(first, last)
         //! @return True if element was delete, otherwise false
         //-----------------------------------------------------------------------------
         bool erase(const size_type position) {
+            return erase(position, position + 1);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Remove elements [first, last)
+        //! @details Do not change the capacity, the tail is shifted once
+        //! @details Trivially relocatable types use memmove()
+        //! @details last is clamped to the size of the vector
+        //! @param first Number of the first removed item
+        //! @param last Number of the item after the last removed item
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return True if elements were deleted, otherwise false
+        //-----------------------------------------------------------------------------
+        bool erase(const size_type first, size_type last);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Remove nth element without keeping the order
+        //! @details The last element is moved to position, O(1)
+        //! @param position number of the item in the vector
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return True if element was delete, otherwise false
+        //-----------------------------------------------------------------------------
+        bool erase_unordered(const size_type position) {
             ATOM_ASSERT_VALID(this);
 
             if (position >= size_) {
@@ -328,12 +396,16 @@ namespace atom {
 
             --size_;
 
-            for (size_type i = position; i < size_; ++i) {
-                data_[i] = data_[i + 1];
+            if (position != size_) {
+                data_[position] = std::move(data_[size_]);
             }
 
+            alloc_traits::destroy(allocator(), data_ + size_);
+
 #ifndef ATOM_NDEBUG
-            data_[size_] = POISON<value_type>::value;
+            if constexpr (std::is_arithmetic<value_type>::value) {
+                data_[size_] = POISON<value_type>::value;
+            }
 #endif
 
             ATOM_ASSERT_VALID(this);
@@ -341,11 +413,67 @@ namespace atom {
             return true;
         }
 
+        //-----------------------------------------------------------------------------
+        //! @brief Remove all elements which satisfy pred
+        //! @details One pass, order of the kept elements is preserved, capacity is not changed
+        //! @details Arithmetic types use branchless compaction (see compact_if())
+        //! @tparam Pred Type of the predicate
+        //! @param pred Returns true for elements which are removed
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throws The same exceptions as pred and the move assignment of value_type
+        //! @return Count of the removed elements
+        //-----------------------------------------------------------------------------
+        template<typename Pred>
+        size_type erase_if(Pred pred);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Insert elements [first, last) before position
+        //! @details Memory is reserved once for forward iterators
+        //! @details Trivially relocatable types shift the tail by memmove(),
+        //! @details trivially copyable elements from a pointer range are copied by memcpy()
+        //! @details Range must not refer to elements of the vector
+        //! @tparam InputIt Type of the iterator on the source
+        //! @param position Number of the item before which elements are inserted
+        //! @param first Begin of the source
+        //! @param last End of the source
+        //! @throw atom::outOfRange When position is bigger than size of the vector
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throws The same exceptions as the function alloc() and the constructor of value_type
+        //-----------------------------------------------------------------------------
+        template<typename InputIt>
+        void insert(const size_type position, InputIt first, InputIt last);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Push n items in back of the vector
+        //! @details Memory is reserved once, trivially copyable types use memcpy()
+        //! @details ptr may refer to elements of the vector
+        //! @param ptr Pointer on the first item
+        //! @param n Count of items
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throws The same exceptions as the function alloc() and the copy constructor of value_type
+        //-----------------------------------------------------------------------------
+        void append(const value_type* ptr, const size_type n);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Replace content by elements [first, last)
+        //! @details Memory is allocated once for forward iterators, capacity is not shrunk
+        //! @details Range must not refer to elements of the vector
+        //! @tparam InputIt Type of the iterator on the source
+        //! @param first Begin of the source
+        //! @param last End of the source
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throws The same exceptions as the function shrink_alloc() and the constructor of value_type
+        //-----------------------------------------------------------------------------
+        template<typename InputIt>
+        void assign(InputIt first, InputIt last);
+
         //-----------------------------------------------------------------------------
         //! @brief Clear the vector
+        //! @details Destroy all elements and free the memory
         //-----------------------------------------------------------------------------
         void clear() noexcept {
-            delete[] data_;
+            destroy_range(data_, size_);
+            deallocate(data_, capacity_);
             data_     = nullptr;
             size_     = 0;
             capacity_ = 0;
@@ -366,6 +494,22 @@ namespace atom {
             ATOM_ASSERT_VALID(this);
         }
 
+        //-----------------------------------------------------------------------------
+        //! @brief Release the memory behind size()
+        //! @details Capacity becomes equal to size(), growth policy is not applied
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throws The same exceptions as the function shrink_alloc()
+        //-----------------------------------------------------------------------------
+        void shrink_to_fit() {
+            ATOM_ASSERT_VALID(this);
+
+            if (size_ < capacity_) {
+                shrink_alloc(size_);
+            }
+
+            ATOM_ASSERT_VALID(this);
+        }
+
         //-----------------------------------------------------------------------------
         //! @brief Create new block of the memory
         //! @details Can change size and capacity
@@ -392,6 +536,65 @@ namespace atom {
         void resize(const size_type n,
                     const_value_type&& value = value_type());
 
+        //-----------------------------------------------------------------------------
+        //! @brief Search of the value
+        //! @details Elements are scanned by simd_find(), int and float use vector kernels
+        //! @param value Searched value
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return Number of the first element which is equal to value, size() when there is no such element
+        //-----------------------------------------------------------------------------
+        size_type find(const_reference value) const {
+            ATOM_ASSERT_VALID(this);
+            return simd_find(data_, size_, value);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the value
+        //! @details Elements are scanned by simd_count(), int and float use vector kernels
+        //! @param value Counted value
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return Count of elements which are equal to value
+        //-----------------------------------------------------------------------------
+        size_type count(const_reference value) const {
+            ATOM_ASSERT_VALID(this);
+            return simd_count(data_, size_, value);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Minimal element
+        //! @details Elements are scanned by simd_min(), int and float use vector kernels
+        //! @throw atom::outOfRange When vector is empty
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return Copy of the minimal element
+        //-----------------------------------------------------------------------------
+        value_type min() const {
+            ATOM_ASSERT_VALID(this);
+            return simd_min(data_, size_);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Maximal element
+        //! @details Elements are scanned by simd_max(), int and float use vector kernels
+        //! @throw atom::outOfRange When vector is empty
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return Copy of the maximal element
+        //-----------------------------------------------------------------------------
+        value_type max() const {
+            ATOM_ASSERT_VALID(this);
+            return simd_max(data_, size_);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Sum of elements
+        //! @details Elements are summed by simd_sum(), integers are summed in 64 bits
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return Sum of elements, zero when vector is empty
+        //-----------------------------------------------------------------------------
+        simd_sum_t<value_type> sum() const {
+            ATOM_ASSERT_VALID(this);
+            return simd_sum(data_, size_);
+        }
+
         //-----------------------------------------------------------------------------
         //! @brief Checks the vector on the void
         //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
@@ -402,6 +605,18 @@ namespace atom {
             return !size_;
         }
 
+        //-----------------------------------------------------------------------------
+        //! @brief Pointer on the first element
+        //! @return Pointer which is invalidated when the vector reallocates, nullptr for empty capacity
+        //-----------------------------------------------------------------------------
+        value_type* data() noexcept {
+            return data_;
+        }
+
+        const value_type* data() const noexcept {
+            return data_;
+        }
+
         //-----------------------------------------------------------------------------
         //! @brief Capacity
         //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
@@ -424,15 +639,33 @@ namespace atom {
 
         //-----------------------------------------------------------------------------
         //! @brief Swap two vector
+        //! @details Allocators are swapped when propagate_on_container_swap is true,
+        //! @details otherwise they must be equal
         //! @param rhs other vector to which you want to exchange
         //-----------------------------------------------------------------------------
         void swap(vector_t& rhs) noexcept {
+            if (alloc_traits::propagate_on_container_swap::value) {
+                using std::swap;
+                swap(allocator(), rhs.allocator());
+            }
+            else {
+                assert(allocator() == rhs.allocator());
+            }
+
             std::swap(data_, rhs.data_);
             std::swap(size_, rhs.size_);
             std::swap(capacity_, rhs.capacity_);
-            unsigned char tmp_status = status_valid_;
-            status_valid_ = rhs.status_valid_;
-            rhs.status_valid_ = tmp_status;
+#ifndef ATOM_NDEBUG
+            std::swap(status_valid_, rhs.status_valid_);
+#endif
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Allocator
+        //! @return Copy of the allocator of the vector
+        //-----------------------------------------------------------------------------
+        allocator_type get_allocator() const noexcept {
+            return allocator();
         }
 
         //-----------------------------------------------------------------------------
@@ -440,23 +673,33 @@ namespace atom {
         //! @return True if vector is valid else return false
         //-----------------------------------------------------------------------------
         bool is_valid() const noexcept {
-            return this && status_valid_ &&
+            return this &&
+#ifndef ATOM_NDEBUG
+                    status_valid_ &&
+#endif
                     (data_ != nullptr ?
                         size_ <= capacity_ : !capacity_ && !size_);
         }
 
     private:
 
-        const size_type MEMORY_MULTIPLIER_ = 2; //!< Constant memory increase
+        using alloc_traits = std::allocator_traits<allocator_type>; //!< Access to the allocator
 
         size_type  size_;     //!< Size of the vector
         size_type  capacity_; //!< Capacity of the vector
         value_type *data_;    //!< A pointer to an vector
 
-        unsigned char status_valid_: 1; //!< Status of the vector
+#ifndef ATOM_NDEBUG
+        unsigned char status_valid_ = 1; //!< Status of the vector, only in debug mode
+#endif
+
+        //! Memory is resized by Allocator::reallocate() without element-wise relocation
+        static constexpr bool is_reallocatable_ = is_trivially_relocatable<value_type>::value &&
+                                                  has_reallocate<allocator_type>::value;
 
-        //! Determinate of the type
-        const bool is_arithmetic_type_ = std::is_arithmetic<value_type>::value;
+        //! Elements are shifted inside the memory by memmove()
+        static constexpr bool is_memmovable_ = is_trivially_relocatable<value_type>::value ||
+                                               std::is_trivially_copyable<value_type>::value;
 
         //-----------------------------------------------------------------------------
         //! @brief Create new block of the memory
@@ -467,9 +710,17 @@ namespace atom {
         //-----------------------------------------------------------------------------
         void alloc(const size_type n);
 
+        //-----------------------------------------------------------------------------
+        //! @brief Capacity after growth
+        //! @param n Required capacity
+        //! @return Capacity which is not less than n
+        //-----------------------------------------------------------------------------
+        size_type next_capacity(const size_type n) const noexcept;
+
         //-----------------------------------------------------------------------------
         //! @brief Create new block of the memory
         //! @details Can change capacity and size, when undefine ATOM_NDEBUG fill all elements which are behind position size_
+        //! @details (only for arithmetic types, other types are left unconstructed)
         //! @details Specialized types: short, int, long long, char (also with unsigned), float, double
         //! @details These types use memcpy() and memset()
         //! @param n New capacity
@@ -478,6 +729,96 @@ namespace atom {
         //-----------------------------------------------------------------------------
         void shrink_alloc(const size_type n);
 
+        //-----------------------------------------------------------------------------
+        //! @brief Allocator
+        //! @return Reference on the allocator of the vector
+        //-----------------------------------------------------------------------------
+        allocator_type& allocator() noexcept {
+            return *this;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Allocator
+        //! @return Constant reference on the allocator of the vector
+        //-----------------------------------------------------------------------------
+        const allocator_type& allocator() const noexcept {
+            return *this;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Allocate raw memory
+        //! @details Elements are not constructed
+        //! @param n The number of elements for which memory is allocated
+        //! @throw atom::badAlloc When not enough of the memory
+        //! @return Pointer on the memory or nullptr when n is zero
+        //-----------------------------------------------------------------------------
+        value_type* allocate(const size_type n);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Free raw memory
+        //! @details Elements must be already destroyed
+        //! @param ptr Pointer from allocate()
+        //! @param n The number of elements which was passed to allocate()
+        //-----------------------------------------------------------------------------
+        void deallocate(value_type* ptr, const size_type n) noexcept;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Construct elements in the raw memory
+        //! @details Already constructed elements are destroyed if constructor throws
+        //! @details Trivially copyable elements from a pointer range are copied by memcpy()
+        //! @tparam InputIt Type of the iterator on the source
+        //! @param first Begin of the source
+        //! @param n Count of elements
+        //! @param dst Raw memory for n elements
+        //! @throws The same exceptions as the constructor of value_type
+        //-----------------------------------------------------------------------------
+        template<typename InputIt>
+        void construct_range(InputIt first, const size_type n, value_type* dst);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Construct copies of value in the raw memory
+        //! @details Already constructed elements are destroyed if constructor throws
+        //! @param dst Raw memory for n elements
+        //! @param n Count of elements
+        //! @param value Source of the copies
+        //! @throws The same exceptions as the copy constructor of value_type
+        //-----------------------------------------------------------------------------
+        void construct_fill(value_type* dst, const size_type n, const_reference value);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Destroy elements
+        //! @param first Pointer on the first element
+        //! @param n Count of elements
+        //-----------------------------------------------------------------------------
+        void destroy_range(value_type* first, const size_type n) noexcept;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Free the memory after its first n elements were relocated
+        //! @details Trivially relocatable elements now live in the new memory and are not destroyed,
+        //! @details other elements were moved or copied and are destroyed. Vector becomes empty.
+        //! @param n Count of the relocated elements
+        //-----------------------------------------------------------------------------
+        void release_relocated(const size_type n) noexcept;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Take the memory of that
+        //! @details Calling vector must be empty and have no memory, that becomes empty
+        //! @param that The source of the memory
+        //-----------------------------------------------------------------------------
+        void steal(vector_t& that) noexcept;
+
+        //-----------------------------------------------------------------------------
+        //! @brief Move elements to the raw memory
+        //! @details Trivially relocatable types use memcpy(), other types are move-constructed
+        //! @details when the move constructor is noexcept (or there is no copy constructor), otherwise copied
+        //! @details Source elements are not destroyed
+        //! @param src Source elements
+        //! @param n Count of elements
+        //! @param dst Raw memory for n elements
+        //! @throws The same exceptions as the copy constructor of value_type
+        //-----------------------------------------------------------------------------
+        void relocate(value_type* src, const size_type n, value_type* dst);
+
         //-----------------------------------------------------------------------------
         //! @brief Dumper
         //! @details Create file "__vector_dump.txt" where is information about vector's status
@@ -497,4 +838,11 @@ namespace atom {
 #include "implement/vector.hpp"
 #include "vector_bool.h"
 
+#ifdef ATOM_NDEBUG
+static_assert(sizeof(atom::vector_t<int>) == 3 * sizeof(void*),
+              "vector_t must contain only size, capacity and pointer to the data");
+static_assert(sizeof(atom::vector_t<bool>) == 3 * sizeof(void*),
+              "vector_t<bool> must contain only size, capacity and pointer to the data");
+#endif
+
 #endif // ATOM_VECTOR_H
@@ -19,7 +19,12 @@
 #include "debug_tools.h"
 #include "bool/va_bool_iterator.h"
 #include "bool/va_bool_ref.h"
+#include "bool/va_set_bit_iterator.h"
+#include "simd/simd.h"
+#include "allocator/realloc_allocator.h"
 #include <cmath>
+#include <memory>
+#include <utility>
 
 
 //-----------------------------------------------------------------------------
@@ -31,26 +36,42 @@ namespace atom {
     //-----------------------------------------------------------------------------
     //! @class vector_t
     //! @details Specialized for bool type
+    //! @tparam Allocator The type of the allocator, it is rebound to bit_container_type
+    //! @tparam GrowthPolicy The policy of the capacity growth in blocks (see growth_policy.h)
     //-----------------------------------------------------------------------------
-    template<>
-    class vector_t<bool> {
+    template<typename Allocator, typename GrowthPolicy>
+    class vector_t<bool, Allocator, GrowthPolicy>
+            : private std::allocator_traits<Allocator>::template rebind_alloc<bit_container_type> {
     public:
 
-        using value_type = bool;
-        using pointer    = bit_container_type*;
-        using size_type  = std::size_t;             //!< Size type
+        using value_type     = bool;
+        using pointer        = bit_container_type*;
+        using size_type      = std::size_t;             //!< Size type
+        using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<bit_container_type>; //!< Allocator of the blocks
 
-        using reference = va_reference<vector_t<bool> >;
-        using iterator  = va_bool_iterator<vector_t<bool> >;
+        using reference = va_reference<vector_t>;
+        using iterator  = va_bool_iterator<vector_t>;
 
         //-----------------------------------------------------------------------------
         //! @brief Default constructor
         //-----------------------------------------------------------------------------
-        vector_t() noexcept :
-            size_        (0),
-            capacity_    (0),
-            data_        (nullptr),
-            status_valid_(1) {
+        vector_t() noexcept(noexcept(allocator_type())) :
+            allocator_type(),
+            size_         (0),
+            capacity_     (0),
+            data_         (nullptr) {
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Constructor
+        //! @details Empty vector which will take memory from alloc
+        //! @param alloc Allocator of the vector
+        //-----------------------------------------------------------------------------
+        explicit vector_t(const allocator_type& alloc) noexcept :
+            allocator_type(alloc),
+            size_         (0),
+            capacity_     (0),
+            data_         (nullptr) {
         }
 
         //-----------------------------------------------------------------------------
@@ -58,14 +79,16 @@ namespace atom {
         //! @details Constructor which resize memory to n elements and initialize them
         //! @param n The number of elements for which memory is allocated
         //! @param value initializer for n elements
+        //! @param alloc Allocator of the vector
         //! @throws The same exceptions as the function resize()
         //-----------------------------------------------------------------------------
-        vector_t(const size_type n,
-                 const bool value = false) :
+        vector_t(const size_type       n,
+                 const bool            value = false,
+                 const allocator_type& alloc = allocator_type()) :
+            allocator_type(alloc),
             size_        (0),
             capacity_    (0),
-            data_        (nullptr),
-            status_valid_(1) {
+            data_        (nullptr) {
 
 #ifndef ATOM_NDEBUG
             try {
@@ -82,23 +105,35 @@ namespace atom {
 
         //-----------------------------------------------------------------------------
         //! @brief The copy constructor
+        //! @details Deep copy, allocator is taken from select_on_container_copy_construction()
+        //! @param that The copy source
+        //! @throws The same exceptions as the function shrink_alloc()
+        //-----------------------------------------------------------------------------
+        vector_t(const vector_t& that) :
+            vector_t(that, alloc_traits::select_on_container_copy_construction(that.get_allocator())) {
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief The copy constructor with allocator
         //! @details Deep copy
         //! @param that The copy source
+        //! @param alloc Allocator of the new vector
         //! @throws The same exceptions as the function shrink_alloc()
         //-----------------------------------------------------------------------------
-        vector_t(const vector_t& that);
+        vector_t(const vector_t& that, const allocator_type& alloc);
 
         //-----------------------------------------------------------------------------
         //! @brief The move constructor
+        //! @details Takes the memory and the allocator of that
         //! @param that The move source
         //-----------------------------------------------------------------------------
         vector_t(vector_t&& that) noexcept :
-            size_        (0),
-            capacity_    (0),
-            data_        (nullptr),
-            status_valid_(1)  {
+            allocator_type(std::move(that.allocator())),
+            size_         (0),
+            capacity_     (0),
+            data_         (nullptr) {
 
-            swap(that);
+            steal(that);
         }
 
         //-----------------------------------------------------------------------------
@@ -106,11 +141,10 @@ namespace atom {
         //! @details Macro ATOM_NDEBUG for debug mode
         //-----------------------------------------------------------------------------
         ~vector_t() {
-            delete[] data_;
-            data_ = nullptr;
-            status_valid_ = 0;
+            clear();
 
 #ifndef ATOM_NDEBUG
+            status_valid_ = 0;
             size_     = POISON<size_type>::value;
             capacity_ = POISON<size_type>::value;
 #endif
@@ -119,27 +153,22 @@ namespace atom {
         //-----------------------------------------------------------------------------
         //! @brief The assignment operator
         //! @details Use copy and move idiom
+        //! @details Allocator of that is copied when propagate_on_container_copy_assignment is true
         //! @param that The source of the assignment
         //! @throws The same exceptions as the vector_t(const vector_t&)
         //! @return Constant reference to the calling object
         //-----------------------------------------------------------------------------
-        const vector_t& operator=(const vector_t& that) {
-            vector_t tmp_vector(that);
-            swap(tmp_vector);
-            return *this;
-        }
+        const vector_t& operator=(const vector_t& that);
 
         //-----------------------------------------------------------------------------
         //! @brief The move assignment operator
+        //! @details Takes the memory of that when propagate_on_container_move_assignment is true
+        //! @details or allocators are equal, otherwise copies the blocks
         //! @param that The move source
+        //! @throws The same exceptions as the function shrink_alloc() when allocators are not equal
         //! @return Reference to the calling object
         //-----------------------------------------------------------------------------
-        vector_t& operator=(vector_t&& that) {
-            if (this != &that) {
-                swap(that);
-            }
-            return *this;
-        }
+        vector_t& operator=(vector_t&& that);
 
         //-----------------------------------------------------------------------------
         //! @brief Iterator
@@ -219,18 +248,89 @@ namespace atom {
             ATOM_ASSERT_VALID(this);
         }
 
-        bool erase(const size_type pos);
+        //-----------------------------------------------------------------------------
+        //! @brief Remove the bit at pos
+        //! @param pos Position of the removed bit
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return True if bit was deleted, otherwise false
+        //-----------------------------------------------------------------------------
+        bool erase(const size_type pos) {
+            return erase(pos, pos + 1);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Remove bits [first, last)
+        //! @details The tail is moved by move_bits(): whole blocks are funnel shifts of two
+        //! @details source blocks, so the cost is O(size / 64) for any first and last
+        //! @details last is clamped to the size of the vector
+        //! @param first Position of the first removed bit
+        //! @param last Position after the last removed bit
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return True if bits were deleted, otherwise false
+        //-----------------------------------------------------------------------------
+        bool erase(const size_type first, size_type last);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Insert the bit before pos
+        //! @param pos Position of the new bit, it can be equal to size()
+        //! @param value Value of the new bit
+        //! @throws The same exceptions as insert(pos, count, value)
+        //-----------------------------------------------------------------------------
+        void insert(const size_type pos, const bool value) {
+            insert(pos, 1, value);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Insert count bits equal to value before pos
+        //! @details The tail is moved by move_bits() in O(size / 64)
+        //! @param pos Position of the first new bit, it can be equal to size()
+        //! @param count Count of the new bits
+        //! @param value Value of the new bits
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throw atom::outOfRange When pos is bigger than size()
+        //! @throws The same exceptions as the function alloc()
+        //-----------------------------------------------------------------------------
+        void insert(const size_type pos, const size_type count, const bool value);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Append the bits of that to the end
+        //! @details Bits are copied by copy_bit_range() in O(that.size() / 64) for any size(),
+        //! @details that can be the calling object
+        //! @param that Source of the bits
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throws The same exceptions as the function alloc()
+        //-----------------------------------------------------------------------------
+        void append(const vector_t& that);
+
+        //-----------------------------------------------------------------------------
+        //! @brief Copy of the bits [from, from + len)
+        //! @details Bits are copied by copy_bit_range() in O(len / 64),
+        //! @details allocator is taken from select_on_container_copy_construction()
+        //! @param from Position of the first bit
+        //! @param len Count of the bits
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throw atom::outOfRange When from + len is bigger than size()
+        //! @throws The same exceptions as the function shrink_alloc()
+        //! @return New vector of len bits
+        //-----------------------------------------------------------------------------
+        vector_t subvector(const size_type from, const size_type len) const;
 
         //-----------------------------------------------------------------------------
         //! @brief Clear the vector
         //-----------------------------------------------------------------------------
         void clear() noexcept {
-            delete[] data_;
+            deallocate(data_, bit_to_block(capacity_));
             data_     = nullptr;
             size_     = 0;
             capacity_ = 0;
         }
 
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the set bits
+        //! @details Full blocks are counted by simd_popcount(), the last block is masked
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return Count of the true elements
+        //-----------------------------------------------------------------------------
         size_type count() const;
 
         void set(const size_type pos) {
@@ -258,6 +358,180 @@ namespace atom {
 
         void invert();
 
+        //-----------------------------------------------------------------------------
+        //! @brief Position of the first set bit
+        //! @details Blocks are scanned with count-trailing-zeros, not bit by bit
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return Position of the bit, size() when there are no set bits
+        //-----------------------------------------------------------------------------
+        size_type find_first() const {
+            ATOM_ASSERT_VALID(this);
+            return find_next_bit(data_, size_, 0);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Position of the first set bit after pos
+        //! @param pos Position to start after, it can be greater than size()
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return Position of the bit, size() when there are no set bits after pos
+        //-----------------------------------------------------------------------------
+        size_type find_next(const size_type pos) const {
+            ATOM_ASSERT_VALID(this);
+            return pos < size_ ? find_next_bit(data_, size_, pos + 1) : size_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Position of the last set bit before pos
+        //! @details find_prev(size()) is the last set bit
+        //! @param pos Position to start before, it can be greater than size()
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return Position of the bit, size() when there are no set bits before pos
+        //-----------------------------------------------------------------------------
+        size_type find_prev(const size_type pos) const {
+            ATOM_ASSERT_VALID(this);
+            return find_prev_bit(data_, size_, pos);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Visit the set bits in ascending order
+        //! @details Cost is proportional to the count of blocks plus the count of set bits
+        //! @tparam Fn Type of the visitor
+        //! @param fn Is called as fn(pos) for every set bit, it must not change the vector
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @throws The same exceptions as fn
+        //-----------------------------------------------------------------------------
+        template<typename Fn>
+        void for_each_set(Fn&& fn) const {
+            ATOM_ASSERT_VALID(this);
+            for_each_set_bit(data_, size_, std::forward<Fn>(fn));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Range of the positions of the set bits
+        //! @details for (size_t pos : mask.set_bits()), the range is invalidated by any change of the vector
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return Range of va_set_bit_iterator
+        //-----------------------------------------------------------------------------
+        va_set_bit_range set_bits() const {
+            ATOM_ASSERT_VALID(this);
+            return va_set_bit_range(data_, size_);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Blocks of the bits
+        //! @details Bit pos is (data()[pos / BIT_BLOCK_SIZE] >> pos % BIT_BLOCK_SIZE) & 1,
+        //! @details bits of the last block behind size() are unspecified
+        //! @return Pointer on the first block, it is invalidated when the vector reallocates
+        //-----------------------------------------------------------------------------
+        bit_container_type* data() noexcept {
+            return data_;
+        }
+
+        const bit_container_type* data() const noexcept {
+            return data_;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Bitwise and with that
+        //! @details Blocks are combined by simd_bit_combine(), bits behind size are not changed
+        //! @param that The second operand of the same size
+        //! @throw atom::invalidArgument When sizes are not equal
+        //! @throw atom::invalidObject From ATOM_ASSERT_VALID() when vector is not valid
+        //! @return Reference to the calling object
+        //-----------------------------------------------------------------------------
+        vector_t& operator&=(const vector_t& that) {
+            combine(that, simd_bit_op::and_);
+            return *this;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Bitwise or with that
+        //! @param that The second operand of the same size
+        //! @throw atom::invalidArgument When sizes are not equal
+        //! @return Reference to the calling object
+        //-----------------------------------------------------------------------------
+        vector_t& operator|=(const vector_t& that) {
+            combine(that, simd_bit_op::or_);
+            return *this;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Bitwise xor with that
+        //! @param that The second operand of the same size
+        //! @throw atom::invalidArgument When sizes are not equal
+        //! @return Reference to the calling object
+        //-----------------------------------------------------------------------------
+        vector_t& operator^=(const vector_t& that) {
+            combine(that, simd_bit_op::xor_);
+            return *this;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Reset bits which are set in that (*this &= ~that without the copy of that)
+        //! @param that The second operand of the same size
+        //! @throw atom::invalidArgument When sizes are not equal
+        //! @return Reference to the calling object
+        //-----------------------------------------------------------------------------
+        vector_t& and_not(const vector_t& that) {
+            combine(that, simd_bit_op::and_not);
+            return *this;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Bitwise and of two vectors
+        //! @details Result is written in the new memory in one pass, operands are not copied
+        //! @param lhs The first operand
+        //! @param rhs The second operand of the same size
+        //! @throw atom::invalidArgument When sizes are not equal
+        //! @throws The same exceptions as the function shrink_alloc()
+        //! @return New vector, allocator is taken from lhs
+        //-----------------------------------------------------------------------------
+        friend vector_t operator&(const vector_t& lhs, const vector_t& rhs) {
+            return combined(lhs, rhs, simd_bit_op::and_);
+        }
+
+        //! @brief Bitwise or of two vectors, see operator&()
+        friend vector_t operator|(const vector_t& lhs, const vector_t& rhs) {
+            return combined(lhs, rhs, simd_bit_op::or_);
+        }
+
+        //! @brief Bitwise xor of two vectors, see operator&()
+        friend vector_t operator^(const vector_t& lhs, const vector_t& rhs) {
+            return combined(lhs, rhs, simd_bit_op::xor_);
+        }
+
+        //! @brief lhs & ~rhs, see operator&()
+        friend vector_t and_not(const vector_t& lhs, const vector_t& rhs) {
+            return combined(lhs, rhs, simd_bit_op::and_not);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Count of the set bits of lhs & rhs
+        //! @details Blocks are combined and counted in registers, result is not stored
+        //! @param lhs The first operand
+        //! @param rhs The second operand of the same size
+        //! @throw atom::invalidArgument When sizes are not equal
+        //! @return (lhs & rhs).count()
+        //-----------------------------------------------------------------------------
+        friend size_type and_count(const vector_t& lhs, const vector_t& rhs) {
+            return combined_count(lhs, rhs, simd_bit_op::and_);
+        }
+
+        //! @brief (lhs | rhs).count() without the result, see and_count()
+        friend size_type or_count(const vector_t& lhs, const vector_t& rhs) {
+            return combined_count(lhs, rhs, simd_bit_op::or_);
+        }
+
+        //! @brief (lhs ^ rhs).count() without the result, see and_count()
+        friend size_type xor_count(const vector_t& lhs, const vector_t& rhs) {
+            return combined_count(lhs, rhs, simd_bit_op::xor_);
+        }
+
+        //! @brief and_not(lhs, rhs).count() without the result, see and_count()
+        friend size_type and_not_count(const vector_t& lhs, const vector_t& rhs) {
+            return combined_count(lhs, rhs, simd_bit_op::and_not);
+        }
+
         //-----------------------------------------------------------------------------
         //! @brief Reserve new memory
         //! @details Do not shrink the capacity
@@ -316,15 +590,33 @@ namespace atom {
 
         //-----------------------------------------------------------------------------
         //! @brief Swap two vector
+        //! @details Allocators are swapped when propagate_on_container_swap is true,
+        //! @details otherwise they must be equal
         //! @param rhs other vector to which you want to exchange
         //-----------------------------------------------------------------------------
         void swap(vector_t& rhs) noexcept {
+            if (alloc_traits::propagate_on_container_swap::value) {
+                using std::swap;
+                swap(allocator(), rhs.allocator());
+            }
+            else {
+                assert(allocator() == rhs.allocator());
+            }
+
             std::swap(data_, rhs.data_);
             std::swap(size_, rhs.size_);
             std::swap(capacity_, rhs.capacity_);
-            unsigned char tmp_status = status_valid_;
-            status_valid_ = rhs.status_valid_;
-            rhs.status_valid_ = tmp_status;
+#ifndef ATOM_NDEBUG
+            std::swap(status_valid_, rhs.status_valid_);
+#endif
+        }
+
+        //-----------------------------------------------------------------------------
+        //! @brief Allocator
+        //! @return Copy of the allocator of the vector
+        //-----------------------------------------------------------------------------
+        allocator_type get_allocator() const noexcept {
+            return allocator();
         }
 
         //-----------------------------------------------------------------------------
@@ -332,20 +624,25 @@ namespace atom {
         //! @return True if vector is valid else return false
         //-----------------------------------------------------------------------------
         bool is_valid() const noexcept {
-            return this && status_valid_ &&
+            return this &&
+#ifndef ATOM_NDEBUG
+                    status_valid_ &&
+#endif
                     !(capacity_% BIT_BLOCK_SIZE) &&
                     (data_ ? size_ <= capacity_ : !capacity_ && !size_);
         }
 
     private:
 
-        const size_type MEMORY_MULTIPLIER_ = 2; //!< Constant memory increase
+        using alloc_traits = std::allocator_traits<allocator_type>; //!< Access to the allocator
 
         size_type           size_;
         size_type           capacity_;
         bit_container_type* data_;
 
-        unsigned char status_valid_: 1; //!< Status of the vector
+#ifndef ATOM_NDEBUG
+        unsigned char status_valid_ = 1; //!< Status of the vector, only in debug mode
+#endif
 
         void set_bit(const size_type pos, const bool value) {
             ATOM_ASSERT_VALID(this);
@@ -388,6 +685,20 @@ namespace atom {
             return div_ceil(count_bits, BIT_BLOCK_SIZE);
         }
 
+        allocator_type& allocator() noexcept {
+            return *this;
+        }
+
+        const allocator_type& allocator() const noexcept {
+            return *this;
+        }
+
+        bit_container_type* allocate(const size_type n_block);
+
+        void deallocate(bit_container_type* ptr, const size_type n_block) noexcept;
+
+        void steal(vector_t& that) noexcept;
+
         void fill_n_bit(const size_type begin,
                         const size_type n,
                         const bool      value);
@@ -396,6 +707,18 @@ namespace atom {
 
         void shrink_alloc(const size_type n_bit);
 
+        static void combine_blocks(bit_container_type*       dst,
+                                   const bit_container_type* lhs,
+                                   const bit_container_type* rhs,
+                                   const size_type           n_bit,
+                                   const simd_bit_op         op);
+
+        void combine(const vector_t& that, const simd_bit_op op);
+
+        static vector_t combined(const vector_t& lhs, const vector_t& rhs, const simd_bit_op op);
+
+        static size_type combined_count(const vector_t& lhs, const vector_t& rhs, const simd_bit_op op);
+
         void dump(const char* file,
                   const char* function_name,
                   int         line_number,
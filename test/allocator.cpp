@@ -0,0 +1,419 @@
+//#define ATOM_NDEBUG
+#include "allocator/arena_allocator.h"
+#include "allocator/realloc_allocator.h"
+#include "vector/vector.h"
+#include "stack/stack.h"
+#include "exceptions.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace atom;
+
+
+//-----------------------------------------------------------------------------
+//! Stateful allocator which is never propagated, allocators are equal when ids are equal
+//-----------------------------------------------------------------------------
+template<typename Tp>
+struct tagged_allocator_t {
+    using value_type = Tp;
+
+    int  id;
+    int* live; //!< Number of not deallocated blocks
+
+    tagged_allocator_t(int tag, int* counter) :
+        id  (tag),
+        live(counter) {
+    }
+
+    template<typename Up>
+    tagged_allocator_t(const tagged_allocator_t<Up>& that) :
+        id  (that.id),
+        live(that.live) {
+    }
+
+    Tp* allocate(std::size_t n) {
+        ++*live;
+        return std::allocator<Tp>().allocate(n);
+    }
+
+    void deallocate(Tp* ptr, std::size_t n) {
+        --*live;
+        std::allocator<Tp>().deallocate(ptr, n);
+    }
+};
+
+template<typename Tp, typename Up>
+bool operator==(const tagged_allocator_t<Tp>& lhs, const tagged_allocator_t<Up>& rhs) {
+    return lhs.id == rhs.id;
+}
+
+template<typename Tp, typename Up>
+bool operator!=(const tagged_allocator_t<Tp>& lhs, const tagged_allocator_t<Up>& rhs) {
+    return lhs.id != rhs.id;
+}
+
+
+TEST(ArenaTest, CheckAllocate) {
+    arena_t arena(256);
+
+    char* first  = static_cast<char*>(arena.allocate(10, 1));
+    char* second = static_cast<char*>(arena.allocate(8, 8));
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(second) % 8, 0u);
+    ASSERT_TRUE(second >= first + 10);
+
+    void* big = arena.allocate(4096, 64);
+    ASSERT_NE(big, nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(big) % 64, 0u);
+
+    ASSERT_THROW(arena.allocate(1, 3), atom::invalidArgument);
+    ASSERT_THROW(arena.allocate(static_cast<std::size_t>(-1), 8), atom::badAlloc);
+}
+
+TEST(ArenaTest, CheckDeallocate) {
+    arena_t arena(256);
+
+    void* first = arena.allocate(16, 8);
+    const std::size_t available = arena.available();
+
+    void* second = arena.allocate(32, 8);
+    arena.deallocate(first, 16);
+    ASSERT_EQ(arena.available(), available - 32);
+
+    arena.deallocate(second, 32);
+    ASSERT_EQ(arena.available(), available);
+    ASSERT_EQ(arena.allocate(32, 8), second);
+}
+
+TEST(ArenaTest, CheckReset) {
+    arena_t arena(128);
+
+    void* first = arena.allocate(64, 8);
+    for (int i = 0; i < 10; ++i) {
+        arena.allocate(100, 8);
+    }
+
+    arena.reset();
+    ASSERT_EQ(arena.available(), arena.block_size());
+
+    void* again = arena.allocate(64, 8);
+    ASSERT_NE(again, nullptr);
+    (void)first;
+
+    arena.release();
+    ASSERT_EQ(arena.available(), 0u);
+    ASSERT_NE(arena.allocate(64, 8), nullptr);
+}
+
+TEST(ArenaAllocatorTest, CheckVector) {
+    arena_t arena(1024);
+    arena_allocator<int> alloc(arena);
+
+    vector_t<int, arena_allocator<int> > test_obj(alloc);
+
+    const int count_insert = 1000;
+    for (int i = 0; i < count_insert; ++i) {
+        test_obj.push_back(i);
+    }
+    for (int i = 0; i < count_insert; ++i) {
+        ASSERT_EQ(test_obj[i], i);
+    }
+    ASSERT_EQ(test_obj.get_allocator().arena(), &arena);
+
+    vector_t<std::string, arena_allocator<std::string> > test_str(3, "arena", arena_allocator<std::string>(arena));
+    test_str.emplace_back(40, 'x');
+    ASSERT_EQ(test_str.size(), 4u);
+    ASSERT_EQ(test_str[0], "arena");
+    ASSERT_EQ(test_str[3], std::string(40, 'x'));
+}
+
+TEST(ArenaAllocatorTest, CheckVectorBool) {
+    arena_t arena(256);
+
+    vector_t<bool, arena_allocator<bool> > test_obj{arena_allocator<bool>(arena)};
+
+    const std::size_t count_insert = 1000;
+    for (std::size_t i = 0; i < count_insert; ++i) {
+        test_obj.push_back(i % 3 == 0);
+    }
+    for (std::size_t i = 0; i < count_insert; ++i) {
+        ASSERT_EQ(test_obj[i], i % 3 == 0);
+    }
+    ASSERT_EQ(test_obj.count(), (count_insert + 2) / 3);
+    ASSERT_EQ(test_obj.get_allocator().arena(), &arena);
+
+    vector_t<bool, arena_allocator<bool> > test_copy(test_obj);
+    ASSERT_EQ(test_copy.get_allocator().arena(), &arena);
+    ASSERT_EQ(test_copy.count(), test_obj.count());
+}
+
+TEST(ArenaAllocatorTest, CheckPropagation) {
+    arena_t arena1;
+    arena_t arena2;
+
+    using vector_type = vector_t<int, arena_allocator<int> >;
+
+    vector_type test_obj1{arena_allocator<int>(arena1)};
+    vector_type test_obj2{arena_allocator<int>(arena2)};
+
+    test_obj1.push_back(1);
+    test_obj2.push_back(2);
+    test_obj2.push_back(3);
+
+    test_obj1.swap(test_obj2);
+    ASSERT_EQ(test_obj1.get_allocator().arena(), &arena2);
+    ASSERT_EQ(test_obj2.get_allocator().arena(), &arena1);
+    ASSERT_EQ(test_obj1.size(), 2u);
+    ASSERT_EQ(test_obj2[0], 1);
+
+    test_obj2 = test_obj1;
+    ASSERT_EQ(test_obj2.get_allocator().arena(), &arena2);
+    ASSERT_EQ(test_obj2[1], 3);
+
+    vector_type test_obj3{arena_allocator<int>(arena1)};
+    test_obj3 = std::move(test_obj1);
+    ASSERT_EQ(test_obj3.get_allocator().arena(), &arena2);
+    ASSERT_EQ(test_obj3.size(), 2u);
+    ASSERT_EQ(test_obj1.size(), 0u);
+
+    vector_type test_obj4(std::move(test_obj3));
+    ASSERT_EQ(test_obj4.get_allocator().arena(), &arena2);
+    ASSERT_EQ(test_obj4[0], 2);
+}
+
+TEST(ArenaAllocatorTest, CheckStack) {
+    arena_t arena;
+
+    using stack_type = atom::stack_t<int, vector_t<int, arena_allocator<int> > >;
+
+    stack_type test_obj{arena_allocator<int>(arena)};
+
+    const int count_insert = 100;
+    for (int i = 0; i < count_insert; ++i) {
+        test_obj.push(i);
+    }
+
+    stack_type test_move(std::move(test_obj));
+    ASSERT_EQ(test_move.size(), static_cast<std::size_t>(count_insert));
+    ASSERT_EQ(test_obj.size(), 0u);
+
+    for (int i = count_insert - 1; i >= 0; --i) {
+        ASSERT_EQ(test_move.top(), i);
+        test_move.pop();
+    }
+}
+
+TEST(StatefulAllocatorTest, CheckMoveAssignment) {
+    int live = 0;
+
+    using vector_type = vector_t<std::string, tagged_allocator_t<std::string> >;
+
+    {
+        vector_type test_obj1{tagged_allocator_t<std::string>(1, &live)};
+        vector_type test_obj2{tagged_allocator_t<std::string>(2, &live)};
+        vector_type test_obj3{tagged_allocator_t<std::string>(1, &live)};
+
+        for (int i = 0; i < 20; ++i) {
+            test_obj1.push_back(std::to_string(i));
+        }
+        ASSERT_EQ(live, 1);
+
+        // Allocators are not equal, elements are moved one by one
+        test_obj2 = std::move(test_obj1);
+        ASSERT_EQ(test_obj2.get_allocator().id, 2);
+        ASSERT_EQ(test_obj2.size(), 20u);
+        ASSERT_EQ(test_obj2[19], "19");
+        ASSERT_EQ(test_obj1.size(), 0u);
+        ASSERT_EQ(live, 1);
+
+        // Allocators are equal, memory is stolen
+        test_obj1.push_back("first");
+        const std::string* data = &test_obj1[0];
+        test_obj3 = std::move(test_obj1);
+        ASSERT_EQ(&test_obj3[0], data);
+        ASSERT_EQ(live, 2);
+
+        test_obj3 = test_obj2;
+        ASSERT_EQ(test_obj3.get_allocator().id, 1);
+        ASSERT_EQ(test_obj3[10], "10");
+        ASSERT_EQ(live, 2);
+    }
+
+    ASSERT_EQ(live, 0);
+}
+
+TEST(StatefulAllocatorTest, CheckVectorBool) {
+    int live = 0;
+
+    using vector_type = vector_t<bool, tagged_allocator_t<bool> >;
+
+    {
+        vector_type test_obj1(100, true, tagged_allocator_t<bool>(1, &live));
+        vector_type test_obj2{tagged_allocator_t<bool>(2, &live)};
+
+        test_obj2 = std::move(test_obj1);
+        ASSERT_EQ(test_obj2.get_allocator().id, 2);
+        ASSERT_EQ(test_obj2.count(), 100u);
+        ASSERT_EQ(test_obj1.size(), 0u);
+        ASSERT_EQ(live, 1);
+    }
+
+    ASSERT_EQ(live, 0);
+}
+
+
+//-----------------------------------------------------------------------------
+//! User type which is opted in to relocation by memcpy()
+//-----------------------------------------------------------------------------
+struct point_t {
+    int    x;
+    double y;
+};
+
+namespace atom {
+    template<>
+    struct is_trivially_relocatable<point_t> : std::true_type {
+    };
+}
+
+std::ostream& operator<<(std::ostream& out, const point_t& point) {
+    return out << point.x << ' ' << point.y;
+}
+
+TEST(ReallocAllocatorTest, CheckTraits) {
+    ASSERT_TRUE(is_trivially_relocatable<double>::value);
+    ASSERT_TRUE(is_trivially_relocatable<point_t>::value);
+    ASSERT_FALSE(is_trivially_relocatable<std::string>::value);
+
+    ASSERT_TRUE(has_reallocate<realloc_allocator<int> >::value);
+    ASSERT_FALSE(has_reallocate<std::allocator<int> >::value);
+
+    ASSERT_TRUE((std::is_same<vector_t<double>::allocator_type, realloc_allocator<double> >::value));
+    ASSERT_TRUE((std::is_same<vector_t<std::string>::allocator_type, std::allocator<std::string> >::value));
+}
+
+TEST(ReallocAllocatorTest, CheckReallocate) {
+    realloc_allocator<long long> alloc;
+
+    const std::size_t small = 16;
+    const std::size_t big   = ATOM_MREMAP_THRESHOLD / sizeof(long long) + 1;
+
+    long long* data = alloc.reallocate(nullptr, 0, small);
+    for (std::size_t i = 0; i < small; ++i) {
+        data[i] = i;
+    }
+
+    // malloc -> mmap -> mremap -> malloc, values must be kept on every step
+    data = alloc.reallocate(data, small, big);
+    data[big - 1] = -1;
+    data = alloc.reallocate(data, big, 4 * big);
+    ASSERT_EQ(data[big - 1], -1);
+    data = alloc.reallocate(data, 4 * big, small);
+
+    for (std::size_t i = 0; i < small; ++i) {
+        ASSERT_EQ(data[i], static_cast<long long>(i));
+    }
+
+    alloc.deallocate(data, small);
+
+    ASSERT_THROW(alloc.allocate(alloc.max_size() + 1), atom::badAlloc);
+}
+
+TEST(ReallocAllocatorTest, CheckVector) {
+    vector_t<double> test_obj;
+
+    const std::size_t count_insert = 2 * ATOM_MREMAP_THRESHOLD / sizeof(double);
+    for (std::size_t i = 0; i < count_insert; ++i) {
+        test_obj.push_back(i);
+    }
+    for (std::size_t i = 0; i < count_insert; i += 997) {
+        ASSERT_DOUBLE_EQ(test_obj[i], i);
+    }
+
+    test_obj.resize(10);
+    ASSERT_EQ(test_obj.size(), 10u);
+    ASSERT_DOUBLE_EQ(test_obj[9], 9.0);
+
+    // Argument refers to the memory which is reallocated
+    vector_t<point_t> test_points;
+    test_points.push_back({1, 0.5});
+    for (int i = 0; i < 100; ++i) {
+        test_points.emplace_back(test_points.back());
+    }
+    ASSERT_EQ(test_points.size(), 101u);
+    ASSERT_EQ(test_points[100].x, 1);
+
+    vector_t<bool> test_bits(3 * ATOM_MREMAP_THRESHOLD, true);
+    test_bits.push_back(false);
+    ASSERT_EQ(test_bits.count(), 3 * ATOM_MREMAP_THRESHOLD);
+}
+
+
+//-----------------------------------------------------------------------------
+//! Opted in type which counts alive objects, relocation must not destroy them
+//-----------------------------------------------------------------------------
+struct relocatable_counted_t {
+    static int alive;
+
+    int value;
+
+    relocatable_counted_t(int x = 0) :
+        value(x) {
+        ++alive;
+    }
+
+    relocatable_counted_t(const relocatable_counted_t& that) :
+        value(that.value) {
+        ++alive;
+    }
+
+    ~relocatable_counted_t() {
+        --alive;
+    }
+};
+
+int relocatable_counted_t::alive = 0;
+
+namespace atom {
+    template<>
+    struct is_trivially_relocatable<relocatable_counted_t> : std::true_type {
+    };
+}
+
+std::ostream& operator<<(std::ostream& out, const relocatable_counted_t& x) {
+    return out << x.value;
+}
+
+TEST(ReallocAllocatorTest, CheckRelocationWithoutReallocate) {
+    arena_t arena;
+
+    // Debug build keeps POISON<relocatable_counted_t>::value alive
+    const int alive = relocatable_counted_t::alive;
+
+    {
+        using vector_type = vector_t<relocatable_counted_t, arena_allocator<relocatable_counted_t> >;
+
+        vector_type test_obj{arena_allocator<relocatable_counted_t>(arena)};
+        for (int i = 0; i < 100; ++i) {
+            test_obj.emplace_back(i);
+        }
+        ASSERT_EQ(relocatable_counted_t::alive, alive + 100);
+
+        test_obj.resize(10);
+        ASSERT_EQ(relocatable_counted_t::alive, alive + 10);
+        ASSERT_EQ(test_obj[9].value, 9);
+
+        vector_type test_move{arena_allocator<relocatable_counted_t>(arena)};
+        test_move = std::move(test_obj);
+        ASSERT_EQ(relocatable_counted_t::alive, alive + 10);
+    }
+
+    ASSERT_EQ(relocatable_counted_t::alive, alive);
+}
+
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
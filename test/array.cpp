@@ -5,6 +5,7 @@
 #include <initializer_list>
 #include <algorithm>
 #include <vector>
+#include <string>
 #include <iostream>
 using namespace atom;
 
@@ -247,6 +248,138 @@ TEST(ArrayMethodTest, CheckSwap) {
     }
 }
 
+TEST(ArrayMethodTest, CheckCopyMoveSwapLive) {
+    // Non trivially copyable elements go through the element-wise path
+    array_t<std::string, 64> test_obj1{"a", "bb", "ccc"};
+    array_t<std::string, 64> test_obj2{"x"};
+
+    test_obj1.swap(test_obj2);
+    ASSERT_EQ(test_obj1.size(), 1u);
+    ASSERT_EQ(test_obj2.size(), 3u);
+    ASSERT_EQ(test_obj1[0], "x");
+    ASSERT_EQ(test_obj2[2], "ccc");
+
+    test_obj2.swap(test_obj1);
+    ASSERT_EQ(test_obj1.size(), 3u);
+    ASSERT_EQ(test_obj1[1], "bb");
+    ASSERT_EQ(test_obj2[0], "x");
+
+    test_obj2 = test_obj1;
+    ASSERT_EQ(test_obj2.size(), 3u);
+    ASSERT_EQ(test_obj2[2], "ccc");
+
+    test_obj2 = array_t<std::string, 64>{"y"};
+    ASSERT_EQ(test_obj2.size(), 1u);
+    ASSERT_EQ(test_obj2[0], "y");
+
+    test_obj2 = test_obj2;
+    ASSERT_EQ(test_obj2[0], "y");
+
+    array_t<std::string, 64> test_obj3(std::move(test_obj1));
+    ASSERT_EQ(test_obj3.size(), 3u);
+    ASSERT_EQ(test_obj3[0], "a");
+    ASSERT_EQ(test_obj1.size(), 0u);
+
+    const array_t<std::string, 64> test_obj4(test_obj3);
+    ASSERT_EQ(test_obj4.size(), 3u);
+    ASSERT_EQ(test_obj4[1], "bb");
+
+    // Trivially copyable elements of the mostly empty array
+    array_t<long long, 4096> test_obj5{1, 2, 3};
+    array_t<long long, 4096> test_obj6(10, 7);
+
+    test_obj6 = test_obj5;
+    ASSERT_EQ(test_obj6.size(), 3u);
+    ASSERT_EQ(test_obj6[2], 3);
+
+    test_obj6.push_back(4);
+    test_obj5.swap(test_obj6);
+    ASSERT_EQ(test_obj5.size(), 4u);
+    ASSERT_EQ(test_obj5[3], 4);
+    ASSERT_EQ(test_obj6.size(), 3u);
+    ASSERT_ANY_THROW(test_obj6[3]);
+}
+
+// Counts objects which are alive
+struct live_counter_t {
+    static int live;
+
+    int value;
+
+    live_counter_t(int x = 0) : value(x) { ++live; }
+    live_counter_t(const live_counter_t& that) : value(that.value) { ++live; }
+    live_counter_t& operator=(const live_counter_t& that) = default;
+    ~live_counter_t() { --live; }
+
+    bool operator==(const live_counter_t& that) const { return value == that.value; }
+    bool operator!=(const live_counter_t& that) const { return value != that.value; }
+};
+
+int live_counter_t::live = 0;
+
+std::ostream& operator<<(std::ostream& out, const live_counter_t& x) {
+    return out << x.value;
+}
+
+TEST(ArrayMethodTest, CheckLiveElements) {
+    // POISON<live_counter_t>::value is alive in debug mode
+    const int before = live_counter_t::live;
+
+    {
+        // Only size() elements are constructed
+        array_t<live_counter_t, 1024> test_obj1;
+        ASSERT_EQ(live_counter_t::live - before, 0);
+
+        test_obj1.push_back(live_counter_t(1));
+        test_obj1.push_back(live_counter_t(2));
+        test_obj1.push_back(live_counter_t(3));
+        ASSERT_EQ(live_counter_t::live - before, 3);
+
+        array_t<live_counter_t, 1024> test_obj2(test_obj1);
+        ASSERT_EQ(live_counter_t::live - before, 6);
+
+        array_t<live_counter_t, 1024> test_obj3(std::move(test_obj2));
+        ASSERT_EQ(live_counter_t::live - before, 6);
+        ASSERT_EQ(test_obj2.size(), 0u);
+
+        test_obj1.erase(0);
+        ASSERT_EQ(live_counter_t::live - before, 5);
+        ASSERT_EQ(test_obj1[0].value, 2);
+
+        test_obj1.erase_unordered(0);
+        ASSERT_EQ(live_counter_t::live - before, 4);
+        ASSERT_EQ(test_obj1[0].value, 3);
+
+        test_obj3.erase_if([](const live_counter_t& x) { return x.value == 2; });
+        ASSERT_EQ(live_counter_t::live - before, 3);
+
+        // Assignment constructs and destroys the difference of the sizes
+        test_obj2 = test_obj3;
+        ASSERT_EQ(live_counter_t::live - before, 5);
+        test_obj3 = test_obj1;
+        ASSERT_EQ(live_counter_t::live - before, 4);
+        ASSERT_EQ(test_obj3[0].value, 3);
+
+        test_obj1.swap(test_obj2);
+        ASSERT_EQ(live_counter_t::live - before, 4);
+        ASSERT_EQ(test_obj1.size(), 2u);
+        ASSERT_EQ(test_obj2[0].value, 3);
+
+        ASSERT_TRUE(test_obj1.use_array(10));
+        ASSERT_EQ(live_counter_t::live - before, 12);
+        ASSERT_TRUE(test_obj1.use_array(1));
+        ASSERT_EQ(live_counter_t::live - before, 3);
+
+        test_obj1.clear();
+        ASSERT_EQ(live_counter_t::live - before, 2);
+
+        const array_t<live_counter_t, 1024> test_obj4(5, live_counter_t(7));
+        ASSERT_EQ(live_counter_t::live - before, 7);
+        ASSERT_EQ(test_obj4[4].value, 7);
+    }
+    ASSERT_EQ(live_counter_t::live - before, 0);
+}
+
 TEST(ArrayMethodTest, CheckErase) {
     array_t<int, 256> test_obj1;
 
@@ -271,6 +404,40 @@ TEST(ArrayMethodTest, CheckErase) {
     ASSERT_EQ(test_obj1.size(), size_test_obj1 - 2);
 }
 
+TEST(ArrayMethodTest, CheckEraseUnordered) {
+    array_t<int, 16> test_obj1 = {0, 1, 2, 3, 4};
+
+    ASSERT_FALSE(test_obj1.erase_unordered(5));
+
+    ASSERT_TRUE(test_obj1.erase_unordered(1));
+    ASSERT_EQ(test_obj1.size(), 4u);
+    ASSERT_EQ(test_obj1[1], 4);
+    ASSERT_EQ(test_obj1[3], 3);
+
+    ASSERT_TRUE(test_obj1.erase_unordered(3));
+    ASSERT_EQ(test_obj1.size(), 3u);
+    ASSERT_EQ(test_obj1.back(), 2);
+}
+
+TEST(ArrayMethodTest, CheckEraseIf) {
+    array_t<int, 64> test_obj1;
+    for (int i = 0; i < 50; ++i) {
+        test_obj1.push_back(i);
+    }
+
+    ASSERT_EQ(test_obj1.erase_if([](int x) { return x % 3 == 0; }), 17u);
+    ASSERT_EQ(test_obj1.size(), 33u);
+    for (size_t i = 0; i < test_obj1.size(); ++i) {
+        ASSERT_NE(test_obj1[i] % 3, 0);
+    }
+    ASSERT_EQ(test_obj1[0], 1);
+    ASSERT_EQ(test_obj1[2], 4);
+
+    ASSERT_EQ(test_obj1.erase_if([](int) { return false; }), 0u);
+    ASSERT_EQ(test_obj1.erase_if([](int) { return true; }), 33u);
+    ASSERT_TRUE(test_obj1.empty());
+}
+
 TEST(ArrayMethodTest, CheckClear) {
     array_t<int, 480> test_obj1;
     test_obj1.clear();
@@ -754,8 +921,145 @@ TEST(ArrayBoolMethodTest, CheckCount) {
 
     array_t<bool, 4000> test_obj2;
     ASSERT_EQ(test_obj2.count(), 0u);
+
+    // Size is equal to the capacity which is a multiple of the block
+    array_t<bool, 256> test_obj3(256, true);
+    ASSERT_EQ(test_obj3.count(), 256u);
+
+    test_obj3.use_array(70);
+    ASSERT_EQ(test_obj3.count(), 70u);
+}
+
+TEST(ArrayBoolMethodTest, CheckEraseInsert) {
+    array_t<bool, 1000> test_obj1;
+    std::vector<bool>   expected;
+
+    unsigned int seed = 3;
+    for (size_t i = 0; i < 700; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        test_obj1.push_back((seed >> 8) % 2 == 0);
+        expected.push_back((seed >> 8) % 2 == 0);
+    }
+
+    ASSERT_TRUE(test_obj1.erase(10, 150));
+    expected.erase(expected.begin() + 10, expected.begin() + 150);
+    ASSERT_TRUE(test_obj1.erase(64));
+    expected.erase(expected.begin() + 64);
+
+    test_obj1.insert(3, 400, true);
+    expected.insert(expected.begin() + 3, 400, true);
+    test_obj1.insert(128, false);
+    expected.insert(expected.begin() + 128, false);
+
+    ASSERT_EQ(test_obj1.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(test_obj1[i], expected[i]);
+    }
+
+    ASSERT_THROW(test_obj1.insert(0, 1000 - expected.size() + 1, true), atom::badAlloc);
+    ASSERT_NO_THROW(test_obj1.insert(0, 1000 - expected.size(), false));
+    ASSERT_EQ(test_obj1.size(), 1000u);
+}
+
+TEST(ArrayBoolMethodTest, CheckFindSetBits) {
+    array_t<bool, 1000> test_obj1(1000, false);
+    std::vector<size_t> positions = {1, 64, 65, 500, 999};
+    for (size_t pos : positions) {
+        test_obj1.set(pos);
+    }
+
+    ASSERT_EQ(test_obj1.find_first(), 1u);
+    ASSERT_EQ(test_obj1.find_next(1), 64u);
+    ASSERT_EQ(test_obj1.find_next(65), 500u);
+    ASSERT_EQ(test_obj1.find_next(999), 1000u);
+    ASSERT_EQ(test_obj1.find_prev(500), 65u);
+    ASSERT_EQ(test_obj1.find_prev(1), 1000u);
+    ASSERT_EQ(test_obj1.find_prev(1000), 999u);
+
+    std::vector<size_t> visited;
+    test_obj1.for_each_set([&visited](size_t pos) { visited.push_back(pos); });
+    ASSERT_EQ(visited, positions);
+
+    visited.clear();
+    for (size_t pos : test_obj1.set_bits()) {
+        visited.push_back(pos);
+    }
+    ASSERT_EQ(visited, positions);
+
+    // Bits behind size are not visited
+    test_obj1.use_array(600);
+    visited.clear();
+    for (size_t pos : test_obj1.set_bits()) {
+        visited.push_back(pos);
+    }
+    ASSERT_EQ(visited, std::vector<size_t>({1, 64, 65, 500}));
+    ASSERT_EQ(test_obj1.find_next(500), 600u);
+
+    array_t<bool, 64> test_empty;
+    ASSERT_EQ(test_empty.find_first(), 0u);
+    ASSERT_TRUE(test_empty.set_bits().begin() == test_empty.set_bits().end());
+}
+
+
+// Tables which are built at compile time
+constexpr array_t<bool, 256> make_digit_table() {
+    array_t<bool, 256> result(256, false);
+    for (char c = '0'; c <= '9'; ++c) {
+        result.set(static_cast<unsigned char>(c));
+    }
+    return result;
+}
+
+constexpr array_t<bool, 100> make_bits() {
+    array_t<bool, 100> result;
+    for (int i = 0; i < 70; ++i) {
+        result.push_back(i % 3 == 0);
+    }
+    result.reset(3);
+    result.flip(4);
+    return result;
+}
+
+constexpr int square(const std::size_t i) {
+    return static_cast<int>(i * i);
 }
 
+constexpr array_t<int, 8>   CONSTEXPR_POWERS  = {1, 2, 4, 8, 16};
+constexpr array_t<int, 8>   CONSTEXPR_SQUARES = array_t<int, 8>::generate(6, square);
+constexpr array_t<char, 64> CONSTEXPR_FILLED(10, 'x');
+constexpr array_t<bool, 256> CONSTEXPR_DIGITS = make_digit_table();
+constexpr array_t<bool, 100> CONSTEXPR_BITS   = make_bits();
+
+static_assert(div_ceil(0, 64) == 0 && div_ceil(64, 64) == 1 && div_ceil(65, 64) == 2, "div_ceil");
+static_assert(div_ceil(~std::size_t(0), 2) == std::size_t(1) << 63, "div_ceil is exact for big values");
+
+static_assert(CONSTEXPR_POWERS.size() == 5 && CONSTEXPR_POWERS[4] == 16 && CONSTEXPR_POWERS.back() == 16, "powers");
+static_assert(CONSTEXPR_SQUARES.size() == 6 && CONSTEXPR_SQUARES[5] == 25, "squares");
+static_assert(CONSTEXPR_FILLED.size() == 10 && CONSTEXPR_FILLED.front() == 'x', "filled");
+static_assert(CONSTEXPR_DIGITS['7'] && !CONSTEXPR_DIGITS['a'] && CONSTEXPR_DIGITS.find_first() == '0', "digits");
+static_assert(CONSTEXPR_BITS.size() == 70 && CONSTEXPR_BITS[0] && !CONSTEXPR_BITS[3] && CONSTEXPR_BITS[4], "bits");
+static_assert(CONSTEXPR_BITS.find_next(4) == 6 && CONSTEXPR_BITS.find_prev(70) == 69, "bits search");
+
+TEST(ArrayConstexprTest, CheckTables) {
+    // The same tables at run time
+    const array_t<int, 8> test_obj1 = array_t<int, 8>::generate(6, square);
+    ASSERT_EQ(test_obj1.size(), CONSTEXPR_SQUARES.size());
+    for (size_t i = 0; i < test_obj1.size(); ++i) {
+        ASSERT_EQ(test_obj1[i], CONSTEXPR_SQUARES[i]);
+    }
+
+    const array_t<bool, 256> test_obj2 = make_digit_table();
+    ASSERT_EQ(test_obj2.count(), 10u);
+    ASSERT_EQ(CONSTEXPR_DIGITS.count(), 10u);
+
+    array_t<std::string, 4> test_obj3 = array_t<std::string, 4>::generate(3, [](size_t i) {
+        return std::string(i, 'a');
+    });
+    ASSERT_EQ(test_obj3.size(), 3u);
+    ASSERT_EQ(test_obj3[2], "aa");
+
+    ASSERT_THROW((array_t<int, 8>::generate(9, square)), atom::badAlloc);
+}
 
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
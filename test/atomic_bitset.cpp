@@ -0,0 +1,123 @@
+//#define ATOM_NDEBUG
+#include "atomic_bitset/atomic_bitset.h"
+#include "vector/vector.h"
+#include "exceptions.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace atom;
+
+
+TEST(AtomicBitsetTest, CheckSetReset) {
+    atomic_bitset_t test_obj1(130);
+    ASSERT_EQ(test_obj1.size(), 130u);
+    ASSERT_EQ(test_obj1.count_blocks(), 3u);
+    ASSERT_EQ(test_obj1.count(), 0u);
+
+    ASSERT_FALSE(test_obj1.test_and_set(5));
+    ASSERT_TRUE(test_obj1.test_and_set(5));
+    test_obj1.set(64);
+    test_obj1.set(129, std::memory_order_relaxed);
+    ASSERT_TRUE(test_obj1.test(5));
+    ASSERT_TRUE(test_obj1.test(64, std::memory_order_acquire));
+    ASSERT_TRUE(test_obj1.test(129));
+    ASSERT_FALSE(test_obj1.test(6));
+    ASSERT_EQ(test_obj1.count(), 3u);
+
+    test_obj1.reset(64);
+    test_obj1.reset(63);
+    ASSERT_FALSE(test_obj1.test(64));
+    ASSERT_EQ(test_obj1.count(), 2u);
+
+    // Bits behind the size are ignored
+    ASSERT_EQ(test_obj1.fetch_or_block(2, ~bit_container_type(0)), 2u);
+    ASSERT_EQ(test_obj1.fetch_or_block(2, 0), 3u);
+    ASSERT_EQ(test_obj1.fetch_or_block(0, 0xF0), ONE << 5);
+    ASSERT_EQ(test_obj1.count(), 6u);
+
+    ASSERT_THROW(test_obj1.test(130), atom::outOfRange);
+    ASSERT_THROW(test_obj1.set(130), atom::outOfRange);
+    ASSERT_THROW(test_obj1.reset(130), atom::outOfRange);
+    ASSERT_THROW(test_obj1.fetch_or_block(3, 1), atom::outOfRange);
+}
+
+TEST(AtomicBitsetTest, CheckConcurrentMarking) {
+    const size_t             size          = 100000;
+    const unsigned int       count_threads = 4;
+    atomic_bitset_t          test_obj1(size);
+    std::atomic<size_t>      first_marks(0);
+    std::vector<std::thread> threads;
+
+    // Every thread marks all positions divisible by 3 or by its own step, bits of a block are shared
+    for (unsigned int t = 0; t < count_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            size_t marks = 0;
+            for (size_t pos = 0; pos < size; ++pos) {
+                if ((pos % 3 == 0 || pos % (t + 5) == 0) && !test_obj1.test_and_set(pos, std::memory_order_relaxed)) {
+                    ++marks;
+                }
+            }
+            first_marks += marks;
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    size_t expected = 0;
+    for (size_t pos = 0; pos < size; ++pos) {
+        bool marked = pos % 3 == 0;
+        for (unsigned int t = 0; t < count_threads; ++t) {
+            marked = marked || pos % (t + 5) == 0;
+        }
+        expected += marked;
+        ASSERT_EQ(test_obj1.test(pos), marked);
+    }
+
+    ASSERT_EQ(first_marks.load(), expected);
+    ASSERT_EQ(test_obj1.count(), expected);
+
+    const vector_t<bool>& view = test_obj1.bits();
+    ASSERT_EQ(view.size(), size);
+    ASSERT_EQ(view.count(), expected);
+    ASSERT_TRUE(view[0]);
+    ASSERT_FALSE(view[1]);
+
+    const bit_container_type* data = view.data();
+    vector_t<bool>            bits = test_obj1.release();
+    ASSERT_EQ(bits.data(), data);
+    ASSERT_EQ(bits.count(), expected);
+    ASSERT_EQ(test_obj1.size(), 0u);
+}
+
+TEST(AtomicBitsetTest, CheckConcurrentBlocks) {
+    atomic_bitset_t          test_obj1(64 * 100);
+    std::vector<std::thread> threads;
+
+    // Each thread owns one bit of every block
+    for (unsigned int t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t]() {
+            for (size_t block = 0; block < test_obj1.count_blocks(); ++block) {
+                test_obj1.fetch_or_block(block, ONE << (t * 8));
+                test_obj1.set(block * 64 + t * 8 + 1);
+                test_obj1.reset(block * 64 + t * 8);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(test_obj1.count(), 800u);
+    for (size_t block = 0; block < test_obj1.count_blocks(); ++block) {
+        ASSERT_EQ(test_obj1.bits().data()[block], 0x0202020202020202ULL);
+    }
+}
+
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
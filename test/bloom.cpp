@@ -0,0 +1,178 @@
+//#define ATOM_NDEBUG
+#include "bloom/bloom.h"
+#include "vector/vector.h"
+#include "exceptions.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace atom;
+
+
+static std::vector<std::uint64_t> hashes_of(const std::uint64_t first, const std::size_t n) {
+    std::vector<std::uint64_t> result(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        result[i] = bloom_filter_t::hash(first + i);
+    }
+    return result;
+}
+
+static double false_positive_rate(const bloom_filter_t& filter, const std::vector<std::uint64_t>& absent) {
+    std::size_t count = 0;
+    for (std::uint64_t hash : absent) {
+        count += filter.contains(hash);
+    }
+    return static_cast<double>(count) / absent.size();
+}
+
+TEST(BloomTest, CheckConstructor) {
+    const bloom_filter_t test_obj1(1000, 7);
+    ASSERT_EQ(test_obj1.size(), 1024u);
+    ASSERT_EQ(test_obj1.k(), 7u);
+    ASSERT_EQ(test_obj1.bits().count(), 0u);
+
+    const bloom_filter_t test_obj2 = bloom_filter_t::with_capacity(10000, 0.01);
+    ASSERT_EQ(test_obj2.k(), 7u);
+    ASSERT_EQ(test_obj2.size() % bloom_filter_t::BLOCK_BITS, 0u);
+
+    ASSERT_THROW(bloom_filter_t(0, 3), atom::invalidArgument);
+    ASSERT_THROW(bloom_filter_t(100, 0), atom::invalidArgument);
+    ASSERT_THROW(bloom_filter_t(100, bloom_filter_t::MAX_PROBES + 1), atom::invalidArgument);
+    ASSERT_THROW(bloom_filter_t::with_capacity(0, 0.01), atom::invalidArgument);
+    ASSERT_THROW(bloom_filter_t::with_capacity(10, 1.0), atom::invalidArgument);
+    ASSERT_THROW(bloom_filter_t::with_capacity(10, 0.0), atom::invalidArgument);
+}
+
+TEST(BloomTest, CheckFalsePositives) {
+    for (double rate : {0.05, 0.01, 0.001}) {
+        bloom_filter_t                   test_obj1 = bloom_filter_t::with_capacity(50000, rate);
+        const std::vector<std::uint64_t> present   = hashes_of(0, 50000);
+        const std::vector<std::uint64_t> absent    = hashes_of(1000000, 200000);
+
+        for (std::uint64_t hash : present) {
+            test_obj1.insert(hash);
+        }
+
+        // No false negatives
+        for (std::uint64_t hash : present) {
+            ASSERT_TRUE(test_obj1.contains(hash));
+        }
+        ASSERT_LT(false_positive_rate(test_obj1, absent), rate * 1.2);
+    }
+
+    bloom_filter_t test_obj2(1 << 16, 5);
+    test_obj2.insert(bloom_filter_t::hash(std::string("key")));
+    ASSERT_TRUE(test_obj2.contains(bloom_filter_t::hash(std::string("key"))));
+    ASSERT_FALSE(test_obj2.contains(bloom_filter_t::hash(std::string("other key"))));
+}
+
+TEST(BloomTest, CheckBatch) {
+    bloom_filter_t                   test_obj1(1 << 14, 4);
+    const std::vector<std::uint64_t> present = hashes_of(0, 1500);
+    for (std::uint64_t hash : present) {
+        test_obj1.insert(hash);
+    }
+
+    // Present and absent keys mixed, the count is not a multiple of the block of the result
+    const std::vector<std::uint64_t> keys = hashes_of(1000, 1001);
+    vector_t<bool>                   result;
+    test_obj1.contains(keys.data(), keys.size(), result);
+
+    ASSERT_EQ(result.size(), keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        ASSERT_EQ(result[i], test_obj1.contains(keys[i]));
+    }
+    for (std::size_t i = 0; i < 500; ++i) {
+        ASSERT_TRUE(result[i]);
+    }
+
+    test_obj1.contains(keys.data(), 3, result);
+    ASSERT_EQ(result.size(), 3u);
+    test_obj1.contains(keys.data(), 0, result);
+    ASSERT_EQ(result.size(), 0u);
+}
+
+TEST(BloomTest, CheckMergeSerialize) {
+    bloom_filter_t                   test_obj1(1 << 14, 6);
+    bloom_filter_t                   test_obj2(1 << 14, 6);
+    const std::vector<std::uint64_t> left  = hashes_of(0, 700);
+    const std::vector<std::uint64_t> right = hashes_of(5000, 700);
+
+    for (std::size_t i = 0; i < left.size(); ++i) {
+        test_obj1.insert(left[i]);
+        test_obj2.insert(right[i]);
+    }
+
+    test_obj1 |= test_obj2;
+    for (std::size_t i = 0; i < left.size(); ++i) {
+        ASSERT_TRUE(test_obj1.contains(left[i]));
+        ASSERT_TRUE(test_obj1.contains(right[i]));
+    }
+    ASSERT_THROW(test_obj1 |= bloom_filter_t(1 << 14, 5), atom::invalidArgument);
+    ASSERT_THROW(test_obj1 |= bloom_filter_t(1 << 15, 6), atom::invalidArgument);
+
+    std::stringstream stream;
+    test_obj1.write(stream);
+
+    const bloom_filter_t test_obj3 = bloom_filter_t::read(stream);
+    ASSERT_EQ(test_obj3.size(), test_obj1.size());
+    ASSERT_EQ(test_obj3.k(), test_obj1.k());
+    ASSERT_EQ(xor_count(test_obj3.bits(), test_obj1.bits()), 0u);
+
+    // Truncated and empty streams
+    std::string       data = stream.str();
+    std::stringstream truncated(data.substr(0, data.size() - 1));
+    ASSERT_THROW(bloom_filter_t::read(truncated), atom::badStream);
+
+    std::stringstream empty;
+    ASSERT_THROW(bloom_filter_t::read(empty), atom::badStream);
+}
+
+TEST(BloomTest, CheckCounting) {
+    counting_bloom_filter_t          test_obj1(1 << 14, 5);
+    const std::vector<std::uint64_t> keys = hashes_of(0, 1000);
+
+    ASSERT_EQ(test_obj1.size(), 1u << 14);
+    ASSERT_EQ(test_obj1.k(), 5u);
+
+    for (std::uint64_t hash : keys) {
+        test_obj1.insert(hash);
+    }
+    for (std::uint64_t hash : keys) {
+        ASSERT_TRUE(test_obj1.contains(hash));
+    }
+
+    // Erased half is mostly gone, the other half stays
+    std::size_t still_found = 0;
+    for (std::size_t i = 0; i < 500; ++i) {
+        ASSERT_TRUE(test_obj1.erase(keys[i]));
+    }
+    for (std::size_t i = 0; i < 500; ++i) {
+        still_found += test_obj1.contains(keys[i]);
+    }
+    for (std::size_t i = 500; i < keys.size(); ++i) {
+        ASSERT_TRUE(test_obj1.contains(keys[i]));
+    }
+    ASSERT_LT(still_found, 25u);
+
+    // Saturated counters are kept, the key is not lost by other erases
+    counting_bloom_filter_t test_obj2(128, 3);
+    for (int i = 0; i < 20; ++i) {
+        test_obj2.insert(keys[0]);
+    }
+    for (int i = 0; i < 20; ++i) {
+        test_obj2.erase(keys[0]);
+    }
+    ASSERT_TRUE(test_obj2.contains(keys[0]));
+
+    ASSERT_THROW(counting_bloom_filter_t(0, 3), atom::invalidArgument);
+    ASSERT_THROW(counting_bloom_filter_t(10, 17), atom::invalidArgument);
+}
+
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,120 @@
+//#define ATOM_NDEBUG
+#include "hierarchical_bitset/hierarchical_bitset.h"
+#include "vector/vector.h"
+#include "exceptions.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+
+using namespace atom;
+
+
+static void check_same(const hierarchical_bitset_t& test_obj, const vector_t<bool>& expected) {
+    ASSERT_EQ(test_obj.count(), expected.count());
+    ASSERT_EQ(test_obj.none(), expected.count() == 0);
+
+    std::size_t pos = test_obj.find_first();
+    ASSERT_EQ(pos, expected.find_first());
+
+    while (pos < test_obj.size()) {
+        ASSERT_TRUE(expected[pos]);
+        ASSERT_EQ(test_obj.find_next(pos), expected.find_next(pos));
+        pos = test_obj.find_next(pos);
+    }
+}
+
+TEST(HierarchicalBitsetTest, CheckConstructor) {
+    const hierarchical_bitset_t test_obj1(64);
+    ASSERT_EQ(test_obj1.size(), 64u);
+    ASSERT_EQ(test_obj1.count_levels(), 1u);
+    ASSERT_TRUE(test_obj1.none());
+    ASSERT_EQ(test_obj1.find_first(), 64u);
+
+    ASSERT_EQ(hierarchical_bitset_t(65).count_levels(), 2u);
+    ASSERT_EQ(hierarchical_bitset_t(64 * 64).count_levels(), 2u);
+    ASSERT_EQ(hierarchical_bitset_t(64 * 64 + 1).count_levels(), 3u);
+    ASSERT_EQ(hierarchical_bitset_t(1 << 24).count_levels(), 4u);
+
+    // The top level is longer than one block when the summaries are over
+    const hierarchical_bitset_t test_obj2((1 << 24) + 1);
+    ASSERT_EQ(test_obj2.count_levels(), hierarchical_bitset_t::MAX_SUMMARIES + 1);
+    ASSERT_EQ(test_obj2.find_first(), test_obj2.size());
+
+    const hierarchical_bitset_t test_obj3(0);
+    ASSERT_EQ(test_obj3.find_first(), 0u);
+    ASSERT_EQ(test_obj3.find_next(0), 0u);
+}
+
+TEST(HierarchicalBitsetTest, CheckSetReset) {
+    hierarchical_bitset_t test_obj1(1000);
+
+    test_obj1.set(0);
+    test_obj1.set(999);
+    test_obj1.set(500);
+    test_obj1.set(500);
+    ASSERT_TRUE(test_obj1.test(0));
+    ASSERT_TRUE(test_obj1[500]);
+    ASSERT_FALSE(test_obj1[501]);
+    ASSERT_EQ(test_obj1.count(), 3u);
+
+    ASSERT_EQ(test_obj1.find_first(), 0u);
+    ASSERT_EQ(test_obj1.find_next(0), 500u);
+    ASSERT_EQ(test_obj1.find_next(500), 999u);
+    ASSERT_EQ(test_obj1.find_next(999), 1000u);
+    ASSERT_EQ(test_obj1.find_next(5000), 1000u);
+
+    // Reset of the last bit of the block clears the summary
+    test_obj1.reset(500);
+    test_obj1.reset(500);
+    ASSERT_EQ(test_obj1.find_next(0), 999u);
+    test_obj1.reset(0);
+    test_obj1.reset(999);
+    ASSERT_TRUE(test_obj1.none());
+    ASSERT_EQ(test_obj1.find_first(), 1000u);
+
+    ASSERT_THROW(test_obj1.set(1000), atom::outOfRange);
+    ASSERT_THROW(test_obj1.reset(1000), atom::outOfRange);
+    ASSERT_THROW(test_obj1.test(1000), atom::outOfRange);
+}
+
+TEST(HierarchicalBitsetTest, CheckRandom) {
+    std::mt19937_64 gen(7);
+
+    for (std::size_t size : {std::size_t(1), std::size_t(63), std::size_t(4097),
+                             std::size_t(300000), std::size_t((1 << 24) + 100)}) {
+        hierarchical_bitset_t test_obj1(size);
+        vector_t<bool>        expected(size, false);
+
+        // Sparse bits, then half of them are reset
+        const std::size_t count = size / 1000 + 3;
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::size_t pos = gen() % size;
+            test_obj1.set(pos);
+            expected.set(pos);
+        }
+        check_same(test_obj1, expected);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::size_t pos = gen() % size;
+            if (i % 2) {
+                test_obj1.reset(pos);
+                expected.reset(pos);
+            }
+            else {
+                test_obj1.set(pos);
+                expected.set(pos);
+            }
+        }
+        check_same(test_obj1, expected);
+
+        test_obj1.set(size - 1);
+        expected.set(size - 1);
+        check_same(test_obj1, expected);
+    }
+}
+
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,128 @@
+//#define ATOM_NDEBUG
+#include "mpmc_queue/mpmc_queue.h"
+#include "exceptions.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace atom;
+
+
+TEST(MpmcQueueTest, CheckPushPop) {
+    mpmc_queue_t<int, 4> test_obj1;
+
+    ASSERT_EQ(test_obj1.capacity(), 4u);
+    ASSERT_TRUE(test_obj1.empty());
+
+    int value = 0;
+    ASSERT_FALSE(test_obj1.try_pop(value));
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(test_obj1.try_push(i));
+    }
+    ASSERT_FALSE(test_obj1.try_push(4));
+    ASSERT_THROW(test_obj1.push(4), atom::badAlloc);
+    ASSERT_EQ(test_obj1.size(), 4u);
+
+    // Sequences of the slots pass many laps
+    for (int i = 4; i < 100; ++i) {
+        ASSERT_TRUE(test_obj1.try_pop(value));
+        ASSERT_EQ(value, i - 4);
+        test_obj1.push(i);
+    }
+
+    for (int i = 96; i < 100; ++i) {
+        ASSERT_TRUE(test_obj1.try_pop(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_FALSE(test_obj1.try_pop(value));
+    ASSERT_TRUE(test_obj1.empty());
+}
+
+TEST(MpmcQueueTest, CheckNotTrivial) {
+    auto test_obj1 = std::make_unique<mpmc_queue_t<std::string, 4> >();
+
+    std::string text(40, 'x');
+    ASSERT_TRUE(test_obj1->try_push(text));
+    ASSERT_TRUE(test_obj1->try_push(std::move(text)));
+    ASSERT_TRUE(text.empty());
+
+    test_obj1->push("a");
+    test_obj1->push(std::string(30, 'b'));
+
+    // The full queue does not move from the argument
+    std::string rest(50, 'c');
+    ASSERT_FALSE(test_obj1->try_push(std::move(rest)));
+    ASSERT_EQ(rest.size(), 50u);
+
+    std::string out;
+    ASSERT_TRUE(test_obj1->try_pop(out));
+    ASSERT_EQ(out, std::string(40, 'x'));
+    ASSERT_TRUE(test_obj1->try_pop(out));
+    ASSERT_EQ(out, std::string(40, 'x'));
+    ASSERT_TRUE(test_obj1->try_pop(out));
+    ASSERT_EQ(out, "a");
+
+    // The rest is destroyed by the destructor
+    test_obj1.reset();
+}
+
+TEST(MpmcQueueTest, CheckThreads) {
+    const std::uint64_t count_threads = 4;
+    const std::uint64_t count         = 1 << 16;
+    auto                test_obj1     = std::make_unique<mpmc_queue_t<std::uint64_t, 64> >();
+
+    // Element is (producer << 32) | index, each consumer sees the indices of a producer in order
+    std::vector<std::thread>   threads;
+    std::vector<std::uint64_t> sums(count_threads, 0);
+    std::vector<int>           in_order(count_threads, 1);
+
+    for (std::uint64_t id = 0; id < count_threads; ++id) {
+        threads.emplace_back([&, id]() {
+            for (std::uint64_t i = 0; i < count; ++i) {
+                while (!test_obj1->try_push(id << 32 | i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        threads.emplace_back([&, id]() {
+            std::vector<std::uint64_t> last(count_threads, 0);
+            std::uint64_t              value = 0;
+
+            for (std::uint64_t i = 0; i < count; ++i) {
+                while (!test_obj1->try_pop(value)) {
+                    std::this_thread::yield();
+                }
+
+                const std::uint64_t producer = value >> 32;
+                const std::uint64_t index    = (value & 0xFFFFFFFFu) + 1;
+
+                in_order[id] = in_order[id] && index > last[producer];
+                last[producer] = index;
+                sums[id] += index - 1;
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::uint64_t sum = 0;
+    for (std::uint64_t id = 0; id < count_threads; ++id) {
+        ASSERT_TRUE(in_order[id]);
+        sum += sums[id];
+    }
+    ASSERT_EQ(sum, count_threads * count * (count - 1) / 2);
+    ASSERT_TRUE(test_obj1->empty());
+}
+
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
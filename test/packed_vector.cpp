@@ -0,0 +1,127 @@
+//#define ATOM_NDEBUG
+#include "packed_vector/packed_vector.h"
+#include "vector/vector.h"
+#include "exceptions.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+using namespace atom;
+
+
+static std::vector<std::uint32_t> random_values(const std::size_t n, const unsigned int width, unsigned int seed) {
+    const std::uint32_t        mask = static_cast<std::uint32_t>((1ULL << width) - 1);
+    std::vector<std::uint32_t> result(n);
+
+    for (std::uint32_t& x : result) {
+        seed = seed * 1103515245u + 12345u;
+        x    = (seed ^ seed >> 16) & mask;
+    }
+    return result;
+}
+
+template<unsigned int Bits>
+static void check_width(const unsigned int width) {
+    packed_vector_t<Bits> test_obj1(width);
+    ASSERT_EQ(test_obj1.width(), width);
+    ASSERT_TRUE(test_obj1.empty());
+
+    const std::vector<std::uint32_t> expected = random_values(1000, width, width);
+    for (std::uint32_t x : expected) {
+        test_obj1.push_back(x);
+    }
+
+    ASSERT_EQ(test_obj1.size(), expected.size());
+    ASSERT_LE(test_obj1.memory_usage(), (expected.size() * width / 8 + 8) * 2);
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(test_obj1[i], expected[i]);
+    }
+
+    // Changes must not touch the neighbours, fields cross the blocks
+    std::vector<std::uint32_t> changed = expected;
+    for (std::size_t i = 0; i < changed.size(); i += 3) {
+        changed[i] = test_obj1.max_value() - changed[i];
+        test_obj1.set(i, changed[i]);
+    }
+    for (std::size_t i = 0; i < changed.size(); ++i) {
+        ASSERT_EQ(test_obj1.get(i), changed[i]);
+    }
+
+    vector_t<std::uint32_t> out;
+    test_obj1.unpack(out);
+    ASSERT_EQ(out.size(), changed.size());
+    for (std::size_t i = 0; i < changed.size(); ++i) {
+        ASSERT_EQ(out[i], changed[i]);
+    }
+
+    test_obj1.unpack(13, 500, out);
+    ASSERT_EQ(out.size(), 500u);
+    for (std::size_t i = 0; i < 500; ++i) {
+        ASSERT_EQ(out[i], changed[13 + i]);
+    }
+
+    if (width < 32) {
+        ASSERT_THROW(test_obj1.push_back(test_obj1.max_value() + 1), atom::invalidArgument);
+        ASSERT_THROW(test_obj1.set(0, test_obj1.max_value() + 1), atom::invalidArgument);
+    }
+    ASSERT_THROW(test_obj1.get(changed.size()), atom::outOfRange);
+    ASSERT_THROW(test_obj1.set(changed.size(), 0), atom::outOfRange);
+    ASSERT_THROW(test_obj1.unpack(999, 2, out), atom::outOfRange);
+}
+
+TEST(PackedVectorTest, CheckConstructor) {
+    packed_vector_t<5> test_obj1;
+    ASSERT_EQ(test_obj1.width(), 5u);
+    ASSERT_EQ(test_obj1.max_value(), 31u);
+    ASSERT_EQ(test_obj1.size(), 0u);
+
+    packed_vector_t<> test_obj2(32);
+    ASSERT_EQ(test_obj2.max_value(), 0xFFFFFFFFu);
+
+    ASSERT_THROW(packed_vector_t<>(), atom::invalidArgument);
+    ASSERT_THROW(packed_vector_t<>(33), atom::invalidArgument);
+    ASSERT_THROW(packed_vector_t<5>(6), atom::invalidArgument);
+}
+
+TEST(PackedVectorTest, CheckStaticWidth) {
+    check_width<1>(1);
+    check_width<3>(3);
+    check_width<7>(7);
+    check_width<20>(20);
+    check_width<32>(32);
+}
+
+TEST(PackedVectorTest, CheckDynamicWidth) {
+    for (unsigned int width = 1; width <= 32; ++width) {
+        check_width<0>(width);
+    }
+}
+
+TEST(PackedVectorTest, CheckCopyClear) {
+    packed_vector_t<> test_obj1(11);
+    for (std::uint32_t x = 0; x < 300; ++x) {
+        test_obj1.push_back(x * 7 % 2048);
+    }
+
+    packed_vector_t<> test_obj2 = test_obj1;
+    test_obj1.clear();
+    ASSERT_TRUE(test_obj1.empty());
+    ASSERT_EQ(test_obj1.memory_usage(), 0u);
+
+    ASSERT_EQ(test_obj2.size(), 300u);
+    ASSERT_EQ(test_obj2.width(), 11u);
+    for (std::uint32_t x = 0; x < 300; ++x) {
+        ASSERT_EQ(test_obj2[x], x * 7 % 2048);
+    }
+
+    test_obj1.reserve(1000);
+    ASSERT_GE(test_obj1.memory_usage(), 1000u * 11 / 8);
+    test_obj1.push_back(5);
+    ASSERT_EQ(test_obj1[0], 5u);
+}
+
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
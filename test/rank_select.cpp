@@ -0,0 +1,142 @@
+//#define ATOM_NDEBUG
+#include "rank_select/rank_select.h"
+#include "vector/vector.h"
+#include "array/array.h"
+#include "exceptions.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace atom;
+
+
+// Every bit is set with probability 1 / period
+static vector_t<bool> random_bits(const size_t size, const unsigned int period, unsigned int seed) {
+    vector_t<bool> bits(size, false);
+    for (size_t i = 0; i < size; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        if ((seed >> 8) % period == 0) {
+            bits.set(i);
+        }
+    }
+    return bits;
+}
+
+static void check_index(const vector_t<bool>& bits, const rank_select_index<>& index) {
+    ASSERT_EQ(index.size(), bits.size());
+
+    size_t rank = 0;
+    for (size_t pos = 0; pos < bits.size(); ++pos) {
+        ASSERT_EQ(index.rank(pos), rank);
+        if (bits[pos]) {
+            ASSERT_EQ(index.select(rank), pos);
+            ++rank;
+        }
+    }
+
+    ASSERT_EQ(index.rank(bits.size()), rank);
+    ASSERT_EQ(index.count(), rank);
+    ASSERT_EQ(index.count(), bits.count());
+}
+
+TEST(RankSelectTest, CheckDense) {
+    for (size_t size : {0u, 1u, 63u, 64u, 511u, 512u, 2047u, 2048u, 2049u, 10000u}) {
+        const vector_t<bool> bits = random_bits(size, 2, static_cast<unsigned int>(size));
+        rank_select_index<>  index(bits);
+
+        check_index(bits, index);
+    }
+
+    const vector_t<bool> ones(5000, true);
+    rank_select_index<>  index(ones);
+    check_index(ones, index);
+    ASSERT_EQ(index.select(4999), 4999u);
+}
+
+TEST(RankSelectTest, CheckSparse) {
+    // Samples of select are far from each other
+    const vector_t<bool> bits = random_bits(300000, 1000, 17);
+    rank_select_index<>  index(bits);
+    check_index(bits, index);
+
+    vector_t<bool> single(100000, false);
+    single.set(77777);
+    rank_select_index<> single_index(single);
+    ASSERT_EQ(single_index.count(), 1u);
+    ASSERT_EQ(single_index.select(0), 77777u);
+    ASSERT_EQ(single_index.rank(77777), 0u);
+    ASSERT_EQ(single_index.rank(77778), 1u);
+
+    const vector_t<bool> zeros(10000, false);
+    rank_select_index<>  zeros_index(zeros);
+    ASSERT_EQ(zeros_index.count(), 0u);
+    ASSERT_EQ(zeros_index.rank(10000), 0u);
+    ASSERT_THROW(zeros_index.select(0), atom::outOfRange);
+}
+
+TEST(RankSelectTest, CheckBitsBehindSize) {
+    vector_t<bool> bits(3000, true);
+    bits.resize(2100);
+
+    rank_select_index<> index(bits);
+    ASSERT_EQ(index.count(), 2100u);
+    ASSERT_EQ(index.rank(2100), 2100u);
+    ASSERT_EQ(index.select(2099), 2099u);
+    ASSERT_THROW(index.select(2100), atom::outOfRange);
+    ASSERT_THROW(index.rank(2101), atom::outOfRange);
+}
+
+TEST(RankSelectTest, CheckUpdate) {
+    vector_t<bool>      bits = random_bits(1000, 3, 5);
+    rank_select_index<> index(bits);
+    check_index(bits, index);
+
+    // Appends into the partial block and behind it
+    unsigned int seed = 9;
+    for (size_t step : {1u, 100u, 948u, 2048u, 30000u}) {
+        for (size_t i = 0; i < step; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            bits.push_back((seed >> 8) % 3 == 0);
+        }
+
+        index.update();
+        check_index(bits, index);
+    }
+
+    const size_t count = index.count();
+    index.update();
+    ASSERT_EQ(index.count(), count);
+
+    // Changes in the middle need rebuild
+    bits.reset(index.select(0));
+    index.rebuild();
+    check_index(bits, index);
+
+    bits.resize(10);
+    ASSERT_THROW(index.update(), atom::outOfRange);
+}
+
+TEST(RankSelectTest, CheckOverhead) {
+    const vector_t<bool> bits = random_bits(1 << 22, 2, 1);
+    rank_select_index<>  index(bits);
+
+    // Under 5% of the bits
+    ASSERT_LT(index.memory_usage() * 8, bits.size() / 20);
+}
+
+TEST(RankSelectTest, CheckArray) {
+    array_t<bool, 5000> bits(5000, false);
+    for (size_t i = 0; i < 5000; i += 3) {
+        bits.set(i);
+    }
+
+    rank_select_index<array_t<bool, 5000> > index(bits);
+    ASSERT_EQ(index.count(), 1667u);
+    ASSERT_EQ(index.rank(3001), 1001u);
+    ASSERT_EQ(index.select(1000), 3000u);
+}
+
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,262 @@
+//#define ATOM_NDEBUG
+#include "roaring/roaring.h"
+#include "vector/vector.h"
+#include "exceptions.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <vector>
+
+using namespace atom;
+
+
+using id_set = std::set<std::uint32_t>;
+
+static std::vector<std::uint32_t> ids_of(const roaring_bitmap_t& bitmap) {
+    std::vector<std::uint32_t> result;
+    bitmap.for_each_set([&](const std::uint32_t id) {
+        result.push_back(id);
+    });
+    return result;
+}
+
+static void check_equal(const roaring_bitmap_t& bitmap, const id_set& expected) {
+    ASSERT_EQ(bitmap.count(), expected.size());
+    ASSERT_EQ(ids_of(bitmap), std::vector<std::uint32_t>(expected.begin(), expected.end()));
+
+    for (std::uint32_t id : expected) {
+        ASSERT_TRUE(bitmap[id]);
+        ASSERT_FALSE(bitmap[id + 1] && !expected.count(id + 1));
+    }
+}
+
+// Ids in [first, first + range), every id is taken with probability 1 / period
+static void add_random(roaring_bitmap_t& bitmap, id_set& expected, const std::uint32_t first,
+                       const std::uint32_t range, const unsigned int period, unsigned int seed) {
+    for (std::uint32_t i = 0; i < range; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        if ((seed >> 8) % period == 0) {
+            bitmap.set(first + i);
+            expected.insert(first + i);
+        }
+    }
+}
+
+static void add_range(roaring_bitmap_t& bitmap, id_set& expected, const std::uint32_t first, const std::uint32_t last) {
+    for (std::uint32_t id = first; id < last; ++id) {
+        bitmap.set(id);
+        expected.insert(id);
+    }
+}
+
+TEST(RoaringTest, CheckSetReset) {
+    roaring_bitmap_t bitmap;
+    id_set           expected;
+
+    ASSERT_TRUE(bitmap.empty());
+    ASSERT_THROW(bitmap.last(), atom::outOfRange);
+
+    for (std::uint32_t id : {7u, 3u, 0xFFFFFFFFu, 65536u, 65535u, 3u, 0x80000000u}) {
+        bitmap.set(id);
+        expected.insert(id);
+    }
+    check_equal(bitmap, expected);
+    ASSERT_FALSE(bitmap[4]);
+    ASSERT_EQ(bitmap.last(), 0xFFFFFFFFu);
+
+    bitmap.reset(3);
+    bitmap.reset(4);
+    bitmap.reset(0xFFFFFFFFu);
+    expected.erase(3);
+    expected.erase(0xFFFFFFFFu);
+    check_equal(bitmap, expected);
+    ASSERT_EQ(bitmap.last(), 0x80000000u);
+
+    // Array chunk becomes a bitmap behind ARRAY_MAX and back
+    add_random(bitmap, expected, 1u << 20, 1u << 16, 3, 1);
+    check_equal(bitmap, expected);
+
+    for (std::uint32_t id = 1u << 20; id < (1u << 20) + 50000; ++id) {
+        bitmap.reset(id);
+        expected.erase(id);
+    }
+    check_equal(bitmap, expected);
+
+    for (std::uint32_t id : id_set(expected)) {
+        bitmap.reset(id);
+    }
+    ASSERT_TRUE(bitmap.empty());
+    ASSERT_EQ(bitmap.count(), 0u);
+
+    bitmap.set(1);
+    bitmap.clear();
+    ASSERT_TRUE(bitmap.empty());
+}
+
+TEST(RoaringTest, CheckBits) {
+    // Sparse chunk, dense chunk, empty chunk and partial last chunk
+    const size_t   size = 4 * roaring_bitmap_t::CHUNK_BITS + 1000;
+    vector_t<bool> bits(size, false);
+
+    unsigned int seed = 5;
+    for (size_t i = 0; i < size; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        const bool dense = i / roaring_bitmap_t::CHUNK_BITS % 2 == 1;
+
+        if (i / roaring_bitmap_t::CHUNK_BITS != 2 && (seed >> 8) % (dense ? 2 : 100) == 0) {
+            bits.set(i);
+        }
+    }
+    bits.set(size - 1);
+
+    const roaring_bitmap_t bitmap(bits);
+    ASSERT_EQ(bitmap.count(), bits.count());
+    ASSERT_EQ(bitmap.last(), size - 1);
+    for (size_t i = 0; i < size; ++i) {
+        ASSERT_EQ(bitmap[static_cast<std::uint32_t>(i)], bits[i]);
+    }
+
+    const vector_t<bool> back = bitmap.to_bits(size);
+    ASSERT_EQ(back.size(), size);
+    ASSERT_EQ(xor_count(back, bits), 0u);
+
+    const vector_t<bool> longer = bitmap.to_bits(size + 100);
+    ASSERT_EQ(longer.count(), bits.count());
+
+    ASSERT_THROW(bitmap.to_bits(size - 1), atom::outOfRange);
+    ASSERT_EQ(roaring_bitmap_t().to_bits(10).count(), 0u);
+
+    // Bits behind the size of the source are not ids
+    vector_t<bool> ones(1000, true);
+    ones.resize(70);
+    ASSERT_EQ(roaring_bitmap_t(ones).count(), 70u);
+}
+
+TEST(RoaringTest, CheckAndOr) {
+    roaring_bitmap_t lhs;
+    roaring_bitmap_t rhs;
+    id_set           lhs_ids;
+    id_set           rhs_ids;
+
+    // Pairs of chunks: array & array, array & bitmap, bitmap & bitmap and keys of one side only
+    add_random(lhs, lhs_ids, 0,        1u << 16, 50, 1);
+    add_random(rhs, rhs_ids, 0,        1u << 16, 40, 2);
+    add_random(lhs, lhs_ids, 1u << 16, 1u << 16, 60, 3);
+    add_random(rhs, rhs_ids, 1u << 16, 1u << 16, 2,  4);
+    add_random(lhs, lhs_ids, 2u << 16, 1u << 16, 2,  5);
+    add_random(rhs, rhs_ids, 2u << 16, 1u << 16, 3,  6);
+    add_random(lhs, lhs_ids, 5u << 16, 1u << 16, 10, 7);
+    add_random(rhs, rhs_ids, 9u << 16, 1u << 16, 10, 8);
+
+    id_set and_ids;
+    id_set or_ids;
+    std::set_intersection(lhs_ids.begin(), lhs_ids.end(), rhs_ids.begin(), rhs_ids.end(),
+                          std::inserter(and_ids, and_ids.end()));
+    std::set_union(lhs_ids.begin(), lhs_ids.end(), rhs_ids.begin(), rhs_ids.end(),
+                   std::inserter(or_ids, or_ids.end()));
+
+    check_equal(lhs & rhs, and_ids);
+    check_equal(lhs | rhs, or_ids);
+    ASSERT_EQ(and_count(lhs, rhs), and_ids.size());
+    ASSERT_EQ(or_count(lhs, rhs), or_ids.size());
+
+    roaring_bitmap_t and_result = lhs;
+    and_result &= rhs;
+    check_equal(and_result, and_ids);
+
+    roaring_bitmap_t or_result = lhs;
+    or_result |= rhs;
+    check_equal(or_result, or_ids);
+
+    or_result |= or_result;
+    and_result &= and_result;
+    check_equal(or_result, or_ids);
+    check_equal(and_result, and_ids);
+
+    and_result &= roaring_bitmap_t();
+    ASSERT_TRUE(and_result.empty());
+}
+
+TEST(RoaringTest, CheckRuns) {
+    roaring_bitmap_t lhs;
+    roaring_bitmap_t rhs;
+    id_set           lhs_ids;
+    id_set           rhs_ids;
+
+    add_range(lhs, lhs_ids, 100,            30000);
+    add_range(lhs, lhs_ids, 40000,          40010);
+    add_range(lhs, lhs_ids, 1u << 16,       (1u << 16) + 200);
+    add_range(lhs, lhs_ids, (2u << 16) + 5, 3u << 16);
+    add_range(rhs, rhs_ids, 20000,          45000);
+    add_random(rhs, rhs_ids, 1u << 16, 1u << 16, 30, 1);
+    add_random(rhs, rhs_ids, 2u << 16, 1u << 16, 2,  2);
+
+    const size_t before = lhs.memory_usage();
+    ASSERT_TRUE(lhs.run_optimize());
+    ASSERT_LT(lhs.memory_usage() * 10, before);
+    check_equal(lhs, lhs_ids);
+    ASSERT_EQ(lhs.last(), (3u << 16) - 1);
+
+    // Random chunks stay flat
+    roaring_bitmap_t random = rhs;
+    random.run_optimize();
+    check_equal(random, rhs_ids);
+
+    // Run & run, run & array, run & bitmap
+    ASSERT_TRUE(rhs.run_optimize());
+
+    id_set and_ids;
+    id_set or_ids;
+    std::set_intersection(lhs_ids.begin(), lhs_ids.end(), rhs_ids.begin(), rhs_ids.end(),
+                          std::inserter(and_ids, and_ids.end()));
+    std::set_union(lhs_ids.begin(), lhs_ids.end(), rhs_ids.begin(), rhs_ids.end(),
+                   std::inserter(or_ids, or_ids.end()));
+
+    check_equal(lhs & rhs, and_ids);
+    check_equal(lhs | rhs, or_ids);
+    check_equal(rhs | lhs, or_ids);
+    ASSERT_EQ(and_count(lhs, rhs), and_ids.size());
+    ASSERT_EQ(and_count(rhs, lhs), and_ids.size());
+
+    const vector_t<bool> bits = lhs.to_bits(3u << 16);
+    ASSERT_EQ(bits.count(), lhs_ids.size());
+
+    // Changes unpack the run chunk
+    lhs.set(30000);
+    lhs.set(30001);
+    lhs.reset(100);
+    lhs.reset(15000);
+    lhs.reset(1u << 16);
+    lhs_ids.insert(30000);
+    lhs_ids.insert(30001);
+    lhs_ids.erase(100);
+    lhs_ids.erase(15000);
+    lhs_ids.erase(1u << 16);
+    check_equal(lhs, lhs_ids);
+
+    lhs.run_optimize();
+    check_equal(lhs, lhs_ids);
+}
+
+TEST(RoaringTest, CheckSparseMemory) {
+    // A few thousand ids over the whole 32-bit space
+    roaring_bitmap_t bitmap;
+    id_set           expected;
+
+    std::uint32_t id = 12345;
+    for (int i = 0; i < 5000; ++i) {
+        id = id * 1664525u + 1013904223u;
+        bitmap.set(id);
+        expected.insert(id);
+    }
+
+    check_equal(bitmap, expected);
+    ASSERT_LT(bitmap.memory_usage(), 1u << 20);
+}
+
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
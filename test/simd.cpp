@@ -0,0 +1,311 @@
+//#define ATOM_NDEBUG
+#include "simd/simd.h"
+#include "vector/vector.h"
+#include "array/array.h"
+#include "exceptions.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+using namespace atom;
+
+
+static const simd_level levels[] = {simd_level::scalar, simd_level::sse2, simd_level::avx2, simd_level::avx512};
+
+static std::vector<std::int32_t> random_ints(const std::size_t n, unsigned int seed) {
+    std::vector<std::int32_t> data(n);
+    for (std::int32_t& x : data) {
+        seed = seed * 1103515245u + 12345u;
+        x    = static_cast<std::int32_t>(seed) >> 8;
+    }
+    return data;
+}
+
+TEST(SimdTest, CheckDetectedLevel) {
+    const simd_level level = detected_simd_level();
+
+    ASSERT_EQ(level, detected_simd_level());
+#ifdef __x86_64__
+    ASSERT_TRUE(level >= simd_level::sse2);
+#endif
+}
+
+TEST(SimdTest, CheckFind) {
+    for (const simd_level level : levels) {
+        for (std::size_t n : {0u, 1u, 7u, 16u, 33u, 100u, 1000u}) {
+            std::vector<std::int32_t> ints(n, 5);
+            std::vector<float>        floats(n, 0.5f);
+
+            ASSERT_EQ(simd_find(ints.data(), n, 7, level), n);
+            ASSERT_EQ(simd_find(floats.data(), n, 1.5f, level), n);
+
+            for (std::size_t position = 0; position < n; position += 1 + position / 3) {
+                ints[position]   = 7;
+                floats[position] = 1.5f;
+
+                ASSERT_EQ(simd_find(ints.data(), n, 7, level), position);
+                ASSERT_EQ(simd_find(floats.data(), n, 1.5f, level), position);
+
+                ints[position]   = 5;
+                floats[position] = 0.5f;
+            }
+        }
+    }
+}
+
+TEST(SimdTest, CheckCount) {
+    for (const simd_level level : levels) {
+        for (std::size_t n : {0u, 3u, 16u, 61u, 1024u, 4099u}) {
+            std::vector<std::int32_t> ints(n);
+            std::vector<float>        floats(n);
+            std::size_t               expected = 0;
+
+            for (std::size_t i = 0; i < n; ++i) {
+                ints[i]   = static_cast<std::int32_t>(i % 5);
+                floats[i] = static_cast<float>(i % 5) - 2.0f;
+                expected += i % 5 == 3;
+            }
+
+            ASSERT_EQ(simd_count(ints.data(), n, 3, level), expected);
+            ASSERT_EQ(simd_count(floats.data(), n, 1.0f, level), expected);
+        }
+    }
+}
+
+TEST(SimdTest, CheckMinMax) {
+    for (const simd_level level : levels) {
+        for (std::size_t n : {1u, 5u, 16u, 17u, 255u, 4096u}) {
+            std::vector<std::int32_t> ints = random_ints(n, static_cast<unsigned int>(n));
+            std::vector<float>        floats(ints.begin(), ints.end());
+
+            const std::int32_t min_int = *std::min_element(ints.begin(), ints.end());
+            const std::int32_t max_int = *std::max_element(ints.begin(), ints.end());
+
+            ASSERT_EQ(simd_min(ints.data(), n, level), min_int);
+            ASSERT_EQ(simd_max(ints.data(), n, level), max_int);
+            ASSERT_EQ(simd_min(floats.data(), n, level), static_cast<float>(min_int));
+            ASSERT_EQ(simd_max(floats.data(), n, level), static_cast<float>(max_int));
+        }
+
+        const std::int32_t empty = 0;
+        ASSERT_THROW(simd_min(&empty, 0, level), atom::outOfRange);
+        ASSERT_THROW(simd_max(&empty, 0, level), atom::outOfRange);
+    }
+}
+
+TEST(SimdTest, CheckSum) {
+    for (const simd_level level : levels) {
+        for (std::size_t n : {0u, 2u, 15u, 32u, 100u, 5000u}) {
+            std::vector<std::int32_t> ints = random_ints(n, 7u + static_cast<unsigned int>(n));
+            std::vector<float>        floats(n);
+
+            long long expected       = 0;
+            double    expected_float = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                expected += ints[i];
+
+                // Quarters are exact, so the order of summation does not matter
+                floats[i]       = static_cast<float>(i % 8) * 0.25f;
+                expected_float += floats[i];
+            }
+
+            // Partial sums exceed int32_t, they must be kept in 64 bits
+            ints.push_back(INT32_MAX);
+            ints.push_back(INT32_MAX);
+            expected += 2LL * INT32_MAX;
+
+            ASSERT_EQ(simd_sum(ints.data(), n + 2, level), expected);
+            ASSERT_EQ(simd_sum(floats.data(), n, level), static_cast<float>(expected_float));
+        }
+    }
+}
+
+TEST(SimdTest, CheckPopcount) {
+    for (const simd_level level : levels) {
+        for (std::size_t n : {0u, 1u, 3u, 4u, 31u, 32u, 33u, 100u, 1000u}) {
+            std::vector<unsigned long long> words(n);
+            std::size_t                     expected = 0;
+
+            unsigned long long seed = 88172645463325252ull;
+            for (unsigned long long& word : words) {
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+                word  = seed;
+
+                for (unsigned long long x = word; x; x >>= 1) {
+                    expected += x & 1;
+                }
+            }
+
+            ASSERT_EQ(simd_popcount(words.data(), n, level), expected);
+        }
+
+        // Byte counters of the avx2 kernel must not overflow
+        std::vector<unsigned long long> ones(1000, ~0ull);
+        ASSERT_EQ(simd_popcount(ones.data(), ones.size(), level), 64000u);
+    }
+}
+
+TEST(SimdTest, CheckBitCombine) {
+    const simd_bit_op ops[] = {simd_bit_op::and_, simd_bit_op::or_, simd_bit_op::xor_, simd_bit_op::and_not};
+
+    for (const simd_level level : levels) {
+        for (std::size_t n : {0u, 1u, 3u, 4u, 9u, 16u, 33u, 1000u}) {
+            std::vector<unsigned long long> lhs(n);
+            std::vector<unsigned long long> rhs(n);
+
+            unsigned long long seed = 88172645463325252ull + n;
+            for (std::size_t i = 0; i < n; ++i) {
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+                lhs[i] = seed;
+                rhs[i] = seed * 0x9E3779B97F4A7C15ull;
+            }
+
+            for (const simd_bit_op op : ops) {
+                std::vector<unsigned long long> expected(n);
+                std::size_t                     expected_count = 0;
+
+                for (std::size_t i = 0; i < n; ++i) {
+                    switch (op) {
+                        case simd_bit_op::and_:    expected[i] = lhs[i] & rhs[i];  break;
+                        case simd_bit_op::or_:     expected[i] = lhs[i] | rhs[i];  break;
+                        case simd_bit_op::xor_:    expected[i] = lhs[i] ^ rhs[i];  break;
+                        case simd_bit_op::and_not: expected[i] = lhs[i] & ~rhs[i]; break;
+                    }
+                    expected_count += static_cast<std::size_t>(__builtin_popcountll(expected[i]));
+                }
+
+                std::vector<unsigned long long> result(n);
+                simd_bit_combine(result.data(), lhs.data(), rhs.data(), n, op, level);
+                ASSERT_EQ(result, expected);
+                ASSERT_EQ(simd_bit_combine_count(lhs.data(), rhs.data(), n, op, level), expected_count);
+
+                // Result in place of the left operand
+                result = lhs;
+                simd_bit_combine(result.data(), result.data(), rhs.data(), n, op, level);
+                ASSERT_EQ(result, expected);
+            }
+        }
+    }
+}
+
+TEST(SimdTest, CheckShiftWords) {
+    for (const simd_level level : levels) {
+        for (std::size_t n : {1u, 2u, 3u, 5u, 8u, 9u, 17u, 100u}) {
+            std::vector<unsigned long long> src(n + 2);
+
+            unsigned long long seed = 88172645463325252ull + n;
+            for (unsigned long long& word : src) {
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+                word  = seed;
+            }
+
+            for (unsigned int shift : {1u, 7u, 32u, 63u}) {
+                std::vector<unsigned long long> right(n);
+                std::vector<unsigned long long> left(n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    right[i] = src[i] >> shift | src[i + 1] << (64 - shift);
+                    left[i]  = src[i + 1] << shift | src[i] >> (64 - shift);
+                }
+
+                std::vector<unsigned long long> result(n);
+                simd_shift_right_words(result.data(), src.data(), n, shift, level);
+                ASSERT_EQ(result, right);
+                simd_shift_left_words(result.data(), src.data() + 1, n, shift, level);
+                ASSERT_EQ(result, left);
+
+                // In place: the result overlaps the source
+                std::vector<unsigned long long> data = src;
+                simd_shift_right_words(data.data(), data.data(), n, shift, level);
+                ASSERT_EQ(std::vector<unsigned long long>(data.begin(), data.begin() + n), right);
+
+                data = src;
+                simd_shift_left_words(data.data() + 1, data.data() + 1, n, shift, level);
+                ASSERT_EQ(std::vector<unsigned long long>(data.begin() + 1, data.begin() + n + 1), left);
+            }
+        }
+    }
+}
+
+TEST(SimdTest, CheckUnpackBits) {
+    for (const simd_level level : levels) {
+        for (unsigned int width = 1; width <= 32; ++width) {
+            for (std::size_t first : {0u, 1u, 5u, 37u}) {
+                for (std::size_t n : {0u, 1u, 7u, 8u, 16u, 33u, 100u}) {
+                    // Exactly the words of the fields, reads behind them are caught by sanitizers
+                    std::vector<unsigned long long> src(((first + n) * width + 63) / 64);
+
+                    unsigned long long seed = 88172645463325252ull + width * 131 + n;
+                    for (unsigned long long& word : src) {
+                        seed ^= seed << 13;
+                        seed ^= seed >> 7;
+                        seed ^= seed << 17;
+                        word  = seed;
+                    }
+
+                    std::vector<std::uint32_t> expected(n);
+                    for (std::size_t i = 0; i < n; ++i) {
+                        for (unsigned int bit = 0; bit < width; ++bit) {
+                            const std::size_t pos = (first + i) * width + bit;
+                            expected[i] |= static_cast<std::uint32_t>(src[pos / 64] >> pos % 64 & 1) << bit;
+                        }
+                    }
+
+                    std::vector<std::uint32_t> result(n);
+                    simd_unpack_bits(result.data(), src.data(), first, n, width, level);
+                    ASSERT_EQ(result, expected);
+                }
+            }
+        }
+    }
+}
+
+TEST(SimdTest, CheckOtherTypes) {
+    const double       doubles[] = {1.5, -2.5, 4.0, 1.5};
+    const unsigned int uints[]   = {4000000000u, 4000000000u, 1u};
+
+    ASSERT_EQ(simd_find(doubles, 4, 4.0), 2u);
+    ASSERT_EQ(simd_count(doubles, 4, 1.5), 2u);
+    ASSERT_DOUBLE_EQ(simd_min(doubles, 4), -2.5);
+    ASSERT_DOUBLE_EQ(simd_max(doubles, 4), 4.0);
+    ASSERT_DOUBLE_EQ(simd_sum(doubles, 4), 4.5);
+    ASSERT_EQ(simd_sum(uints, 3), 8000000001ull);
+}
+
+TEST(SimdTest, CheckContainers) {
+    vector_t<int> test_vector;
+    for (int i = 0; i < 1000; ++i) {
+        test_vector.push_back(i % 100 - 10);
+    }
+
+    ASSERT_EQ(test_vector.find(0), 10u);
+    ASSERT_EQ(test_vector.find(1000), test_vector.size());
+    ASSERT_EQ(test_vector.count(5), 10u);
+    ASSERT_EQ(test_vector.min(), -10);
+    ASSERT_EQ(test_vector.max(), 89);
+    ASSERT_EQ(test_vector.sum(), 39500);
+
+    vector_t<float> test_empty;
+    ASSERT_EQ(test_empty.find(1.0f), 0u);
+    ASSERT_EQ(test_empty.count(1.0f), 0u);
+    ASSERT_FLOAT_EQ(test_empty.sum(), 0.0f);
+    ASSERT_THROW(test_empty.min(), atom::outOfRange);
+
+    array_t<float, 64> test_array = {3.0f, -1.0f, 2.0f, 3.0f};
+    ASSERT_EQ(test_array.find(2.0f), 2u);
+    ASSERT_EQ(test_array.count(3.0f), 2u);
+    ASSERT_FLOAT_EQ(test_array.min(), -1.0f);
+    ASSERT_FLOAT_EQ(test_array.max(), 3.0f);
+    ASSERT_FLOAT_EQ(test_array.sum(), 7.0f);
+}
+
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,235 @@
+//#define ATOM_NDEBUG
+#include "small_vector/small_vector.h"
+#include "allocator/arena_allocator.h"
+#include "exceptions.h"
+#include <gtest/gtest.h>
+#include <iterator>
+#include <memory>
+#include <string>
+
+using namespace atom;
+
+
+TEST(SmallVectorConstructorTest, CheckConstructor) {
+    small_vector_t<int, 4> test_obj1;
+
+    ASSERT_EQ(test_obj1.size(), 0u);
+    ASSERT_EQ(test_obj1.capacity(), 4u);
+    ASSERT_TRUE(test_obj1.is_inline());
+
+    small_vector_t<double, 4> test_obj2(3, 1.5);
+    ASSERT_EQ(test_obj2.size(), 3u);
+    ASSERT_TRUE(test_obj2.is_inline());
+    ASSERT_DOUBLE_EQ(test_obj2[2], 1.5);
+
+    small_vector_t<std::string, 2> test_obj3(5);
+    ASSERT_EQ(test_obj3.size(), 5u);
+    ASSERT_FALSE(test_obj3.is_inline());
+    ASSERT_EQ(test_obj3[4], "");
+
+    small_vector_t<int, 2> test_obj4 = {1, 2, 3};
+    ASSERT_EQ(test_obj4.size(), 3u);
+    ASSERT_EQ(test_obj4[2], 3);
+}
+
+TEST(SmallVectorConstructorTest, CheckCopyConstructor) {
+    small_vector_t<std::string, 4> test_obj1 = {"a", "b"};
+    small_vector_t<std::string, 4> test_copy1(test_obj1);
+
+    ASSERT_TRUE(test_copy1.is_inline());
+    ASSERT_EQ(test_copy1[1], "b");
+
+    for (int i = 0; i < 10; ++i) {
+        test_obj1.push_back(std::to_string(i));
+    }
+
+    small_vector_t<std::string, 4> test_copy2(test_obj1);
+    ASSERT_FALSE(test_copy2.is_inline());
+    ASSERT_EQ(test_copy2.size(), 12u);
+    ASSERT_EQ(test_copy2[11], "9");
+    ASSERT_EQ(test_obj1[11], "9");
+}
+
+TEST(SmallVectorConstructorTest, CheckMoveConstructor) {
+    small_vector_t<std::string, 4> test_obj1 = {"a", "b", "c"};
+    small_vector_t<std::string, 4> test_move1(std::move(test_obj1));
+
+    ASSERT_EQ(test_move1.size(), 3u);
+    ASSERT_EQ(test_move1[2], "c");
+    ASSERT_EQ(test_obj1.size(), 0u);
+
+    small_vector_t<int, 2> test_obj2 = {1, 2, 3, 4, 5};
+    const int* data = &test_obj2[0];
+
+    small_vector_t<int, 2> test_move2(std::move(test_obj2));
+    ASSERT_EQ(&test_move2[0], data);
+    ASSERT_EQ(test_move2.size(), 5u);
+    ASSERT_EQ(test_obj2.size(), 0u);
+    ASSERT_TRUE(test_obj2.is_inline());
+
+    test_obj2.push_back(7);
+    ASSERT_EQ(test_obj2[0], 7);
+}
+
+TEST(SmallVectorOperatorTest, CheckAssignment) {
+    small_vector_t<std::string, 3> test_obj1 = {"x", "y", "z", "w"};
+    small_vector_t<std::string, 3> test_obj2 = {"a"};
+
+    test_obj2 = test_obj1;
+    ASSERT_EQ(test_obj2.size(), 4u);
+    ASSERT_EQ(test_obj2[3], "w");
+
+    test_obj1 = small_vector_t<std::string, 3>{"q"};
+    ASSERT_EQ(test_obj1.size(), 1u);
+    ASSERT_TRUE(test_obj1.is_inline());
+    ASSERT_EQ(test_obj1[0], "q");
+
+    test_obj1 = std::move(test_obj2);
+    ASSERT_EQ(test_obj1.size(), 4u);
+    ASSERT_EQ(test_obj1[0], "x");
+    ASSERT_EQ(test_obj2.size(), 0u);
+}
+
+TEST(SmallVectorOperatorTest, CheckOperatorAddressing) {
+    small_vector_t<int, 4> test_obj = {1, 2};
+
+    ASSERT_EQ(test_obj[1], 2);
+    ASSERT_THROW(test_obj[2], atom::outOfRange);
+
+    test_obj[0] = 10;
+    ASSERT_EQ(test_obj.front(), 10);
+    ASSERT_EQ(test_obj.back(), 2);
+}
+
+TEST(SmallVectorMethodTest, CheckPushBack) {
+    small_vector_t<long long, 8> test_obj;
+
+    const long long count_insert = 1000;
+    for (long long i = 0; i < count_insert; ++i) {
+        test_obj.push_back(i);
+        ASSERT_EQ(test_obj.is_inline(), i < 8);
+    }
+    for (long long i = 0; i < count_insert; ++i) {
+        ASSERT_EQ(test_obj[i], i);
+    }
+    ASSERT_TRUE(test_obj.capacity() >= static_cast<std::size_t>(count_insert));
+}
+
+TEST(SmallVectorMethodTest, CheckEmplaceBack) {
+    small_vector_t<std::string, 2> test_obj;
+
+    test_obj.emplace_back(3, 'a');
+    test_obj.emplace_back("long string which is not in small string buffer");
+
+    // Argument refers to element which is moved to the heap
+    test_obj.emplace_back(test_obj[1]);
+    ASSERT_FALSE(test_obj.is_inline());
+    ASSERT_EQ(test_obj[2], test_obj[1]);
+    ASSERT_EQ(test_obj[0], "aaa");
+
+    small_vector_t<int, 1> test_int;
+    test_int.push_back(1);
+    for (int i = 0; i < 100; ++i) {
+        test_int.emplace_back(test_int.back() + 1);
+    }
+    ASSERT_EQ(test_int[100], 101);
+}
+
+TEST(SmallVectorMethodTest, CheckErase) {
+    small_vector_t<int, 4> test_obj = {0, 1, 2, 3, 4, 5};
+
+    ASSERT_TRUE(test_obj.erase(0));
+    ASSERT_TRUE(test_obj.erase(4));
+    ASSERT_FALSE(test_obj.erase(4));
+
+    ASSERT_EQ(test_obj.size(), 4u);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_EQ(test_obj[i], i + 1);
+    }
+}
+
+TEST(SmallVectorMethodTest, CheckClear) {
+    small_vector_t<std::string, 2> test_obj = {"a", "b", "c"};
+
+    ASSERT_FALSE(test_obj.is_inline());
+
+    test_obj.clear();
+    ASSERT_TRUE(test_obj.empty());
+    ASSERT_TRUE(test_obj.is_inline());
+    ASSERT_EQ(test_obj.capacity(), 2u);
+
+    test_obj.push_back("d");
+    ASSERT_EQ(test_obj[0], "d");
+}
+
+TEST(SmallVectorMemoryTest, CheckReserveResize) {
+    small_vector_t<int, 4> test_obj;
+
+    test_obj.reserve(2);
+    ASSERT_EQ(test_obj.capacity(), 4u);
+    ASSERT_TRUE(test_obj.is_inline());
+
+    test_obj.resize(3, 7);
+    ASSERT_EQ(test_obj.size(), 3u);
+    ASSERT_EQ(test_obj[2], 7);
+
+    test_obj.reserve(100);
+    ASSERT_EQ(test_obj.capacity(), 100u);
+    ASSERT_FALSE(test_obj.is_inline());
+    ASSERT_EQ(test_obj[2], 7);
+
+    test_obj.resize(1);
+    ASSERT_EQ(test_obj.size(), 1u);
+    ASSERT_EQ(test_obj.capacity(), 100u);
+}
+
+TEST(SmallVectorMethodTest, CheckSwap) {
+    small_vector_t<std::string, 3> test_inline = {"a", "b"};
+    small_vector_t<std::string, 3> test_heap   = {"0", "1", "2", "3", "4"};
+
+    test_inline.swap(test_heap);
+    ASSERT_EQ(test_inline.size(), 5u);
+    ASSERT_FALSE(test_inline.is_inline());
+    ASSERT_EQ(test_inline[4], "4");
+    ASSERT_EQ(test_heap.size(), 2u);
+    ASSERT_TRUE(test_heap.is_inline());
+    ASSERT_EQ(test_heap[1], "b");
+
+    small_vector_t<std::string, 3> test_other = {"x", "y", "z", "w"};
+    test_inline.swap(test_other);
+    ASSERT_EQ(test_inline[0], "x");
+    ASSERT_EQ(test_other[0], "0");
+}
+
+TEST(SmallVectorMethodTest, CheckIterators) {
+    small_vector_t<int, 4> test_obj = {1, 2, 3, 4, 5};
+
+    int expected = 1;
+    for (auto it = test_obj.begin(); it != test_obj.end(); ++it) {
+        ASSERT_EQ(*it, expected++);
+    }
+    ASSERT_EQ(std::distance(test_obj.cbegin(), test_obj.cend()), 5);
+}
+
+TEST(SmallVectorMemoryTest, CheckAllocator) {
+    arena_t arena;
+
+    using vector_type = small_vector_t<int, 4, arena_allocator<int> >;
+
+    vector_type test_obj{arena_allocator<int>(arena)};
+    for (int i = 0; i < 100; ++i) {
+        test_obj.push_back(i);
+    }
+    ASSERT_EQ(test_obj.get_allocator().arena(), &arena);
+    ASSERT_EQ(test_obj[99], 99);
+
+    vector_type test_copy(test_obj);
+    ASSERT_EQ(test_copy.get_allocator().arena(), &arena);
+    ASSERT_EQ(test_copy[50], 50);
+}
+
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
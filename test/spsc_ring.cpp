@@ -0,0 +1,141 @@
+//#define ATOM_NDEBUG
+#include "spsc_ring/spsc_ring.h"
+#include "exceptions.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace atom;
+
+
+TEST(SpscRingTest, CheckPushPop) {
+    spsc_ring_t<int, 4> test_obj1;
+
+    ASSERT_EQ(test_obj1.capacity(), 4u);
+    ASSERT_TRUE(test_obj1.empty());
+
+    int value = 0;
+    ASSERT_FALSE(test_obj1.try_pop(value));
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(test_obj1.try_push(i));
+    }
+    ASSERT_FALSE(test_obj1.try_push(4));
+    ASSERT_EQ(test_obj1.size(), 4u);
+
+    // Indices pass the end of the buffer many times
+    for (int i = 4; i < 100; ++i) {
+        ASSERT_TRUE(test_obj1.try_pop(value));
+        ASSERT_EQ(value, i - 4);
+        ASSERT_TRUE(test_obj1.try_push(i));
+    }
+    ASSERT_EQ(test_obj1.size(), 4u);
+
+    for (int i = 96; i < 100; ++i) {
+        ASSERT_TRUE(test_obj1.try_pop(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_TRUE(test_obj1.empty());
+}
+
+TEST(SpscRingTest, CheckBatch) {
+    spsc_ring_t<std::uint64_t, 8> test_obj1;
+    std::uint64_t                 src[20];
+    std::uint64_t                 dst[20] = {};
+
+    for (std::uint64_t i = 0; i < 20; ++i) {
+        src[i] = i;
+    }
+
+    ASSERT_EQ(test_obj1.push_n(src, 5), 5u);
+    ASSERT_EQ(test_obj1.pop_n(dst, 3), 3u);
+    ASSERT_EQ(dst[2], 2u);
+
+    // 6 free slots: [5, 8) and [0, 3) of the buffer
+    ASSERT_EQ(test_obj1.push_n(src + 5, 20), 6u);
+    ASSERT_EQ(test_obj1.push_n(src, 1), 0u);
+
+    ASSERT_EQ(test_obj1.pop_n(dst, 20), 8u);
+    for (std::uint64_t i = 0; i < 8; ++i) {
+        ASSERT_EQ(dst[i], i + 3);
+    }
+    ASSERT_EQ(test_obj1.pop_n(dst, 20), 0u);
+    ASSERT_EQ(test_obj1.push_n(src, 0), 0u);
+}
+
+TEST(SpscRingTest, CheckNotTrivial) {
+    auto test_obj1 = std::make_unique<spsc_ring_t<std::string, 4> >();
+
+    std::string text(40, 'x');
+    ASSERT_TRUE(test_obj1->try_push(text));
+    ASSERT_TRUE(test_obj1->try_push(std::move(text)));
+    ASSERT_TRUE(text.empty());
+
+    const std::string src[3] = {"a", "bb", "ccc"};
+    ASSERT_EQ(test_obj1->push_n(src, 3), 2u);
+
+    std::string dst[4];
+    ASSERT_EQ(test_obj1->pop_n(dst, 3), 3u);
+    ASSERT_EQ(dst[0], std::string(40, 'x'));
+    ASSERT_EQ(dst[2], "a");
+
+    ASSERT_EQ(test_obj1->push_n(src, 3), 3u);
+    ASSERT_TRUE(test_obj1->try_pop(dst[3]));
+    ASSERT_EQ(dst[3], "bb");
+
+    // The rest is destroyed by the destructor
+    test_obj1.reset();
+}
+
+TEST(SpscRingTest, CheckThreads) {
+    const std::uint64_t count     = 1 << 20;
+    auto                test_obj1 = std::make_unique<spsc_ring_t<std::uint64_t, 1024> >();
+
+    std::thread producer([&]() {
+        std::uint64_t batch[7];
+        std::uint64_t next = 0;
+
+        while (next < count) {
+            // Single pushes and batches of the different sizes
+            if (next % 3) {
+                next += test_obj1->try_push(next);
+            }
+            else {
+                const std::uint64_t n = std::min<std::uint64_t>(7, count - next);
+                for (std::uint64_t i = 0; i < n; ++i) {
+                    batch[i] = next + i;
+                }
+                next += test_obj1->push_n(batch, n);
+            }
+            std::this_thread::yield();
+        }
+    });
+
+    std::uint64_t expected = 0;
+    std::uint64_t batch[5];
+    bool          in_order = true;
+
+    while (expected < count) {
+        const std::size_t n = test_obj1->pop_n(batch, 5);
+        for (std::size_t i = 0; i < n; ++i) {
+            in_order = in_order && batch[i] == expected;
+            ++expected;
+        }
+        if (!n) {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    ASSERT_TRUE(in_order);
+    ASSERT_TRUE(test_obj1->empty());
+}
+
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -6,6 +6,9 @@
 #include <algorithm>
 #include <vector>
 #include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
 
 using namespace atom;
 
@@ -359,6 +362,157 @@ TEST(VectorMethodTest, CheckErase) {
     ASSERT_EQ(test_obj1.size(), size_test_obj1 - 2);
 }
 
+TEST(VectorMethodTest, CheckEraseRange) {
+    vector_t<int> test_obj1 = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    ASSERT_FALSE(test_obj1.erase(3, 3));
+    ASSERT_FALSE(test_obj1.erase(10, 12));
+
+    ASSERT_TRUE(test_obj1.erase(2, 5));
+    ASSERT_EQ(test_obj1.size(), 7u);
+    ASSERT_EQ(test_obj1.capacity(), 10u);
+    ASSERT_EQ(test_obj1[1], 1);
+    ASSERT_EQ(test_obj1[2], 5);
+    ASSERT_EQ(test_obj1[6], 9);
+
+    ASSERT_TRUE(test_obj1.erase(4, 100));
+    ASSERT_EQ(test_obj1.size(), 4u);
+    ASSERT_EQ(test_obj1.back(), 6);
+
+    vector_t<std::string> test_obj2 = {"a", "b", "c", "d", "e"};
+
+    ASSERT_TRUE(test_obj2.erase(0, 2));
+    ASSERT_EQ(test_obj2.size(), 3u);
+    ASSERT_EQ(test_obj2[0], "c");
+    ASSERT_EQ(test_obj2[2], "e");
+}
+
+TEST(VectorMethodTest, CheckEraseUnordered) {
+    vector_t<std::string> test_obj1 = {"a", "b", "c", "d"};
+
+    ASSERT_FALSE(test_obj1.erase_unordered(4));
+
+    ASSERT_TRUE(test_obj1.erase_unordered(0));
+    ASSERT_EQ(test_obj1.size(), 3u);
+    ASSERT_EQ(test_obj1[0], "d");
+    ASSERT_EQ(test_obj1[2], "c");
+
+    ASSERT_TRUE(test_obj1.erase_unordered(2));
+    ASSERT_EQ(test_obj1.size(), 2u);
+    ASSERT_EQ(test_obj1.back(), "b");
+}
+
+TEST(VectorMethodTest, CheckEraseIf) {
+    vector_t<double> test_obj1;
+    for (int i = 0; i < 1000; ++i) {
+        test_obj1.push_back(i * 0.5);
+    }
+
+    ASSERT_EQ(test_obj1.erase_if([](double x) { return x >= 100.0; }), 800u);
+    ASSERT_EQ(test_obj1.size(), 200u);
+    ASSERT_EQ(test_obj1.capacity(), 1024u);
+    for (size_t i = 0; i < test_obj1.size(); ++i) {
+        ASSERT_DOUBLE_EQ(test_obj1[i], i * 0.5);
+    }
+
+    vector_t<std::string> test_obj2 = {"keep", "", "keep too", "", ""};
+
+    ASSERT_EQ(test_obj2.erase_if([](const std::string& x) { return x.empty(); }), 3u);
+    ASSERT_EQ(test_obj2.size(), 2u);
+    ASSERT_EQ(test_obj2[1], "keep too");
+
+    vector_t<int> test_obj3;
+    ASSERT_EQ(test_obj3.erase_if([](int) { return true; }), 0u);
+}
+
+TEST(VectorMethodTest, CheckInsert) {
+    vector_t<int> test_obj1 = {0, 1, 5, 6};
+    const int source[] = {2, 3, 4};
+
+    test_obj1.insert(2, source, source + 3);
+    ASSERT_EQ(test_obj1.size(), 7u);
+    for (int i = 0; i < 7; ++i) {
+        ASSERT_EQ(test_obj1[i], i);
+    }
+
+    test_obj1.insert(7, source, source + 1);
+    test_obj1.insert(0, source, source);
+    ASSERT_EQ(test_obj1.size(), 8u);
+    ASSERT_EQ(test_obj1[7], 2);
+
+    ASSERT_THROW(test_obj1.insert(9, source, source + 1), atom::outOfRange);
+
+    vector_t<std::string> test_obj2 = {"a", "e"};
+    const std::vector<std::string> words = {"b", "c", "d"};
+
+    test_obj2.insert(1, words.begin(), words.end());
+    ASSERT_EQ(test_obj2.size(), 5u);
+    ASSERT_EQ(test_obj2[1], "b");
+    ASSERT_EQ(test_obj2[3], "d");
+    ASSERT_EQ(test_obj2[4], "e");
+
+    std::istringstream stream("7 8 9");
+    test_obj1.insert(1, std::istream_iterator<int>(stream), std::istream_iterator<int>());
+    ASSERT_EQ(test_obj1.size(), 11u);
+    ASSERT_EQ(test_obj1[0], 0);
+    ASSERT_EQ(test_obj1[1], 7);
+    ASSERT_EQ(test_obj1[3], 9);
+    ASSERT_EQ(test_obj1[4], 1);
+}
+
+TEST(VectorMethodTest, CheckAppend) {
+    vector_t<double> test_obj1;
+    const double source[] = {0.5, 1.5, 2.5};
+
+    test_obj1.append(source, 3);
+    test_obj1.append(source, 0);
+    ASSERT_EQ(test_obj1.size(), 3u);
+    ASSERT_DOUBLE_EQ(test_obj1[2], 2.5);
+
+    // Source is the vector itself and the memory is reallocated
+    for (int i = 0; i < 5; ++i) {
+        test_obj1.append(&test_obj1[0], test_obj1.size());
+    }
+    ASSERT_EQ(test_obj1.size(), 96u);
+    for (size_t i = 0; i < test_obj1.size(); ++i) {
+        ASSERT_DOUBLE_EQ(test_obj1[i], source[i % 3]);
+    }
+
+    vector_t<std::string> test_obj2 = {"x", "y"};
+    test_obj2.append(&test_obj2[0], 2);
+    ASSERT_EQ(test_obj2.size(), 4u);
+    ASSERT_EQ(test_obj2[2], "x");
+    ASSERT_EQ(test_obj2[3], "y");
+}
+
+TEST(VectorMethodTest, CheckAssign) {
+    vector_t<int> test_obj1(20, 3);
+    const std::vector<int> source = {1, 2, 3};
+
+    test_obj1.assign(source.begin(), source.end());
+    ASSERT_EQ(test_obj1.size(), 3u);
+    ASSERT_EQ(test_obj1.capacity(), 20u);
+    ASSERT_EQ(test_obj1[2], 3);
+
+    const std::vector<int> big_source(50, 7);
+    test_obj1.assign(big_source.data(), big_source.data() + big_source.size());
+    ASSERT_EQ(test_obj1.size(), 50u);
+    ASSERT_EQ(test_obj1.capacity(), 50u);
+    ASSERT_EQ(test_obj1[49], 7);
+
+    vector_t<std::string> test_obj2 = {"a", "b", "c"};
+    const std::string words[] = {"q"};
+
+    test_obj2.assign(words, words + 1);
+    ASSERT_EQ(test_obj2.size(), 1u);
+    ASSERT_EQ(test_obj2[0], "q");
+
+    std::istringstream stream("4 5");
+    test_obj1.assign(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+    ASSERT_EQ(test_obj1.size(), 2u);
+    ASSERT_EQ(test_obj1[1], 5);
+}
+
 TEST(VectorMethodTest, CheckClear) {
     vector_t<int> test_obj1;
     test_obj1.clear();
@@ -408,8 +562,251 @@ TEST(VectorMethodTest, CheckIterators) {
     }
 }
 
+struct counted_t {
+    static int alive;
+
+    int value;
+
+    counted_t(int x = 0) : value(x) { ++alive; }
+    counted_t(const counted_t& that) : value(that.value) { ++alive; }
+    counted_t& operator=(const counted_t&) = default;
+    ~counted_t() { --alive; }
+};
+
+int counted_t::alive = 0;
+
+std::ostream& operator<<(std::ostream& out, const counted_t& x) {
+    return out << x.value;
+}
+
+bool operator!=(const counted_t& lhs, const counted_t& rhs) {
+    return lhs.value != rhs.value;
+}
+
+TEST(VectorMemoryTest, CheckRawStorage) {
+    counted_t::alive = 0;
+    {
+        vector_t<counted_t> test_obj1;
+
+        test_obj1.reserve(100);
+        ASSERT_TRUE(test_obj1.capacity() >= 100u);
+        ASSERT_EQ(counted_t::alive, 0);
+
+        for (int i = 0; i < 37; ++i) {
+            test_obj1.push_back(counted_t(i));
+        }
+        ASSERT_EQ(counted_t::alive, 37);
+
+        test_obj1.erase(5);
+        ASSERT_EQ(counted_t::alive, 36);
+        ASSERT_EQ(test_obj1[5].value, 6);
+
+        test_obj1.resize(50, counted_t(-1));
+        ASSERT_EQ(counted_t::alive, 50);
+        ASSERT_EQ(test_obj1[49].value, -1);
+
+        test_obj1.resize(10);
+        ASSERT_EQ(counted_t::alive, 10);
+
+        vector_t<counted_t> test_obj2(test_obj1);
+        ASSERT_EQ(counted_t::alive, 20);
+
+        test_obj2.clear();
+        ASSERT_EQ(counted_t::alive, 10);
+    }
+    ASSERT_EQ(counted_t::alive, 0);
+}
+
+struct buffer_t {
+    static int allocations;
+    static int copies;
+
+    std::size_t size;
+    int*        data;
+
+    explicit buffer_t(std::size_t n = 4) : size(n), data(new int[n]()) { ++allocations; }
+    buffer_t(const buffer_t& that) : size(that.size), data(new int[that.size]) {
+        std::copy_n(that.data, size, data);
+        ++allocations;
+        ++copies;
+    }
+    buffer_t(buffer_t&& that) noexcept : size(that.size), data(that.data) {
+        that.size = 0;
+        that.data = nullptr;
+    }
+    buffer_t& operator=(buffer_t that) noexcept {
+        std::swap(size, that.size);
+        std::swap(data, that.data);
+        return *this;
+    }
+    ~buffer_t() { delete[] data; }
+};
+
+int buffer_t::allocations = 0;
+int buffer_t::copies      = 0;
+
+std::ostream& operator<<(std::ostream& out, const buffer_t& x) {
+    return out << x.size;
+}
+
+bool operator!=(const buffer_t& lhs, const buffer_t& rhs) {
+    return lhs.size != rhs.size;
+}
+
+struct throwing_move_t {
+    static int copies;
+
+    int value;
+
+    throwing_move_t(int x = 0) : value(x) {}
+    throwing_move_t(const throwing_move_t& that) : value(that.value) { ++copies; }
+    throwing_move_t(throwing_move_t&& that) : value(that.value) {}
+    throwing_move_t& operator=(const throwing_move_t&) = default;
+};
+
+int throwing_move_t::copies = 0;
+
+std::ostream& operator<<(std::ostream& out, const throwing_move_t& x) {
+    return out << x.value;
+}
+
+bool operator!=(const throwing_move_t& lhs, const throwing_move_t& rhs) {
+    return lhs.value != rhs.value;
+}
+
+TEST(VectorMemoryTest, CheckMoveOnGrowth) {
+    buffer_t::allocations = 0;
+    buffer_t::copies      = 0;
+
+    const int count_insert = 1000;
+    {
+        vector_t<buffer_t> test_obj1;
+
+        for (int i = 0; i < count_insert; ++i) {
+            if (i & 1) {
+                test_obj1.emplace_back(i % 7 + 1);
+            }
+            else {
+                test_obj1.push_back(buffer_t(i % 7 + 1));
+            }
+        }
+
+        ASSERT_EQ(test_obj1.size(), static_cast<size_t>(count_insert));
+        ASSERT_EQ(buffer_t::allocations, count_insert);
+        ASSERT_EQ(buffer_t::copies, 0);
+
+        test_obj1.erase(0);
+        ASSERT_EQ(buffer_t::copies, 0);
+
+        test_obj1.push_back(test_obj1[0]);
+        ASSERT_EQ(buffer_t::copies, 1);
+        ASSERT_EQ(test_obj1.back().size, test_obj1[0].size);
+    }
+
+    throwing_move_t::copies = 0;
+
+    vector_t<throwing_move_t> test_obj2;
+    for (int i = 0; i < 9; ++i) {
+        test_obj2.emplace_back(i);
+    }
+
+    ASSERT_TRUE(throwing_move_t::copies > 0);
+    for (int i = 0; i < 9; ++i) {
+        ASSERT_EQ(test_obj2[i].value, i);
+    }
+}
+
+TEST(VectorMethodTest, CheckEmplaceBack) {
+    vector_t<std::string> test_obj1;
+
+    const size_t count_insert = 128;
+    for (size_t i = 0; i < count_insert; ++i) {
+        std::string& item = test_obj1.emplace_back(i + 1, 'a');
+        ASSERT_EQ(item.size(), i + 1);
+    }
+
+    for (size_t i = 0; i < count_insert; ++i) {
+        ASSERT_EQ(test_obj1[i], std::string(i + 1, 'a'));
+    }
+
+    ASSERT_EQ(test_obj1.capacity(), count_insert);
+
+    test_obj1.emplace_back(test_obj1[0]);
+    ASSERT_EQ(test_obj1.back(), "a");
+}
+
+//-----------------------------------------------------------------------------
+//! Custom growth policy: capacity is rounded up to the power of four
+//-----------------------------------------------------------------------------
+struct quad_growth_t {
+    static std::size_t next_capacity(std::size_t current, std::size_t required) noexcept {
+        std::size_t new_capacity = current ? current : 1;
+        while (new_capacity < required) {
+            new_capacity *= 4;
+        }
+        return new_capacity;
+    }
+};
+
+TEST(VectorMemoryTest, CheckGrowthPolicy) {
+    ASSERT_EQ(doubling_growth_policy::next_capacity(0, 1), 1u);
+    ASSERT_EQ(doubling_growth_policy::next_capacity(4, 5), 8u);
+    ASSERT_EQ(one_and_half_growth_policy::next_capacity(1, 2), 2u);
+    ASSERT_EQ(one_and_half_growth_policy::next_capacity(4, 5), 6u);
+    ASSERT_EQ(one_and_half_growth_policy::next_capacity(6, 7), 9u);
+    ASSERT_EQ(fixed_step_growth_policy<10>::next_capacity(0, 1), 10u);
+    ASSERT_EQ(fixed_step_growth_policy<10>::next_capacity(10, 25), 30u);
+
+    vector_t<int, default_allocator_t<int>, fixed_step_growth_policy<16> > test_obj1;
+    vector_t<int, default_allocator_t<int>, one_and_half_growth_policy>    test_obj2;
+    vector_t<int, default_allocator_t<int>, quad_growth_t>                 test_obj3;
+    vector_t<bool, default_allocator_t<bool>, fixed_step_growth_policy<2> > test_obj4;
+
+    for (int i = 0; i < 17; ++i) {
+        test_obj1.push_back(i);
+        test_obj2.push_back(i);
+        test_obj3.push_back(i);
+    }
+    for (int i = 0; i < 200; ++i) {
+        test_obj4.push_back(i % 2);
+    }
+
+    ASSERT_EQ(test_obj1.capacity(), 32u);
+    ASSERT_EQ(test_obj2.capacity(), 19u);
+    ASSERT_EQ(test_obj3.capacity(), 64u);
+    ASSERT_EQ(test_obj4.capacity(), 4 * BIT_BLOCK_SIZE);
+    ASSERT_EQ(test_obj1[16], 16);
+    ASSERT_EQ(test_obj2[16], 16);
+    ASSERT_EQ(test_obj3[16], 16);
+    ASSERT_EQ(test_obj4.count(), 100u);
+}
+
 //-------------------------------------------------<bool>------------------------------------------------------
 
+TEST(VectorMemoryTest, CheckShrinkToFit) {
+    vector_t<int> test_obj1;
+    test_obj1.reserve(1000);
+    for (int i = 0; i < 100; ++i) {
+        test_obj1.push_back(i);
+    }
+
+    test_obj1.shrink_to_fit();
+    ASSERT_EQ(test_obj1.capacity(), 100u);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(test_obj1[i], i);
+    }
+
+    vector_t<std::string> test_obj2(10, std::string("shrink"));
+    test_obj2.reserve(64);
+    test_obj2.shrink_to_fit();
+    ASSERT_EQ(test_obj2.capacity(), 10u);
+    ASSERT_EQ(test_obj2[9], "shrink");
+
+    test_obj2.clear();
+    test_obj2.shrink_to_fit();
+    ASSERT_EQ(test_obj2.capacity(), 0u);
+}
+
 TEST(VectorBoolConstructorTest, CheckConstructor) {
     vector_t<bool> test_obj1;
 
@@ -916,6 +1313,283 @@ TEST(VectorBoolMethodTest, CheckCount) {
 
     vector_t<bool> test_obj2;
     ASSERT_EQ(test_obj2.count(), 0u);
+
+    // Bits behind size are not counted
+    vector_t<bool> test_obj3(200, true);
+    test_obj3.resize(130);
+    ASSERT_EQ(test_obj3.count(), 130u);
+
+    // Size is a multiple of the block and the memory is full
+    vector_t<bool> test_obj4(4 * BIT_BLOCK_SIZE, true);
+    ASSERT_EQ(test_obj4.count(), 4 * BIT_BLOCK_SIZE);
+
+    vector_t<bool> test_obj5(100000, false);
+    for (size_t i = 0; i < test_obj5.size(); i += 7) {
+        test_obj5.set(i);
+    }
+    ASSERT_EQ(test_obj5.count(), 14286u);
+}
+
+TEST(VectorBoolMethodTest, CheckFindSetBits) {
+    // Sparse mask with set bits on the bounds of the blocks
+    const size_t   size_test = 100000;
+    vector_t<bool> test_obj1(size_test, false);
+    std::vector<size_t> positions = {0, 63, 64, 127, 4095, 50000, 99999};
+    for (size_t pos : positions) {
+        test_obj1.set(pos);
+    }
+
+    ASSERT_EQ(test_obj1.find_first(), 0u);
+    for (size_t i = 0; i + 1 < positions.size(); ++i) {
+        ASSERT_EQ(test_obj1.find_next(positions[i]), positions[i + 1]);
+        ASSERT_EQ(test_obj1.find_next(positions[i + 1] - 1), positions[i + 1]);
+        ASSERT_EQ(test_obj1.find_prev(positions[i + 1]), positions[i]);
+    }
+    ASSERT_EQ(test_obj1.find_next(99999), size_test);
+    ASSERT_EQ(test_obj1.find_next(size_test + 10), size_test);
+    ASSERT_EQ(test_obj1.find_prev(0), size_test);
+    ASSERT_EQ(test_obj1.find_prev(size_test), 99999u);
+    ASSERT_EQ(test_obj1.find_prev(size_test + 10), 99999u);
+
+    std::vector<size_t> visited;
+    test_obj1.for_each_set([&visited](size_t pos) { visited.push_back(pos); });
+    ASSERT_EQ(visited, positions);
+
+    visited.clear();
+    for (size_t pos : test_obj1.set_bits()) {
+        visited.push_back(pos);
+    }
+    ASSERT_EQ(visited, positions);
+    ASSERT_EQ(std::distance(test_obj1.set_bits().begin(), test_obj1.set_bits().end()),
+              static_cast<std::ptrdiff_t>(test_obj1.count()));
+
+    // Bits behind size are not visited
+    vector_t<bool> test_obj2(200, true);
+    test_obj2.resize(70);
+    test_obj2.reset(69);
+    ASSERT_EQ(test_obj2.find_next(68), 70u);
+    ASSERT_EQ(test_obj2.find_prev(1000), 68u);
+
+    size_t count_visited = 0;
+    test_obj2.for_each_set([&count_visited](size_t) { ++count_visited; });
+    ASSERT_EQ(count_visited, 69u);
+
+    count_visited = 0;
+    for (size_t pos : test_obj2.set_bits()) {
+        ASSERT_LT(pos, 69u);
+        ++count_visited;
+    }
+    ASSERT_EQ(count_visited, 69u);
+
+    vector_t<bool> test_empty;
+    ASSERT_EQ(test_empty.find_first(), 0u);
+    ASSERT_EQ(test_empty.find_prev(0), 0u);
+    ASSERT_TRUE(test_empty.set_bits().begin() == test_empty.set_bits().end());
+
+    vector_t<bool> test_zeros(1000, false);
+    ASSERT_EQ(test_zeros.find_first(), 1000u);
+    ASSERT_EQ(test_zeros.find_prev(1000), 1000u);
+    ASSERT_TRUE(test_zeros.set_bits().begin() == test_zeros.set_bits().end());
+}
+
+TEST(VectorBoolMethodTest, CheckEraseInsert) {
+    vector_t<bool>    test_obj1;
+    std::vector<bool> expected;
+
+    unsigned int seed = 7;
+    for (size_t i = 0; i < 1000; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        test_obj1.push_back((seed >> 8) % 3 == 0);
+        expected.push_back((seed >> 8) % 3 == 0);
+    }
+
+    // Ranges inside one block, across blocks and aligned on blocks
+    const std::pair<size_t, size_t> ranges[] = {{0, 1}, {5, 9}, {63, 65}, {64, 128}, {100, 300}, {1, 63}, {500, 2000}};
+    for (const auto& range : ranges) {
+        const size_t last = std::min(range.second, expected.size());
+
+        ASSERT_TRUE(test_obj1.erase(range.first, range.second));
+        expected.erase(expected.begin() + range.first, expected.begin() + last);
+
+        ASSERT_EQ(test_obj1.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(test_obj1[i], expected[i]);
+        }
+    }
+    ASSERT_FALSE(test_obj1.erase(3, 3));
+    ASSERT_FALSE(test_obj1.erase(expected.size()));
+
+    const size_t counts[] = {1, 3, 64, 70, 200, 1};
+    const size_t places[] = {0, 17, 64, 100, 5, 0};
+    for (size_t k = 0; k < 6; ++k) {
+        const bool   value = k % 2 == 0;
+        const size_t pos   = std::min(places[k], expected.size());
+
+        test_obj1.insert(pos, counts[k], value);
+        expected.insert(expected.begin() + pos, counts[k], value);
+
+        ASSERT_EQ(test_obj1.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(test_obj1[i], expected[i]);
+        }
+    }
+
+    test_obj1.insert(test_obj1.size(), true);
+    expected.push_back(true);
+    test_obj1.insert(1, false);
+    expected.insert(expected.begin() + 1, false);
+    ASSERT_EQ(test_obj1.count(), static_cast<size_t>(std::count(expected.begin(), expected.end(), true)));
+    ASSERT_TRUE(test_obj1.back());
+
+    ASSERT_THROW(test_obj1.insert(test_obj1.size() + 1, true), atom::outOfRange);
+}
+
+TEST(VectorBoolMethodTest, CheckAppendSubvector) {
+    vector_t<bool>    test_obj1;
+    std::vector<bool> expected;
+
+    unsigned int seed = 11;
+    for (size_t i = 0; i < 700; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        test_obj1.push_back((seed >> 8) % 2 == 0);
+        expected.push_back((seed >> 8) % 2 == 0);
+    }
+
+    // Windows inside one block, across blocks, aligned and shifted
+    const std::pair<size_t, size_t> windows[] = {{0, 0}, {0, 700}, {3, 5}, {60, 10}, {64, 128}, {1, 63}, {77, 500}, {699, 1}};
+    for (const auto& window : windows) {
+        const vector_t<bool> sub = test_obj1.subvector(window.first, window.second);
+
+        ASSERT_EQ(sub.size(), window.second);
+        for (size_t i = 0; i < window.second; ++i) {
+            ASSERT_EQ(sub[i], expected[window.first + i]);
+        }
+    }
+    ASSERT_THROW(test_obj1.subvector(600, 101), atom::outOfRange);
+    ASSERT_THROW(test_obj1.subvector(701, 0), atom::outOfRange);
+
+    // Appends at every offset in the block
+    for (const auto& window : windows) {
+        test_obj1.append(test_obj1.subvector(window.first, window.second));
+        expected.insert(expected.end(), expected.begin() + window.first,
+                        expected.begin() + window.first + window.second);
+
+        ASSERT_EQ(test_obj1.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(test_obj1[i], expected[i]);
+        }
+    }
+
+    test_obj1.append(test_obj1);
+    expected.insert(expected.end(), expected.begin(), expected.end());
+    ASSERT_EQ(test_obj1.size(), expected.size());
+    ASSERT_EQ(test_obj1.count(), static_cast<size_t>(std::count(expected.begin(), expected.end(), true)));
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(test_obj1[i], expected[i]);
+    }
+
+    vector_t<bool> test_obj2;
+    test_obj2.append(vector_t<bool>());
+    ASSERT_EQ(test_obj2.size(), 0u);
+}
+
+TEST(VectorBoolMethodTest, CheckBitwise) {
+    // Size is not a multiple of the block, so the last block is partial
+    const size_t size_test = 1000;
+
+    vector_t<bool> test_obj1(size_test, false);
+    vector_t<bool> test_obj2(size_test, false);
+    for (size_t i = 0; i < size_test; ++i) {
+        if (i % 2 == 0) {
+            test_obj1.set(i);
+        }
+        if (i % 3 == 0) {
+            test_obj2.set(i);
+        }
+    }
+
+    vector_t<bool> test_and     = test_obj1 & test_obj2;
+    vector_t<bool> test_or      = test_obj1 | test_obj2;
+    vector_t<bool> test_xor     = test_obj1 ^ test_obj2;
+    vector_t<bool> test_and_not = and_not(test_obj1, test_obj2);
+
+    ASSERT_EQ(test_and.size(), size_test);
+    for (size_t i = 0; i < size_test; ++i) {
+        const bool lhs = i % 2 == 0;
+        const bool rhs = i % 3 == 0;
+
+        ASSERT_EQ(test_and[i], lhs && rhs);
+        ASSERT_EQ(test_or[i], lhs || rhs);
+        ASSERT_EQ(test_xor[i], lhs != rhs);
+        ASSERT_EQ(test_and_not[i], lhs && !rhs);
+    }
+
+    ASSERT_EQ(test_and.count(), 167u);
+    ASSERT_EQ(test_or.count(), 667u);
+    ASSERT_EQ(test_xor.count(), 500u);
+    ASSERT_EQ(test_and_not.count(), 333u);
+
+    vector_t<bool> test_obj3 = test_obj1;
+    test_obj3 &= test_obj2;
+    ASSERT_EQ(test_obj3.count(), test_and.count());
+
+    test_obj3 = test_obj1;
+    test_obj3 |= test_obj2;
+    ASSERT_EQ(test_obj3.count(), test_or.count());
+
+    test_obj3 = test_obj1;
+    test_obj3 ^= test_obj2;
+    ASSERT_EQ(test_obj3.count(), test_xor.count());
+
+    test_obj3 = test_obj1;
+    test_obj3.and_not(test_obj2).and_not(test_obj2);
+    ASSERT_EQ(test_obj3.count(), test_and_not.count());
+
+    // Combination with itself
+    test_obj3 ^= test_obj3;
+    ASSERT_EQ(test_obj3.count(), 0u);
+
+    vector_t<bool> test_empty1;
+    vector_t<bool> test_empty2;
+    ASSERT_TRUE((test_empty1 | test_empty2).empty());
+
+    vector_t<bool> test_short(size_test - 1, true);
+    ASSERT_THROW(test_obj1 &= test_short, atom::invalidArgument);
+    ASSERT_THROW(test_obj1 ^ test_short, atom::invalidArgument);
+}
+
+TEST(VectorBoolMethodTest, CheckBitwiseCount) {
+    for (size_t size_test : {0u, 63u, 64u, 65u, 640u, 100001u}) {
+        vector_t<bool> test_obj1(size_test, false);
+        vector_t<bool> test_obj2(size_test, false);
+
+        unsigned int seed = static_cast<unsigned int>(size_test);
+        for (size_t i = 0; i < size_test; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            if (seed & (1u << 16)) {
+                test_obj1.set(i);
+            }
+            if (seed & (1u << 20)) {
+                test_obj2.set(i);
+            }
+        }
+
+        ASSERT_EQ(and_count(test_obj1, test_obj2), (test_obj1 & test_obj2).count());
+        ASSERT_EQ(or_count(test_obj1, test_obj2), (test_obj1 | test_obj2).count());
+        ASSERT_EQ(xor_count(test_obj1, test_obj2), (test_obj1 ^ test_obj2).count());
+        ASSERT_EQ(and_not_count(test_obj1, test_obj2), and_not(test_obj1, test_obj2).count());
+    }
+
+    // Bits behind size are not counted
+    vector_t<bool> test_obj3(200, true);
+    vector_t<bool> test_obj4(200, true);
+    test_obj3.resize(100);
+    test_obj4.resize(100);
+    ASSERT_EQ(or_count(test_obj3, test_obj4), 100u);
+    ASSERT_EQ(and_count(test_obj3, test_obj4), 100u);
+
+    vector_t<bool> test_short(10, true);
+    ASSERT_THROW(and_count(test_obj3, test_short), atom::invalidArgument);
 }
 
 